@@ -26,6 +26,10 @@ CircuitModelId ConfigProtocol::memory_model() const { return memory_model_; }
 
 int ConfigProtocol::num_regions() const { return num_regions_; }
 
+bool ConfigProtocol::frame_broadcast() const { return frame_broadcast_; }
+
+size_t ConfigProtocol::rle_count_size() const { return rle_count_size_; }
+
 size_t ConfigProtocol::num_prog_clocks() const {
   if (type_ != CONFIG_MEM_SCAN_CHAIN) {
     return 1;
@@ -136,6 +140,14 @@ void ConfigProtocol::set_num_regions(const int& num_regions) {
   num_regions_ = num_regions;
 }
 
+void ConfigProtocol::set_frame_broadcast(const bool& enable) {
+  frame_broadcast_ = enable;
+}
+
+void ConfigProtocol::set_rle_count_size(const size_t& count_size) {
+  rle_count_size_ = count_size;
+}
+
 void ConfigProtocol::set_prog_clock_port(const openfpga::BasicPort& port) {
   prog_clk_port_ = port;
   prog_clk_ccff_head_indices_.resize(prog_clk_port_.get_width());
@@ -321,10 +333,50 @@ int ConfigProtocol::validate_ccff_prog_clocks() const {
 /************************************************************************
  * Public Validators
  ***********************************************************************/
+int ConfigProtocol::validate_frame_broadcast() const {
+  int num_err = 0;
+  if ((true == frame_broadcast()) && (type() != CONFIG_MEM_FRAME_BASED)) {
+    VTR_LOG_ERROR(
+      "Broadcast is only applicable to frame-based configuration protocol!\n");
+    num_err++;
+  }
+  return num_err;
+}
+
+int ConfigProtocol::validate_rle_compression() const {
+  int num_err = 0;
+  if (0 == rle_count_size()) {
+    return num_err;
+  }
+  if (type() != CONFIG_MEM_SCAN_CHAIN) {
+    VTR_LOG_ERROR(
+      "Run-length encoding is only applicable to configuration chain "
+      "protocol!\n");
+    num_err++;
+    return num_err;
+  }
+  if (1 < num_prog_clocks()) {
+    VTR_LOG_ERROR(
+      "Run-length encoding is not applicable to configuration chains driven "
+      "by multiple programming clocks!\n");
+    num_err++;
+  }
+  if (31 < rle_count_size()) {
+    VTR_LOG_ERROR(
+      "Size of run length (=%lu) exceeds the maximum size (=31) of "
+      "run-length encoding!\n",
+      rle_count_size());
+    num_err++;
+  }
+  return num_err;
+}
+
 int ConfigProtocol::validate() const {
   int num_err = 0;
   if (type() == CONFIG_MEM_SCAN_CHAIN) {
     num_err += validate_ccff_prog_clocks();
   }
+  num_err += validate_frame_broadcast();
+  num_err += validate_rle_compression();
   return num_err;
 }
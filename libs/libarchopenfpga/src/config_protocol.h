@@ -30,6 +30,13 @@ class ConfigProtocol {
   std::string memory_model_name() const;
   CircuitModelId memory_model() const;
   int num_regions() const;
+  /* Check if the frame-based decoders can write to multiple targets at the
+   * same time, which is only valid for frame-based protocol */
+  bool frame_broadcast() const;
+  /* Find the size of run length in each token of a run-length encoded
+   * configuration chain bitstream. Zero means that run-length encoding is
+   * disabled. Only valid for configuration chain type! */
+  size_t rle_count_size() const;
 
   /* Find the number of programming clocks, only valid for configuration chain
    * type! */
@@ -59,6 +66,8 @@ class ConfigProtocol {
   void set_memory_model_name(const std::string& memory_model_name);
   void set_memory_model(const CircuitModelId& memory_model);
   void set_num_regions(const int& num_regions);
+  void set_frame_broadcast(const bool& enable);
+  void set_rle_count_size(const size_t& count_size);
 
   /* Add the programming clock port */
   void set_prog_clock_port(const openfpga::BasicPort& port);
@@ -90,6 +99,14 @@ class ConfigProtocol {
    * Return number of errors detected
    */
   int validate_ccff_prog_clocks() const;
+  /* Broadcast is only applicable to frame-based protocols
+   * Return number of errors detected
+   */
+  int validate_frame_broadcast() const;
+  /* Run-length encoding is only applicable to configuration chains driven by
+   * a single programming clock. Return number of errors detected
+   */
+  int validate_rle_compression() const;
 
  private: /* Internal data */
   /* The type of configuration protocol.
@@ -105,6 +122,18 @@ class ConfigProtocol {
   /* Number of configurable regions */
   int num_regions_;
 
+  /* Broadcast: This is only applicable to frame-based protocols.
+   * When enabled, the top-level frame decoders accept an address mask, so that
+   * identical configuration frames of different configurable children can be
+   * written in a single programming cycle */
+  bool frame_broadcast_ = false;
+
+  /* Run-length encoding: This is only applicable to configuration chain
+   * protocols. When enabled, a decompressor is inserted at the head of each
+   * configuration chain, which expands tokens of <value, run length> into
+   * configuration bits */
+  size_t rle_count_size_ = 0;
+
   /* Programming clock managment: This is only applicable to configuration chain
    * protocols */
   openfpga::BasicPort prog_clk_port_;
@@ -3,6 +3,9 @@
 
 /* Constants for XML parsers, including readers and writers */
 constexpr const char* XML_CONFIG_PROTOCOL_NUM_REGIONS_ATTR = "num_regions";
+constexpr const char* XML_CONFIG_PROTOCOL_BROADCAST_ATTR = "broadcast";
+constexpr const char* XML_CONFIG_PROTOCOL_RLE_COUNT_SIZE_ATTR =
+  "rle_count_size";
 constexpr const char* XML_CONFIG_PROTOCOL_CCFF_PROG_CLOCK_NODE_NAME =
   "programming_clock";
 constexpr const char* XML_CONFIG_PROTOCOL_CCFF_PROG_CLOCK_PORT_ATTR = "port";
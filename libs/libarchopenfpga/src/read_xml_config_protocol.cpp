@@ -178,6 +178,33 @@ static void read_xml_config_organization(pugi::xml_node& xml_config_orgz,
                    config_protocol.num_regions());
   }
 
+  /* Parse the broadcast option, which is only valid for frame-based protocol */
+  config_protocol.set_frame_broadcast(
+    get_attribute(xml_config_orgz, XML_CONFIG_PROTOCOL_BROADCAST_ATTR, loc_data,
+                  pugiutil::ReqOpt::OPTIONAL)
+      .as_bool(false));
+  if ((true == config_protocol.frame_broadcast()) &&
+      (CONFIG_MEM_FRAME_BASED != config_protocol.type())) {
+    archfpga_throw(loc_data.filename_c_str(), loc_data.line(xml_config_orgz),
+                   "Attribute '%s' is only applicable to frame-based "
+                   "configuration protocol!\n",
+                   XML_CONFIG_PROTOCOL_BROADCAST_ATTR);
+  }
+
+  /* Parse the run-length encoding option, which is only valid for
+   * configuration chain protocol */
+  config_protocol.set_rle_count_size(
+    get_attribute(xml_config_orgz, XML_CONFIG_PROTOCOL_RLE_COUNT_SIZE_ATTR,
+                  loc_data, pugiutil::ReqOpt::OPTIONAL)
+      .as_uint(0));
+  if ((0 < config_protocol.rle_count_size()) &&
+      (CONFIG_MEM_SCAN_CHAIN != config_protocol.type())) {
+    archfpga_throw(loc_data.filename_c_str(), loc_data.line(xml_config_orgz),
+                   "Attribute '%s' is only applicable to configuration chain "
+                   "protocol!\n",
+                   XML_CONFIG_PROTOCOL_RLE_COUNT_SIZE_ATTR);
+  }
+
   /* Parse Configuration chain protocols */
   if (config_protocol.type() == CONFIG_MEM_SCAN_CHAIN) {
     /* First pass: Get the programming clock port size */
@@ -34,6 +34,14 @@ static void write_xml_config_organization(std::fstream& fp, const char* fname,
     circuit_lib.model_name(config_protocol.memory_model()).c_str());
   write_xml_attribute(fp, XML_CONFIG_PROTOCOL_NUM_REGIONS_ATTR,
                       config_protocol.num_regions());
+  if (true == config_protocol.frame_broadcast()) {
+    write_xml_attribute(fp, XML_CONFIG_PROTOCOL_BROADCAST_ATTR,
+                        config_protocol.frame_broadcast());
+  }
+  if (0 < config_protocol.rle_count_size()) {
+    write_xml_attribute(fp, XML_CONFIG_PROTOCOL_RLE_COUNT_SIZE_ATTR,
+                        config_protocol.rle_count_size());
+  }
   fp << "/>"
      << "\n";
 
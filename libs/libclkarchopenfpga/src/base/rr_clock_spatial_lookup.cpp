@@ -1,11 +1,16 @@
 #include "rr_clock_spatial_lookup.h"
 
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
 namespace openfpga {  // begin namespace openfpga
 
-RRClockSpatialLookup::RRClockSpatialLookup() {}
+/* Number of directions which a clock node can be, i.e., INC and DEC */
+constexpr size_t NUM_CLOCK_NODE_DIRECTIONS = 2;
+
+RRClockSpatialLookup::RRClockSpatialLookup() { dims_.fill(0); }
 
 RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
                                          const ClockLevelId& lvl,
@@ -19,43 +24,35 @@ RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
     return RRNodeId::INVALID();
   }
 
-  /* Sanity check to ensure the x, y, side and ptc are in range
+  /* Sanity check to ensure the x, y, tree, level and pin are in range
    * - Return an valid id by searching in look-up when all the parameters are in
    * range
    * - Return an invalid id if any out-of-range is detected
    */
-  if (size_t(dir) >= rr_node_indices_.size()) {
-    VTR_LOG("Direction out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(x) >= rr_node_indices_[dir].dim_size(0)) {
-    VTR_LOG("X out of range");
+  if ((dir >= NUM_CLOCK_NODE_DIRECTIONS) || (size_t(x) >= dims_[0]) ||
+      (size_t(y) >= dims_[1]) || (size_t(tree) >= dims_[2]) ||
+      (size_t(lvl) >= dims_[3]) || (size_t(pin) >= dims_[4])) {
     return RRNodeId::INVALID();
   }
 
-  if (size_t(y) >= rr_node_indices_[dir].dim_size(1)) {
-    VTR_LOG("Y out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
-    VTR_LOG("Tree id out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(lvl) == rr_node_indices_[dir][x][y][size_t(tree)].size()) {
-    VTR_LOG("Level id out of range");
-    return RRNodeId::INVALID();
-  }
+  return rr_node_indices_[node_index(dir, x, y, size_t(tree), size_t(lvl),
+                                     size_t(pin))];
+}
 
-  if (size_t(pin) ==
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
-    VTR_LOG("Pin id out of range");
-    return RRNodeId::INVALID();
-  }
+size_t RRClockSpatialLookup::node_index(size_t dir, size_t x, size_t y,
+                                        size_t tree, size_t lvl,
+                                        size_t pin) const {
+  size_t index = dir;
+  index = index * dims_[0] + x;
+  index = index * dims_[1] + y;
+  index = index * dims_[2] + tree;
+  index = index * dims_[3] + lvl;
+  index = index * dims_[4] + pin;
+  return index;
+}
 
-  return rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)];
+MemoryUsage RRClockSpatialLookup::memory_usage() const {
+  return container_memory_usage("RRClockSpatialLookup", rr_node_indices_);
 }
 
 void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
@@ -65,69 +62,76 @@ void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
                                     const Direction& direction) {
   size_t dir = size_t(direction);
   VTR_ASSERT(node); /* Must have a valid node id to be added */
-  VTR_ASSERT_SAFE(2 == rr_node_indices_[dir].ndims());
-
-  resize_nodes(x, y, direction);
-
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
-    rr_node_indices_[dir][x][y].resize(size_t(tree) + 1);
-  }
+  VTR_ASSERT(dir < NUM_CLOCK_NODE_DIRECTIONS);
 
-  if (size_t(lvl) >= rr_node_indices_[dir][x][y][size_t(tree)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)].resize(size_t(lvl) + 1);
-  }
+  /* Resize on demand, this should seldom happen when nodes are reserved */
+  resize_nodes(x + 1, y + 1, int(size_t(tree)) + 1, int(size_t(lvl)) + 1,
+               int(size_t(pin)) + 1);
 
-  if (size_t(pin) >=
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].resize(size_t(pin) +
-                                                                  1);
-  }
-
-  /* Resize on demand finished; Register the node */
-  rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)] = node;
+  /* Register the node */
+  rr_node_indices_[node_index(dir, x, y, size_t(tree), size_t(lvl),
+                              size_t(pin))] = node;
 }
 
 void RRClockSpatialLookup::reserve_nodes(int x, int y, int tree, int lvl,
                                          int pin) {
-  for (Direction dir : {Direction::INC, Direction::DEC}) {
-    resize_nodes(x, y, dir);
-    for (int ix = 0; ix < x; ++ix) {
-      for (int iy = 0; iy < y; ++iy) {
-        rr_node_indices_[size_t(dir)][ix][iy].resize(tree);
-        for (int itree = 0; itree < tree; ++itree) {
-          rr_node_indices_[size_t(dir)][ix][iy][itree].resize(lvl);
-          for (int ilvl = 0; ilvl < lvl; ++ilvl) {
-            rr_node_indices_[size_t(dir)][ix][iy][itree][ilvl].resize(pin);
-          }
-        }
-      }
-    }
-  }
+  resize_nodes(x, y, tree, lvl, pin);
 }
 
-void RRClockSpatialLookup::resize_nodes(int x, int y,
-                                        const Direction& direction) {
+void RRClockSpatialLookup::resize_nodes(int x, int y, int tree, int lvl,
+                                        int pin) {
   /* Expand the fast look-up if the new node is out-of-range
    * This may seldom happen because the rr_graph building function
    * should ensure the fast look-up well organized
    */
-  size_t dir = size_t(direction);
-  VTR_ASSERT(dir < rr_node_indices_.size());
   VTR_ASSERT(x >= 0);
   VTR_ASSERT(y >= 0);
+  VTR_ASSERT(tree >= 0);
+  VTR_ASSERT(lvl >= 0);
+  VTR_ASSERT(pin >= 0);
+
+  std::array<size_t, 5> new_dims = {
+    std::max(dims_[0], size_t(x)), std::max(dims_[1], size_t(y)),
+    std::max(dims_[2], size_t(tree)), std::max(dims_[3], size_t(lvl)),
+    std::max(dims_[4], size_t(pin))};
+  if (new_dims == dims_) {
+    return;
+  }
+
+  /* Move the existing nodes to the new layout */
+  std::array<size_t, 5> old_dims = dims_;
+  std::vector<RRNodeId> old_rr_node_indices;
+  old_rr_node_indices.swap(rr_node_indices_);
+
+  dims_ = new_dims;
+  rr_node_indices_.assign(NUM_CLOCK_NODE_DIRECTIONS * dims_[0] * dims_[1] *
+                            dims_[2] * dims_[3] * dims_[4],
+                          RRNodeId::INVALID());
 
-  if ((x >= int(rr_node_indices_[dir].dim_size(0))) ||
-      (y >= int(rr_node_indices_[dir].dim_size(1)))) {
-    rr_node_indices_[dir].resize(
-      {std::max(rr_node_indices_[dir].dim_size(0), size_t(x) + 1),
-       std::max(rr_node_indices_[dir].dim_size(1), size_t(y) + 1)});
+  if (old_rr_node_indices.empty()) {
+    return;
+  }
+  size_t old_index = 0;
+  for (size_t idir = 0; idir < NUM_CLOCK_NODE_DIRECTIONS; ++idir) {
+    for (size_t ix = 0; ix < old_dims[0]; ++ix) {
+      for (size_t iy = 0; iy < old_dims[1]; ++iy) {
+        for (size_t itree = 0; itree < old_dims[2]; ++itree) {
+          for (size_t ilvl = 0; ilvl < old_dims[3]; ++ilvl) {
+            /* The pins are contiguous in both layouts */
+            std::copy_n(old_rr_node_indices.begin() + old_index, old_dims[4],
+                        rr_node_indices_.begin() +
+                          node_index(idir, ix, iy, itree, ilvl, 0));
+            old_index += old_dims[4];
+          }
+        }
+      }
+    }
   }
 }
 
 void RRClockSpatialLookup::clear() {
-  for (auto& data : rr_node_indices_) {
-    data.clear();
-  }
+  dims_.fill(0);
+  rr_node_indices_.clear();
 }
 
 }  // end namespace openfpga
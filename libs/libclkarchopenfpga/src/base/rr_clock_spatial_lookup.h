@@ -16,7 +16,11 @@
  *   - Update the look-up with new nodes
  *   - Find the id of a node with given information, e.g., x, y, type etc.
  */
+#include <array>
+#include <vector>
+
 #include "clock_network_fwd.h"
+#include "openfpga_memory_usage.h"
 #include "physical_types.h"
 #include "rr_graph_fwd.h"
 #include "rr_node_types.h"
@@ -60,6 +64,9 @@ class RRClockSpatialLookup {
                      const ClockLevelId& lvl, const ClockTreePinId& pin,
                      const Direction& direction) const;
 
+  /** @brief Estimate the heap memory of the lookup */
+  MemoryUsage memory_usage() const;
+
   /* -- Mutators -- */
  public:
   /**
@@ -87,6 +94,8 @@ class RRClockSpatialLookup {
 
   /**
    * @brief Allocate memory for the lookup with maximum sizes on each dimension
+   * The sizes are typically the grid size, the number of clock trees, the
+   * maximum depth and the maximum width of clock trees
    * .. note:: Must run before any other API!
    */
   void reserve_nodes(int x, int y, int tree, int lvl, int pin);
@@ -95,17 +104,23 @@ class RRClockSpatialLookup {
   void clear();
 
  private: /* Private mutators */
-  /** @brief Resize the nodes upon needs */
-  void resize_nodes(int x, int y, const Direction& direction);
+  /** @brief Resize the nodes upon needs, existing nodes are kept */
+  void resize_nodes(int x, int y, int tree, int lvl, int pin);
+
+ private: /* Private accessors */
+  /** @brief Return the index of a node in the flatten storage */
+  size_t node_index(size_t dir, size_t x, size_t y, size_t tree, size_t lvl,
+                    size_t pin) const;
 
   /* -- Internal data storage -- */
  private:
-  /* Fast look-up:
+  /* Sizes of each dimension: [x][y][tree_id][level_id][clock_pin_id] */
+  std::array<size_t, 5> dims_;
+  /* Fast look-up, stored in a contiguous array:
    * [INC|DEC][0..grid_width][0..grid_height][tree_id][level_id][clock_pin_id]
+   * The last dimension is the fastest changing one
    */
-  std::array<vtr::NdMatrix<std::vector<std::vector<std::vector<RRNodeId>>>, 2>,
-             2>
-    rr_node_indices_;
+  std::vector<RRNodeId> rr_node_indices_;
 };
 
 }  // end namespace openfpga
@@ -0,0 +1,125 @@
+/********************************************************************
+ * Benchmark to validate the correctness and the scalability of the clock
+ * node lookup. Clock nodes are registered and then queried in the same way
+ * as the routing resource graph builder and the clock router do, on a
+ * 100x100 device with 16 clock trees by default
+ *******************************************************************/
+#include <string>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from libclkarchopenfpga */
+#include "rr_clock_spatial_lookup.h"
+
+int main(int argc, const char** argv) {
+  /* Optional arguments: <grid_size> <num_trees> <num_levels> <num_pins> */
+  VTR_ASSERT((1 == argc) || (5 == argc));
+  int grid_size = 100;
+  int num_trees = 16;
+  int num_levels = 4;
+  int num_pins = 8;
+  if (5 == argc) {
+    grid_size = std::stoi(argv[1]);
+    num_trees = std::stoi(argv[2]);
+    num_levels = std::stoi(argv[3]);
+    num_pins = std::stoi(argv[4]);
+  }
+
+  openfpga::RRClockSpatialLookup clk_rr_lookup;
+  size_t num_nodes = 0;
+  {
+    vtr::ScopedStartFinishTimer timer("Add nodes to clock node lookup");
+    clk_rr_lookup.reserve_nodes(grid_size, grid_size, num_trees, num_levels,
+                                num_pins);
+    for (int ix = 0; ix < grid_size; ++ix) {
+      for (int iy = 0; iy < grid_size; ++iy) {
+        for (int itree = 0; itree < num_trees; ++itree) {
+          for (int ilvl = 0; ilvl < num_levels; ++ilvl) {
+            for (int ipin = 0; ipin < num_pins; ++ipin) {
+              for (auto node_dir : {Direction::INC, Direction::DEC}) {
+                clk_rr_lookup.add_node(
+                  RRNodeId(num_nodes), ix, iy, openfpga::ClockTreeId(itree),
+                  openfpga::ClockLevelId(ilvl), openfpga::ClockTreePinId(ipin),
+                  node_dir);
+                num_nodes++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  VTR_LOG("Added %lu clock nodes\n", num_nodes);
+
+  size_t num_err = 0;
+  {
+    vtr::ScopedStartFinishTimer timer("Find nodes from clock node lookup");
+    size_t expected_node = 0;
+    for (int ix = 0; ix < grid_size; ++ix) {
+      for (int iy = 0; iy < grid_size; ++iy) {
+        for (int itree = 0; itree < num_trees; ++itree) {
+          for (int ilvl = 0; ilvl < num_levels; ++ilvl) {
+            for (int ipin = 0; ipin < num_pins; ++ipin) {
+              for (auto node_dir : {Direction::INC, Direction::DEC}) {
+                RRNodeId node = clk_rr_lookup.find_node(
+                  ix, iy, openfpga::ClockTreeId(itree),
+                  openfpga::ClockLevelId(ilvl), openfpga::ClockTreePinId(ipin),
+                  node_dir);
+                if (RRNodeId(expected_node) != node) {
+                  num_err++;
+                }
+                expected_node++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Out-of-range queries must return invalid ids */
+  if (clk_rr_lookup.find_node(grid_size, 0, openfpga::ClockTreeId(0),
+                              openfpga::ClockLevelId(0),
+                              openfpga::ClockTreePinId(0), Direction::INC)) {
+    num_err++;
+  }
+  if (clk_rr_lookup.find_node(0, 0, openfpga::ClockTreeId(0),
+                              openfpga::ClockLevelId(num_levels),
+                              openfpga::ClockTreePinId(0), Direction::INC)) {
+    num_err++;
+  }
+  if (clk_rr_lookup.find_node(0, 0, openfpga::ClockTreeId(0),
+                              openfpga::ClockLevelId(0),
+                              openfpga::ClockTreePinId(num_pins),
+                              Direction::INC)) {
+    num_err++;
+  }
+
+  /* Nodes added out of the reserved range must not corrupt existing ones */
+  clk_rr_lookup.add_node(RRNodeId(num_nodes), grid_size, grid_size,
+                         openfpga::ClockTreeId(num_trees),
+                         openfpga::ClockLevelId(0), openfpga::ClockTreePinId(0),
+                         Direction::DEC);
+  if (RRNodeId(num_nodes) !=
+      clk_rr_lookup.find_node(grid_size, grid_size,
+                              openfpga::ClockTreeId(num_trees),
+                              openfpga::ClockLevelId(0),
+                              openfpga::ClockTreePinId(0), Direction::DEC)) {
+    num_err++;
+  }
+  if (RRNodeId(num_nodes - 1) !=
+      clk_rr_lookup.find_node(grid_size - 1, grid_size - 1,
+                              openfpga::ClockTreeId(num_trees - 1),
+                              openfpga::ClockLevelId(num_levels - 1),
+                              openfpga::ClockTreePinId(num_pins - 1),
+                              Direction::DEC)) {
+    num_err++;
+  }
+
+  VTR_LOG("Found %lu errors in clock node lookup\n", num_err);
+
+  return num_err ? 1 : 0;
+}
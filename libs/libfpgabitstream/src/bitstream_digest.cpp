@@ -0,0 +1,291 @@
+/********************************************************************
+ * This file includes functions to build the digests of the blocks of a
+ * bitstream manager, and to find the blocks which differ between two
+ * bitstream managers by comparing the digests from the top down.
+ * Subtrees with the same digests are skipped, so that the time of a diff
+ * depends on the number of differences rather than the size of bitstreams.
+ *******************************************************************/
+#include "bitstream_digest.h"
+
+#include <fstream>
+#include <map>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "bitstream_manager_utils.h"
+#include "openfpga_digest.h"
+#include "openfpga_hash.h"
+#include "openfpga_thread_pool.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Compute the digest of a block, whose child blocks have digests already
+ *******************************************************************/
+static uint64_t compute_bitstream_block_digest(
+  const BitstreamManager& bitstream_manager, const ConfigBlockId& block,
+  const BitstreamBlockDigests& block_digests) {
+  StableHash hash;
+  hash.add_string(bitstream_manager.block_name(block));
+
+  /* Pack the bits into words */
+  std::vector<ConfigBitId> block_bits = bitstream_manager.block_bits(block);
+  hash.add_integer(block_bits.size());
+  uint64_t word = 0;
+  for (size_t ibit = 0; ibit < block_bits.size(); ++ibit) {
+    if (true == bitstream_manager.bit_value(block_bits[ibit])) {
+      word |= uint64_t(1) << (ibit % 64);
+    }
+    if ((63 == ibit % 64) || (ibit == block_bits.size() - 1)) {
+      hash.add_integer(word);
+      word = 0;
+    }
+  }
+
+  std::vector<ConfigBlockId> child_blocks =
+    bitstream_manager.block_children(block);
+  hash.add_integer(child_blocks.size());
+  for (const ConfigBlockId& child_block : child_blocks) {
+    hash.add_integer(block_digests[child_block]);
+  }
+  return hash.value();
+}
+
+/********************************************************************
+ * Build the digests of all the blocks, from the leaf blocks up to the
+ * top-level blocks. The blocks at the same depth of the hierarchy are
+ * independent from each other, so they are computed in parallel
+ *******************************************************************/
+BitstreamBlockDigests build_bitstream_manager_block_digests(
+  const BitstreamManager& bitstream_manager) {
+  /* Group the blocks by depth, with the top-level blocks at depth 0 */
+  std::vector<std::vector<ConfigBlockId>> depth_blocks;
+  depth_blocks.push_back(find_bitstream_manager_top_blocks(bitstream_manager));
+  while (!depth_blocks.back().empty()) {
+    std::vector<ConfigBlockId> next_depth_blocks;
+    for (const ConfigBlockId& block : depth_blocks.back()) {
+      for (const ConfigBlockId& child_block :
+           bitstream_manager.block_children(block)) {
+        next_depth_blocks.push_back(child_block);
+      }
+    }
+    depth_blocks.push_back(std::move(next_depth_blocks));
+  }
+
+  BitstreamBlockDigests block_digests(bitstream_manager.num_blocks(), 0);
+  for (auto it = depth_blocks.rbegin(); it != depth_blocks.rend(); ++it) {
+    const std::vector<ConfigBlockId>& blocks = *it;
+    parallel_for(0, blocks.size(), [&](const size_t& iblk) {
+      block_digests[blocks[iblk]] = compute_bitstream_block_digest(
+        bitstream_manager, blocks[iblk], block_digests);
+    });
+  }
+
+  return block_digests;
+}
+
+/********************************************************************
+ * Find the digest of a whole bitstream, which covers all the top-level
+ * blocks
+ *******************************************************************/
+uint64_t find_bitstream_manager_digest(
+  const BitstreamManager& bitstream_manager,
+  const BitstreamBlockDigests& block_digests) {
+  std::vector<ConfigBlockId> top_blocks =
+    find_bitstream_manager_top_blocks(bitstream_manager);
+  StableHash hash;
+  hash.add_integer(top_blocks.size());
+  for (const ConfigBlockId& top_block : top_blocks) {
+    hash.add_integer(block_digests[top_block]);
+  }
+  return hash.value();
+}
+
+/********************************************************************
+ * Report a block which exists in only one of the bitstreams, together with
+ * the number of bits in its subtree
+ *******************************************************************/
+static void add_bitstream_block_only_in_one(
+  std::vector<BitstreamBlockDiff>& diffs,
+  const BitstreamManager& bitstream_manager, const ConfigBlockId& block,
+  const std::string& path, const e_bitstream_diff_type& diff_type) {
+  BitstreamBlockDiff diff;
+  diff.type = diff_type;
+  diff.path = path;
+  diff.num_ref_bits = 0;
+  diff.num_curr_bits = 0;
+  diff.num_diff_bits = 0;
+  size_t num_bits =
+    rec_find_bitstream_manager_block_sum_of_bits(bitstream_manager, block);
+  if (BITSTREAM_DIFF_ONLY_IN_REF == diff_type) {
+    diff.num_ref_bits = num_bits;
+  } else {
+    VTR_ASSERT(BITSTREAM_DIFF_ONLY_IN_CURR == diff_type);
+    diff.num_curr_bits = num_bits;
+  }
+  diffs.push_back(diff);
+}
+
+/********************************************************************
+ * Compare the blocks with the same path in the two bitstreams.
+ * Only the child blocks whose digests differ are visited
+ *******************************************************************/
+static void rec_diff_bitstream_blocks(
+  std::vector<BitstreamBlockDiff>& diffs,
+  const BitstreamManager& ref_bitstream_manager,
+  const BitstreamBlockDigests& ref_block_digests,
+  const ConfigBlockId& ref_block,
+  const BitstreamManager& curr_bitstream_manager,
+  const BitstreamBlockDigests& curr_block_digests,
+  const ConfigBlockId& curr_block, const std::string& path) {
+  if (ref_block_digests[ref_block] == curr_block_digests[curr_block]) {
+    return;
+  }
+
+  /* Compare the bits of the block itself */
+  std::vector<ConfigBitId> ref_bits =
+    ref_bitstream_manager.block_bits(ref_block);
+  std::vector<ConfigBitId> curr_bits =
+    curr_bitstream_manager.block_bits(curr_block);
+  size_t num_diff_bits = 0;
+  if (ref_bits.size() == curr_bits.size()) {
+    for (size_t ibit = 0; ibit < ref_bits.size(); ++ibit) {
+      if (ref_bitstream_manager.bit_value(ref_bits[ibit]) !=
+          curr_bitstream_manager.bit_value(curr_bits[ibit])) {
+        num_diff_bits++;
+      }
+    }
+  }
+  if ((ref_bits.size() != curr_bits.size()) || (0 < num_diff_bits)) {
+    BitstreamBlockDiff diff;
+    diff.type = BITSTREAM_DIFF_BITS;
+    diff.path = path;
+    diff.num_ref_bits = ref_bits.size();
+    diff.num_curr_bits = curr_bits.size();
+    diff.num_diff_bits = num_diff_bits;
+    diffs.push_back(diff);
+  }
+
+  /* Pair the child blocks by names */
+  std::map<std::string, ConfigBlockId> curr_child_blocks;
+  for (const ConfigBlockId& curr_child :
+       curr_bitstream_manager.block_children(curr_block)) {
+    curr_child_blocks[curr_bitstream_manager.block_name(curr_child)] =
+      curr_child;
+  }
+  for (const ConfigBlockId& ref_child :
+       ref_bitstream_manager.block_children(ref_block)) {
+    std::string child_name = ref_bitstream_manager.block_name(ref_child);
+    std::string child_path = path + std::string("/") + child_name;
+    auto result = curr_child_blocks.find(child_name);
+    if (result == curr_child_blocks.end()) {
+      add_bitstream_block_only_in_one(diffs, ref_bitstream_manager, ref_child,
+                                      child_path, BITSTREAM_DIFF_ONLY_IN_REF);
+      continue;
+    }
+    rec_diff_bitstream_blocks(diffs, ref_bitstream_manager, ref_block_digests,
+                              ref_child, curr_bitstream_manager,
+                              curr_block_digests, result->second, child_path);
+    curr_child_blocks.erase(result);
+  }
+  /* Keep the order of the current bitstream for the remaining blocks */
+  for (const ConfigBlockId& curr_child :
+       curr_bitstream_manager.block_children(curr_block)) {
+    std::string child_name = curr_bitstream_manager.block_name(curr_child);
+    if (0 == curr_child_blocks.count(child_name)) {
+      continue;
+    }
+    add_bitstream_block_only_in_one(diffs, curr_bitstream_manager, curr_child,
+                                    path + std::string("/") + child_name,
+                                    BITSTREAM_DIFF_ONLY_IN_CURR);
+  }
+}
+
+/********************************************************************
+ * Find the blocks which differ between a reference bitstream and a current
+ * bitstream. Blocks are paired by their hierarchical names. A block which
+ * exists in only one bitstream is reported without its child blocks
+ *******************************************************************/
+std::vector<BitstreamBlockDiff> diff_bitstream_managers(
+  const BitstreamManager& ref_bitstream_manager,
+  const BitstreamBlockDigests& ref_block_digests,
+  const BitstreamManager& curr_bitstream_manager,
+  const BitstreamBlockDigests& curr_block_digests) {
+  std::vector<BitstreamBlockDiff> diffs;
+
+  std::map<std::string, ConfigBlockId> curr_top_blocks;
+  for (const ConfigBlockId& curr_top :
+       find_bitstream_manager_top_blocks(curr_bitstream_manager)) {
+    curr_top_blocks[curr_bitstream_manager.block_name(curr_top)] = curr_top;
+  }
+  for (const ConfigBlockId& ref_top :
+       find_bitstream_manager_top_blocks(ref_bitstream_manager)) {
+    std::string top_name = ref_bitstream_manager.block_name(ref_top);
+    auto result = curr_top_blocks.find(top_name);
+    if (result == curr_top_blocks.end()) {
+      add_bitstream_block_only_in_one(diffs, ref_bitstream_manager, ref_top,
+                                      top_name, BITSTREAM_DIFF_ONLY_IN_REF);
+      continue;
+    }
+    rec_diff_bitstream_blocks(diffs, ref_bitstream_manager, ref_block_digests,
+                              ref_top, curr_bitstream_manager,
+                              curr_block_digests, result->second, top_name);
+    curr_top_blocks.erase(result);
+  }
+  for (const auto& curr_top : curr_top_blocks) {
+    add_bitstream_block_only_in_one(diffs, curr_bitstream_manager,
+                                    curr_top.second, curr_top.first,
+                                    BITSTREAM_DIFF_ONLY_IN_CURR);
+  }
+
+  return diffs;
+}
+
+/********************************************************************
+ * Write the digests of a bitstream to a plain text file.
+ * The first line is the digest of the whole bitstream, so that two
+ * bitstreams can be compared by their first lines only. The following
+ * lines are the digests of the top-level blocks and their child blocks,
+ * to locate the differences at a glance.
+ * The file has no time stamp, so that identical bitstreams give identical
+ * files
+ *******************************************************************/
+int write_bitstream_manager_digest(const BitstreamManager& bitstream_manager,
+                                   const BitstreamBlockDigests& block_digests,
+                                   const std::string& fname) {
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  check_file_stream(fname.c_str(), fp);
+
+  fp << std::hex;
+  fp.fill('0');
+  fp.width(16);
+  fp << find_bitstream_manager_digest(bitstream_manager, block_digests)
+     << std::endl;
+  for (const ConfigBlockId& top_block :
+       find_bitstream_manager_top_blocks(bitstream_manager)) {
+    std::string top_name = bitstream_manager.block_name(top_block);
+    fp.width(16);
+    fp << block_digests[top_block] << " " << top_name << std::endl;
+    for (const ConfigBlockId& child_block :
+         bitstream_manager.block_children(top_block)) {
+      fp.width(16);
+      fp << block_digests[child_block] << " " << top_name << "/"
+         << bitstream_manager.block_name(child_block) << std::endl;
+    }
+  }
+
+  if (!fp.good()) {
+    VTR_LOG_ERROR("Failed to write bitstream digest to file '%s'!\n",
+                  fname.c_str());
+    return 1;
+  }
+  fp.close();
+  return 0;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,72 @@
+#ifndef BITSTREAM_DIGEST_H
+#define BITSTREAM_DIGEST_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bitstream_manager.h"
+#include "vtr_vector.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Digests of the blocks of a bitstream manager, like a Merkle tree: the
+ * digest of a block covers its name, its bits and the digests of its child
+ * blocks, so two blocks have the same digest when their subtrees are the
+ * same. The path ids and net ids, which are annotations only, are not
+ * covered */
+typedef vtr::vector<ConfigBlockId, uint64_t> BitstreamBlockDigests;
+
+/* Types of differences between two bitstreams */
+enum e_bitstream_diff_type {
+  BITSTREAM_DIFF_BITS,          /* The bits of the block differ */
+  BITSTREAM_DIFF_ONLY_IN_REF,   /* The block is missing in the current one */
+  BITSTREAM_DIFF_ONLY_IN_CURR,  /* The block is missing in the reference */
+  NUM_BITSTREAM_DIFF_TYPES
+};
+constexpr std::array<const char*, NUM_BITSTREAM_DIFF_TYPES>
+  BITSTREAM_DIFF_TYPE_STRING = {
+    {"bits", "only_in_reference", "only_in_current"}};
+
+/* A block which differs, named by its hierarchical path, e.g.,
+ * fpga_top/grid_clb_1__1_/logical_tile_clb_mode_clb__0 */
+struct BitstreamBlockDiff {
+  e_bitstream_diff_type type;
+  std::string path;
+  /* Number of bits of the block in the reference and the current bitstreams,
+   * and the number of bits which differ when both have the same length */
+  size_t num_ref_bits;
+  size_t num_curr_bits;
+  size_t num_diff_bits;
+};
+
+BitstreamBlockDigests build_bitstream_manager_block_digests(
+  const BitstreamManager& bitstream_manager);
+
+uint64_t find_bitstream_manager_digest(
+  const BitstreamManager& bitstream_manager,
+  const BitstreamBlockDigests& block_digests);
+
+std::vector<BitstreamBlockDiff> diff_bitstream_managers(
+  const BitstreamManager& ref_bitstream_manager,
+  const BitstreamBlockDigests& ref_block_digests,
+  const BitstreamManager& curr_bitstream_manager,
+  const BitstreamBlockDigests& curr_block_digests);
+
+/* Return 0 on success */
+int write_bitstream_manager_digest(const BitstreamManager& bitstream_manager,
+                                   const BitstreamBlockDigests& block_digests,
+                                   const std::string& fname);
+
+} /* end namespace openfpga */
+
+#endif
@@ -149,6 +149,28 @@ std::string BitstreamManager::block_output_net_ids(
   return block_output_net_ids_[block_id];
 }
 
+MemoryUsage BitstreamManager::memory_usage() const {
+  MemoryUsage usage("BitstreamManager");
+  MemoryUsage& blocks = usage.add_child(MemoryUsage(
+    "blocks",
+    heap_memory_usage(invalid_block_ids_) +
+      heap_memory_usage(block_bit_id_lsbs_) +
+      heap_memory_usage(block_bit_lengths_) +
+      heap_memory_usage(parent_block_ids_) +
+      heap_memory_usage(child_block_ids_) + heap_memory_usage(block_path_ids_),
+    num_blocks_));
+  blocks.add_child(container_memory_usage("names", block_names_));
+  blocks.add_child(MemoryUsage("net_ids",
+                               heap_memory_usage(block_input_net_ids_) +
+                                 heap_memory_usage(block_output_net_ids_)));
+  usage.add_child(MemoryUsage("bits",
+                              heap_memory_usage(invalid_bit_ids_) +
+                                heap_memory_usage(bit_values_) +
+                                heap_memory_usage(bit_parent_blocks_),
+                              num_bits_));
+  return usage;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
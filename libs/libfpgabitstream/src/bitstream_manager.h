@@ -43,6 +43,7 @@
 #include <vector>
 
 #include "bitstream_manager_fwd.h"
+#include "openfpga_memory_usage.h"
 #include "vtr_vector.h"
 
 /* begin namespace openfpga */
@@ -164,6 +165,8 @@ class BitstreamManager {
 
   /* Find input net ids of a block */
   std::string block_output_net_ids(const ConfigBlockId& block_id) const;
+  /* Estimate the heap memory of the bitstream, grouped by members */
+  MemoryUsage memory_usage() const;
 
  public: /* Public Mutators */
   /* Add a new configuration bit to the bitstream manager */
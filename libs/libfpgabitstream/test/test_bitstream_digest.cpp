@@ -0,0 +1,126 @@
+/********************************************************************
+ * Unit test functions to validate the digests of bitstreams
+ * 1. identical bitstreams have the same digests, regardless of the
+ *    number of threads
+ * 2. the diff reports exactly the blocks whose bits differ, and the
+ *    blocks which exist in only one bitstream
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpgautil */
+#include "openfpga_thread_pool.h"
+
+/* Headers from fpgabitstream */
+#include "bitstream_digest.h"
+
+/* Build a bitstream with a top block, a number of tiles, and two leaf
+ * blocks per tile. The bits of each leaf block come from its index */
+static openfpga::BitstreamManager build_test_bitstream(
+  const size_t& num_tiles) {
+  openfpga::BitstreamManager bitstream_manager;
+  openfpga::ConfigBlockId top_block =
+    bitstream_manager.add_block(std::string("fpga_top"));
+  for (size_t itile = 0; itile < num_tiles; ++itile) {
+    openfpga::ConfigBlockId tile_block =
+      bitstream_manager.add_block("tile_" + std::to_string(itile));
+    bitstream_manager.add_child_block(top_block, tile_block);
+    for (size_t ileaf = 0; ileaf < 2; ++ileaf) {
+      openfpga::ConfigBlockId leaf_block =
+        bitstream_manager.add_block("mem_" + std::to_string(ileaf));
+      bitstream_manager.add_child_block(tile_block, leaf_block);
+      std::vector<bool> bits;
+      for (size_t ibit = 0; ibit < 70; ++ibit) {
+        bits.push_back(0 == (itile + ileaf + ibit) % 3);
+      }
+      bitstream_manager.add_block_bits(leaf_block, bits);
+    }
+  }
+  return bitstream_manager;
+}
+
+int main(int argc, const char** argv) {
+  VTR_ASSERT(1 == argc);
+  (void)argv;
+
+  size_t num_err = 0;
+
+  openfpga::BitstreamManager ref_bitstream = build_test_bitstream(100);
+  openfpga::set_num_threads(1);
+  openfpga::BitstreamBlockDigests ref_digests =
+    openfpga::build_bitstream_manager_block_digests(ref_bitstream);
+
+  /* Identical bitstreams */
+  openfpga::set_num_threads(4);
+  openfpga::BitstreamManager same_bitstream = build_test_bitstream(100);
+  openfpga::BitstreamBlockDigests same_digests =
+    openfpga::build_bitstream_manager_block_digests(same_bitstream);
+  if (openfpga::find_bitstream_manager_digest(ref_bitstream, ref_digests) !=
+      openfpga::find_bitstream_manager_digest(same_bitstream, same_digests)) {
+    VTR_LOG_ERROR("Identical bitstreams have different digests\n");
+    num_err++;
+  }
+  if (!openfpga::diff_bitstream_managers(ref_bitstream, ref_digests,
+                                         same_bitstream, same_digests)
+         .empty()) {
+    VTR_LOG_ERROR("Found differences between identical bitstreams\n");
+    num_err++;
+  }
+
+  /* Flip one bit, and add a tile */
+  openfpga::BitstreamManager curr_bitstream = build_test_bitstream(101);
+  openfpga::ConfigBlockId flipped_block = curr_bitstream.find_child_block(
+    curr_bitstream.find_child_block(openfpga::ConfigBlockId(0),
+                                    std::string("tile_42")),
+    std::string("mem_1"));
+  openfpga::BitstreamManager edited_bitstream;
+  for (const openfpga::ConfigBlockId& block : curr_bitstream.blocks()) {
+    openfpga::ConfigBlockId new_block =
+      edited_bitstream.add_block(curr_bitstream.block_name(block));
+    VTR_ASSERT(size_t(new_block) == size_t(block));
+    if (curr_bitstream.block_parent(block)) {
+      edited_bitstream.add_child_block(curr_bitstream.block_parent(block),
+                                       new_block);
+    }
+    std::vector<bool> bits;
+    for (const openfpga::ConfigBitId& bit : curr_bitstream.block_bits(block)) {
+      bits.push_back(curr_bitstream.bit_value(bit));
+    }
+    if (block == flipped_block) {
+      bits[65] = !bits[65];
+    }
+    if (!bits.empty()) {
+      edited_bitstream.add_block_bits(new_block, bits);
+    }
+  }
+  openfpga::BitstreamBlockDigests edited_digests =
+    openfpga::build_bitstream_manager_block_digests(edited_bitstream);
+  std::vector<openfpga::BitstreamBlockDiff> diffs =
+    openfpga::diff_bitstream_managers(ref_bitstream, ref_digests,
+                                      edited_bitstream, edited_digests);
+  for (const openfpga::BitstreamBlockDiff& diff : diffs) {
+    VTR_LOG("%s %s: %lu/%lu bits, %lu differ\n",
+            openfpga::BITSTREAM_DIFF_TYPE_STRING[diff.type], diff.path.c_str(),
+            diff.num_ref_bits, diff.num_curr_bits, diff.num_diff_bits);
+  }
+  if ((2 != diffs.size()) || (openfpga::BITSTREAM_DIFF_BITS != diffs[0].type) ||
+      (std::string("fpga_top/tile_42/mem_1") != diffs[0].path) ||
+      (1 != diffs[0].num_diff_bits) ||
+      (openfpga::BITSTREAM_DIFF_ONLY_IN_CURR != diffs[1].type) ||
+      (std::string("fpga_top/tile_100") != diffs[1].path) ||
+      (140 != diffs[1].num_curr_bits)) {
+    VTR_LOG_ERROR("Unexpected differences between edited bitstreams\n");
+    num_err++;
+  }
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors\n", num_err);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests\n");
+  return 0;
+}
@@ -183,6 +183,12 @@ class Shell {
   void set_command_dependency(
     const ShellCommandId& cmd_id,
     const std::vector<ShellCommandId>& cmd_dependency);
+  /* Declare that a command restores the results of other commands, e.g.,
+   * from a checkpoint file. Once the command succeeds, the restored commands
+   * are considered as executed when checking the dependency of other commands
+   */
+  void set_command_restores(const ShellCommandId& cmd_id,
+                            const std::vector<ShellCommandId>& restored_cmds);
   ShellCommandClassId add_command_class(const char* name);
 
  public: /* Public validators */
@@ -289,6 +295,9 @@ class Shell {
   vtr::vector<ShellCommandId, std::vector<ShellCommandId>>
     command_dependencies_;
 
+  /* Commands whose results are restored by each command */
+  vtr::vector<ShellCommandId, std::vector<ShellCommandId>> command_restores_;
+
   /* Fast name look-up */
   std::map<std::string, ShellCommandId> command_name2ids_;
   std::map<std::string, ShellCommandClassId> command_class2ids_;
@@ -142,6 +142,7 @@ ShellCommandId Shell<T>::add_command(const Command& cmd, const char* descr, cons
   command_macro_execute_functions_.emplace_back();
   command_status_.push_back(CMD_EXEC_NONE); /* By default, the command should be marked as fatal error as it has been never executed */
   command_dependencies_.emplace_back();
+  command_restores_.emplace_back();
 
   /* Register the name in the name2id map */
   command_name2ids_[cmd.name()] = shell_cmd;
@@ -237,6 +238,17 @@ void Shell<T>::set_command_dependency(const ShellCommandId& cmd_id,
   command_dependencies_[cmd_id] = dependent_cmds;
 }
 
+template<class T>
+void Shell<T>::set_command_restores(const ShellCommandId& cmd_id,
+                                    const std::vector<ShellCommandId>& restored_cmds) {
+  /* Validate the command id as well as each of the restored commands */
+  VTR_ASSERT(true == valid_command_id(cmd_id));
+  for (ShellCommandId restored_cmd : restored_cmds) {
+    VTR_ASSERT(true == valid_command_id(restored_cmd));
+  }
+  command_restores_[cmd_id] = restored_cmds;
+}
+
 /* Add a command with it description */
 template<class T>
 ShellCommandClassId Shell<T>::add_command_class(const char* name) {
@@ -638,6 +650,13 @@ int Shell<T>::execute_command(const char* cmd_line,
     return CMD_EXEC_FATAL_ERROR;
   }
 
+  /* Mark the commands whose results have been restored as executed */
+  if (CMD_EXEC_SUCCESS == command_status_[cmd_id]) {
+    for (const ShellCommandId& restored_cmd : command_restores_[cmd_id]) {
+      command_status_[restored_cmd] = CMD_EXEC_SUCCESS;
+    }
+  }
+
   return command_status_[cmd_id];
 }
 
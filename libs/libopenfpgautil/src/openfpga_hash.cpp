@@ -0,0 +1,70 @@
+/********************************************************************
+ * Member functions for the stable hash, which is used to detect changes
+ * on data between runs
+ *******************************************************************/
+#include "openfpga_hash.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Parameters of the 64-bit FNV-1a hash */
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+StableHash::StableHash() : value_(FNV_OFFSET_BASIS) {}
+
+/************************************************************************
+ * Accessors
+ ***********************************************************************/
+uint64_t StableHash::value() const { return value_; }
+
+std::string StableHash::to_string() const {
+  const char* digits = "0123456789abcdef";
+  std::string str(16, '0');
+  uint64_t value = value_;
+  for (size_t idigit = 0; idigit < 16; ++idigit) {
+    str[15 - idigit] = digits[value & 0xf];
+    value >>= 4;
+  }
+  return str;
+}
+
+/************************************************************************
+ * Mutators
+ ***********************************************************************/
+void StableHash::add_bytes(const void* data, const size_t& num_bytes) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t ibyte = 0; ibyte < num_bytes; ++ibyte) {
+    value_ ^= bytes[ibyte];
+    value_ *= FNV_PRIME;
+  }
+}
+
+void StableHash::add_integer(const uint64_t& value) {
+  unsigned char bytes[8];
+  for (size_t ibyte = 0; ibyte < 8; ++ibyte) {
+    bytes[ibyte] = static_cast<unsigned char>(value >> (8 * ibyte));
+  }
+  add_bytes(bytes, 8);
+}
+
+void StableHash::add_string(const std::string& value) {
+  add_integer(value.size());
+  add_bytes(value.data(), value.size());
+}
+
+/************************************************************************
+ * Index triple hash
+ ***********************************************************************/
+size_t IndexTripleHash::operator()(
+  const std::array<size_t, 3>& indices) const {
+  size_t value = indices[0];
+  value = value * 1000003 + indices[1];
+  value = value * 1000003 + indices[2];
+  return value;
+}
+
+} /* namespace openfpga ends */
@@ -0,0 +1,54 @@
+#ifndef OPENFPGA_HASH_H
+#define OPENFPGA_HASH_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * An incremental 64-bit FNV-1a hash.
+ * Unlike std::hash, the value only depends on the data being hashed,
+ * so that it is stable across platforms and runs, and can be stored in
+ * files to detect changes between runs.
+ * It is not a cryptographic hash.
+ *******************************************************************/
+class StableHash {
+ public: /* Constructors */
+  StableHash();
+
+ public: /* Accessors */
+  uint64_t value() const;
+  /* Value as a fixed-width hexadecimal string, e.g., 00ab12cd34ef5678 */
+  std::string to_string() const;
+
+ public: /* Mutators */
+  void add_bytes(const void* data, const size_t& num_bytes);
+  /* Integers are added in little-endian order regardless of the host */
+  void add_integer(const uint64_t& value);
+  /* Strings are added with their lengths, so that the boundaries between
+   * consecutive strings are part of the hash */
+  void add_string(const std::string& value);
+
+ private: /* Internal data */
+  uint64_t value_;
+};
+
+/********************************************************************
+ * A hasher for a triple of indices, e.g., a coordinate [x][y][z], which
+ * can be used as the key of unordered containers.
+ * Unlike StableHash, the value is not meant to be stored in files
+ *******************************************************************/
+struct IndexTripleHash {
+  size_t operator()(const std::array<size_t, 3>& indices) const;
+};
+
+} /* namespace openfpga ends */
+
+#endif
@@ -0,0 +1,135 @@
+/********************************************************************
+ * This file includes functions to report the memory usage of data
+ * structures
+ *******************************************************************/
+#include "openfpga_memory_usage.h"
+
+#include <iomanip>
+#include <sstream>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+MemoryUsage::MemoryUsage(const std::string& name, const size_t& num_bytes,
+                         const size_t& num_elements)
+  : name_(name), num_bytes_(num_bytes), num_elements_(num_elements) {}
+
+/************************************************************************
+ * Accessors
+ ***********************************************************************/
+std::string MemoryUsage::name() const { return name_; }
+
+size_t MemoryUsage::num_bytes() const {
+  size_t num_bytes = num_bytes_;
+  for (const MemoryUsage& child : children_) {
+    num_bytes += child.num_bytes();
+  }
+  return num_bytes;
+}
+
+size_t MemoryUsage::num_elements() const { return num_elements_; }
+
+const std::vector<MemoryUsage>& MemoryUsage::children() const {
+  return children_;
+}
+
+/************************************************************************
+ * Mutators
+ ***********************************************************************/
+void MemoryUsage::set_name(const std::string& name) { name_ = name; }
+
+void MemoryUsage::add_bytes(const size_t& num_bytes) {
+  num_bytes_ += num_bytes;
+}
+
+void MemoryUsage::set_num_elements(const size_t& num_elements) {
+  num_elements_ = num_elements;
+}
+
+MemoryUsage& MemoryUsage::add_child(const MemoryUsage& child) {
+  children_.push_back(child);
+  return children_.back();
+}
+
+/************************************************************************
+ * Estimators of the values which are not templates
+ ***********************************************************************/
+size_t heap_memory_usage(const std::string& value) {
+  /* Short strings are stored inside the object */
+  if (value.capacity() <= std::string().capacity()) {
+    return 0;
+  }
+  return value.capacity() + 1;
+}
+
+size_t heap_memory_usage(const BasicPort& value) {
+  return heap_memory_usage(value.get_name());
+}
+
+/************************************************************************
+ * Writers
+ ***********************************************************************/
+/* Convert a number of bytes to a human-readable string, e.g., 1.50 MiB */
+static std::string format_memory_size(const size_t& num_bytes) {
+  const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  double size = num_bytes;
+  size_t iunit = 0;
+  while ((1024. <= size) && (iunit < 4)) {
+    size /= 1024.;
+    iunit++;
+  }
+  std::ostringstream ss;
+  if (0 == iunit) {
+    ss << num_bytes << " " << units[iunit];
+  } else {
+    ss << std::fixed << std::setprecision(2) << size << " " << units[iunit];
+  }
+  return ss.str();
+}
+
+static void rec_print_memory_usage_text(std::ostream& os,
+                                        const MemoryUsage& usage,
+                                        const size_t& depth) {
+  os << std::string(2 * depth, ' ') << usage.name() << ": "
+     << format_memory_size(usage.num_bytes());
+  if (0 < usage.num_elements()) {
+    os << " (" << usage.num_elements() << " elements)";
+  }
+  os << "\n";
+  for (const MemoryUsage& child : usage.children()) {
+    rec_print_memory_usage_text(os, child, depth + 1);
+  }
+}
+
+void print_memory_usage_text(std::ostream& os, const MemoryUsage& usage) {
+  rec_print_memory_usage_text(os, usage, 0);
+}
+
+static void rec_print_memory_usage_json(std::ostream& os,
+                                        const MemoryUsage& usage,
+                                        const size_t& depth) {
+  std::string indent(2 * depth, ' ');
+  /* Names are identifiers of data structures, which need no escaping */
+  os << indent << "{\"name\": \"" << usage.name() << "\", "
+     << "\"bytes\": " << usage.num_bytes() << ", "
+     << "\"elements\": " << usage.num_elements();
+  if (!usage.children().empty()) {
+    os << ", \"children\": [\n";
+    for (size_t ichild = 0; ichild < usage.children().size(); ++ichild) {
+      rec_print_memory_usage_json(os, usage.children()[ichild], depth + 1);
+      os << (ichild + 1 < usage.children().size() ? ",\n" : "\n");
+    }
+    os << indent << "]";
+  }
+  os << "}";
+}
+
+void print_memory_usage_json(std::ostream& os, const MemoryUsage& usage) {
+  rec_print_memory_usage_json(os, usage, 0);
+  os << "\n";
+}
+
+} /* namespace openfpga ends */
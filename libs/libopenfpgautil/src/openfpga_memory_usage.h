@@ -0,0 +1,194 @@
+#ifndef OPENFPGA_MEMORY_USAGE_H
+#define OPENFPGA_MEMORY_USAGE_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <array>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "openfpga_port.h"
+#include "vtr_vector.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A report on the memory usage of a data structure, which is organized
+ * as a tree: each node includes the estimated heap bytes and the number
+ * of elements of a member, while the members of a member are children.
+ *
+ * The sizes are estimated from the capacity of the containers, with a
+ * typical overhead of the nodes of node-based containers, e.g., std::map.
+ * They are not the exact bytes allocated by the allocator, but are good
+ * enough to spot the members which dominate the memory footprint.
+ *******************************************************************/
+class MemoryUsage {
+ public: /* Constructors */
+  MemoryUsage(const std::string& name = std::string(),
+              const size_t& num_bytes = 0, const size_t& num_elements = 0);
+
+ public: /* Accessors */
+  std::string name() const;
+  /* Number of bytes, including those of all the children */
+  size_t num_bytes() const;
+  size_t num_elements() const;
+  const std::vector<MemoryUsage>& children() const;
+
+ public: /* Mutators */
+  void set_name(const std::string& name);
+  void add_bytes(const size_t& num_bytes);
+  void set_num_elements(const size_t& num_elements);
+  /* Add a child and return it, so that its members can be added */
+  MemoryUsage& add_child(const MemoryUsage& child);
+
+ private: /* Internal data */
+  std::string name_;
+  /* Number of bytes which are not accounted by any child */
+  size_t num_bytes_;
+  size_t num_elements_;
+  std::vector<MemoryUsage> children_;
+};
+
+/* Output a report as an indented tree, with human-readable sizes */
+void print_memory_usage_text(std::ostream& os, const MemoryUsage& usage);
+
+/* Output a report as a JSON object, with sizes in bytes */
+void print_memory_usage_json(std::ostream& os, const MemoryUsage& usage);
+
+/********************************************************************
+ * Estimate the heap bytes owned by a value, excluding the bytes of the
+ * value itself, which are accounted by its owner.
+ * Values without any heap memory, e.g., numbers and ids, are covered by
+ * the generic template. The overloads for containers are declared before
+ * any definition, so that nested containers are resolved properly.
+ *******************************************************************/
+template <typename T>
+size_t heap_memory_usage(const T& value);
+size_t heap_memory_usage(const std::string& value);
+size_t heap_memory_usage(const BasicPort& value);
+template <typename T, typename A>
+size_t heap_memory_usage(const std::vector<T, A>& value);
+template <typename A>
+size_t heap_memory_usage(const std::vector<bool, A>& value);
+template <typename K, typename V>
+size_t heap_memory_usage(const vtr::vector<K, V>& value);
+template <typename T, size_t N>
+size_t heap_memory_usage(const std::array<T, N>& value);
+template <typename T1, typename T2>
+size_t heap_memory_usage(const std::pair<T1, T2>& value);
+template <typename K, typename V, typename C, typename A>
+size_t heap_memory_usage(const std::map<K, V, C, A>& value);
+template <typename K, typename C, typename A>
+size_t heap_memory_usage(const std::set<K, C, A>& value);
+template <typename K, typename V, typename H, typename E, typename A>
+size_t heap_memory_usage(const std::unordered_map<K, V, H, E, A>& value);
+template <typename K, typename H, typename E, typename A>
+size_t heap_memory_usage(const std::unordered_set<K, H, E, A>& value);
+
+/* Typical bookkeeping bytes of a node in node-based containers */
+constexpr size_t TREE_NODE_OVERHEAD_BYTES = 4 * sizeof(void*);
+constexpr size_t HASH_NODE_OVERHEAD_BYTES = sizeof(void*) + sizeof(size_t);
+
+template <typename T>
+size_t heap_memory_usage(const T& /*value*/) {
+  return 0;
+}
+
+template <typename T, typename A>
+size_t heap_memory_usage(const std::vector<T, A>& value) {
+  size_t num_bytes = value.capacity() * sizeof(T);
+  for (const T& elem : value) {
+    num_bytes += heap_memory_usage(elem);
+  }
+  return num_bytes;
+}
+
+template <typename A>
+size_t heap_memory_usage(const std::vector<bool, A>& value) {
+  return value.capacity() / 8;
+}
+
+template <typename K, typename V>
+size_t heap_memory_usage(const vtr::vector<K, V>& value) {
+  size_t num_bytes = value.capacity() * sizeof(V);
+  for (const auto& elem : value) {
+    num_bytes += heap_memory_usage(elem);
+  }
+  return num_bytes;
+}
+
+template <typename T, size_t N>
+size_t heap_memory_usage(const std::array<T, N>& value) {
+  size_t num_bytes = 0;
+  for (const T& elem : value) {
+    num_bytes += heap_memory_usage(elem);
+  }
+  return num_bytes;
+}
+
+template <typename T1, typename T2>
+size_t heap_memory_usage(const std::pair<T1, T2>& value) {
+  return heap_memory_usage(value.first) + heap_memory_usage(value.second);
+}
+
+template <typename K, typename V, typename C, typename A>
+size_t heap_memory_usage(const std::map<K, V, C, A>& value) {
+  size_t num_bytes = value.size() * (sizeof(std::pair<const K, V>) +
+                                     TREE_NODE_OVERHEAD_BYTES);
+  for (const auto& elem : value) {
+    num_bytes += heap_memory_usage(elem.first) + heap_memory_usage(elem.second);
+  }
+  return num_bytes;
+}
+
+template <typename K, typename C, typename A>
+size_t heap_memory_usage(const std::set<K, C, A>& value) {
+  size_t num_bytes = value.size() * (sizeof(K) + TREE_NODE_OVERHEAD_BYTES);
+  for (const K& elem : value) {
+    num_bytes += heap_memory_usage(elem);
+  }
+  return num_bytes;
+}
+
+template <typename K, typename V, typename H, typename E, typename A>
+size_t heap_memory_usage(const std::unordered_map<K, V, H, E, A>& value) {
+  size_t num_bytes = value.bucket_count() * sizeof(void*) +
+                     value.size() * (sizeof(std::pair<const K, V>) +
+                                     HASH_NODE_OVERHEAD_BYTES);
+  for (const auto& elem : value) {
+    num_bytes += heap_memory_usage(elem.first) + heap_memory_usage(elem.second);
+  }
+  return num_bytes;
+}
+
+template <typename K, typename H, typename E, typename A>
+size_t heap_memory_usage(const std::unordered_set<K, H, E, A>& value) {
+  size_t num_bytes = value.bucket_count() * sizeof(void*) +
+                     value.size() * (sizeof(K) + HASH_NODE_OVERHEAD_BYTES);
+  for (const K& elem : value) {
+    num_bytes += heap_memory_usage(elem);
+  }
+  return num_bytes;
+}
+
+/********************************************************************
+ * Create a report node for a member container, whose number of elements
+ * is the size of the container
+ *******************************************************************/
+template <typename C>
+MemoryUsage container_memory_usage(const std::string& name,
+                                   const C& container) {
+  return MemoryUsage(name, heap_memory_usage(container), container.size());
+}
+
+} /* namespace openfpga ends */
+
+#endif
@@ -0,0 +1,70 @@
+/************************************************************************
+ * Member functions for NamePool class
+ ***********************************************************************/
+#include "openfpga_name_pool.h"
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * Accessors
+ ***********************************************************************/
+NameId NamePool::find(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto result = name_ids_.find(name);
+  if (result == name_ids_.end()) {
+    return NameId::INVALID();
+  }
+  return result->second;
+}
+
+const std::string& NamePool::name(const NameId& name_id) const {
+  static const std::string empty_name;
+  if (NameId::INVALID() == name_id) {
+    return empty_name;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  VTR_ASSERT(size_t(name_id) < names_.size());
+  return *names_[size_t(name_id)];
+}
+
+size_t NamePool::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return names_.size();
+}
+
+MemoryUsage NamePool::memory_usage() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return MemoryUsage("NamePool",
+                     heap_memory_usage(name_ids_) + heap_memory_usage(names_),
+                     names_.size());
+}
+
+/************************************************************************
+ * Mutators
+ ***********************************************************************/
+NameId NamePool::intern(const std::string& name) {
+  /* The empty name is not stored */
+  if (name.empty()) {
+    return NameId::INVALID();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto result = name_ids_.emplace(name, NameId(names_.size()));
+  if (true == result.second) {
+    names_.push_back(&result.first->first);
+  }
+  return result.first->second;
+}
+
+/************************************************************************
+ * Global pool
+ ***********************************************************************/
+NamePool& global_name_pool() {
+  static NamePool pool;
+  return pool;
+}
+
+} /* namespace openfpga ends */
@@ -0,0 +1,63 @@
+#ifndef OPENFPGA_NAME_POOL_H
+#define OPENFPGA_NAME_POOL_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openfpga_memory_usage.h"
+#include "vtr_strong_id.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+struct name_id_tag;
+
+/* A handle of a name which is interned in a NamePool */
+typedef vtr::StrongId<name_id_tag> NameId;
+
+/********************************************************************
+ * A pool of interned names
+ * Each distinct name is stored only once and is identified by a NameId,
+ * so that names which are used many times (e.g., module, instance and
+ * net names of a fabric) can be kept and compared as integers.
+ *
+ * The empty name is never stored and is always identified by
+ * NameId::INVALID(), which is the default value of a NameId
+ *
+ * A name is never removed from a pool, so that references to
+ * interned names remain valid as long as the pool.
+ * All the member functions are thread-safe
+ *******************************************************************/
+class NamePool {
+ public: /* Accessors */
+  /* Find the id of a name, return an invalid id if not interned */
+  NameId find(const std::string& name) const;
+  /* Get the name of an id. An empty name is returned for an invalid id */
+  const std::string& name(const NameId& name_id) const;
+  /* Number of names in the pool */
+  size_t size() const;
+  /* Estimate the heap memory of the pool */
+  MemoryUsage memory_usage() const;
+
+ public: /* Mutators */
+  /* Find the id of a name, intern the name if not found */
+  NameId intern(const std::string& name);
+
+ private: /* Internal data */
+  mutable std::mutex mutex_;
+  /* Names are stored as the keys of the map, whose addresses are stable */
+  std::unordered_map<std::string, NameId> name_ids_;
+  std::vector<const std::string*> names_;
+};
+
+/* The pool which is shared by all the naming functions */
+NamePool& global_name_pool();
+
+} /* namespace openfpga ends */
+
+#endif
@@ -4,6 +4,7 @@
 /********************************************************************
  * Include header files that are required by data structure declaration
  *******************************************************************/
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -105,4 +106,22 @@ class ConfPorts {
 
 }  // namespace openfpga
 
+/********************************************************************
+ * Hash function of BasicPort, consistent with BasicPort::operator==
+ * so that ports can be used as keys of unordered containers
+ *******************************************************************/
+namespace std {
+template <>
+struct hash<openfpga::BasicPort> {
+  std::size_t operator()(const openfpga::BasicPort& port) const {
+    std::size_t seed = std::hash<std::string>()(port.get_name());
+    seed ^= std::hash<size_t>()(port.get_lsb()) + 0x9e3779b9 + (seed << 6) +
+            (seed >> 2);
+    seed ^= std::hash<size_t>()(port.get_msb()) + 0x9e3779b9 + (seed << 6) +
+            (seed >> 2);
+    return seed;
+  }
+};
+}  // namespace std
+
 #endif
@@ -26,6 +26,15 @@ constexpr const char* WL_SHIFT_REGISTER_CHAIN_TAIL_NAME = "wl_sr_tail";
 constexpr const char* WL_SHIFT_REGISTER_CHAIN_WL_OUT_NAME = "wl_sr_wl_out";
 constexpr const char* WL_SHIFT_REGISTER_CHAIN_WLR_OUT_NAME = "wl_sr_wlr_out";
 
+/* Run-length decompressor at the head of configuration chains */
+constexpr const char* CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME =
+  "config_chain_rle_decompressor";
+constexpr const char* CONFIG_CHAIN_RLE_LOAD_PORT_NAME = "ccff_rle_load";
+constexpr const char* CONFIG_CHAIN_RLE_COUNT_PORT_NAME = "ccff_rle_count";
+constexpr const char* CONFIG_CHAIN_RLE_READY_PORT_NAME = "ccff_rle_ready";
+constexpr const char* CONFIG_CHAIN_RLE_DECOMPRESSOR_INSTANCE_PREFIX =
+  "ccff_rle_decompressor_";
+
 /* IO PORT */
 /* Prefix of global input, output and inout ports of FPGA fabric */
 constexpr const char* GIO_INOUT_PREFIX = "gfpga_pad_";
@@ -52,6 +61,7 @@ constexpr const char* CONNECTION_BLOCK_MUX_INSTANCE_PREFIX = "mux_";
 /* Decoder naming constant strings */
 constexpr const char* DECODER_ENABLE_PORT_NAME = "enable";
 constexpr const char* DECODER_ADDRESS_PORT_NAME = "address";
+constexpr const char* DECODER_ADDRESS_MASK_PORT_NAME = "address_mask";
 constexpr const char* DECODER_DATA_IN_PORT_NAME = "data_in";
 constexpr const char* DECODER_DATA_OUT_PORT_NAME = "data_out";
 constexpr const char* DECODER_DATA_OUT_INV_PORT_NAME = "data_out_inv";
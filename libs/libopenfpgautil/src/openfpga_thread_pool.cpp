@@ -0,0 +1,260 @@
+/********************************************************************
+ * Member functions of the thread pool and the configuration of the pool
+ * shared by all the algorithms
+ *******************************************************************/
+#include "openfpga_thread_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "vtr_log.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Set on the threads which are running the tasks of a pool, so that nested
+ * runs are executed sequentially instead of waiting for busy workers */
+static thread_local bool in_parallel_region = false;
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+ThreadPool::ThreadPool(const size_t& num_threads)
+  : generation_(0),
+    num_busy_workers_(0),
+    stop_(false),
+    task_(nullptr),
+    cancelled_(false) {
+  size_t num_ranges = std::max(size_t(1), num_threads);
+  for (size_t irange = 0; irange < num_ranges; ++irange) {
+    ranges_.emplace_back(new TaskRange());
+  }
+  /* The calling thread of run() works as thread 0 */
+  for (size_t ithread = 1; ithread < num_ranges; ++ithread) {
+    workers_.emplace_back(&ThreadPool::worker_loop, this, ithread);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    stop_ = true;
+  }
+  start_cv_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+/************************************************************************
+ * Accessors
+ ***********************************************************************/
+size_t ThreadPool::num_threads() const { return ranges_.size(); }
+
+/************************************************************************
+ * Executors
+ ***********************************************************************/
+void ThreadPool::run(const size_t& num_tasks,
+                     const std::function<void(const size_t&)>& task) {
+  if (0 == num_tasks) {
+    return;
+  }
+
+  /* Nothing to share: run the tasks in order on the current thread */
+  if (workers_.empty() || 1 == num_tasks || in_parallel_region) {
+    bool was_in_parallel_region = in_parallel_region;
+    in_parallel_region = true;
+    try {
+      for (size_t itask = 0; itask < num_tasks; ++itask) {
+        task(itask);
+      }
+    } catch (...) {
+      in_parallel_region = was_in_parallel_region;
+      throw;
+    }
+    in_parallel_region = was_in_parallel_region;
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+  /* Give each thread a contiguous range of tasks */
+  for (size_t irange = 0; irange < ranges_.size(); ++irange) {
+    std::lock_guard<std::mutex> range_lock(ranges_[irange]->mutex);
+    ranges_[irange]->begin = num_tasks * irange / ranges_.size();
+    ranges_[irange]->end = num_tasks * (irange + 1) / ranges_.size();
+  }
+
+  /* Wake up the workers */
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    task_ = &task;
+    exception_ = nullptr;
+    cancelled_ = false;
+    num_busy_workers_ = workers_.size();
+    ++generation_;
+  }
+  start_cv_.notify_all();
+
+  /* The current thread works as well */
+  run_tasks(0);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    done_cv_.wait(lock, [this]() { return 0 == num_busy_workers_; });
+    task_ = nullptr;
+    std::swap(exception, exception_);
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+/************************************************************************
+ * Internal executors
+ ***********************************************************************/
+void ThreadPool::worker_loop(const size_t& ithread) {
+  size_t finished_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      start_cv_.wait(lock, [&]() {
+        return stop_ || finished_generation != generation_;
+      });
+      if (stop_) {
+        return;
+      }
+      finished_generation = generation_;
+    }
+
+    run_tasks(ithread);
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      --num_busy_workers_;
+      if (0 == num_busy_workers_) {
+        done_cv_.notify_one();
+      }
+    }
+  }
+}
+
+void ThreadPool::run_tasks(const size_t& ithread) {
+  bool was_in_parallel_region = in_parallel_region;
+  in_parallel_region = true;
+
+  size_t itask = 0;
+  while (!cancelled_) {
+    if (false == pop_task(ithread, itask)) {
+      if (false == steal_tasks(ithread)) {
+        break;
+      }
+      continue;
+    }
+    try {
+      (*task_)(itask);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+      cancelled_ = true;
+    }
+  }
+
+  in_parallel_region = was_in_parallel_region;
+}
+
+bool ThreadPool::pop_task(const size_t& ithread, size_t& task) {
+  TaskRange& range = *ranges_[ithread];
+  std::lock_guard<std::mutex> lock(range.mutex);
+  if (range.begin == range.end) {
+    return false;
+  }
+  task = range.begin++;
+  return true;
+}
+
+/* Move the second half of the tasks left to another thread to the range of
+ * the given thread, which must be empty. Return false if there is nothing
+ * left to steal. Only one range is locked at a time, so threads stealing
+ * from each other never deadlock */
+bool ThreadPool::steal_tasks(const size_t& ithread) {
+  for (size_t offset = 1; offset < ranges_.size(); ++offset) {
+    TaskRange& victim = *ranges_[(ithread + offset) % ranges_.size()];
+    size_t stolen_begin = 0;
+    size_t stolen_end = 0;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      size_t num_left = victim.end - victim.begin;
+      if (0 == num_left) {
+        continue;
+      }
+      stolen_end = victim.end;
+      stolen_begin = victim.end - (num_left + 1) / 2;
+      victim.end = stolen_begin;
+    }
+    TaskRange& range = *ranges_[ithread];
+    std::lock_guard<std::mutex> lock(range.mutex);
+    range.begin = stolen_begin;
+    range.end = stolen_end;
+    return true;
+  }
+  return false;
+}
+
+/************************************************************************
+ * Configuration of the shared pool
+ ***********************************************************************/
+static std::mutex shared_pool_mutex;
+static size_t shared_num_threads = 0;
+static std::unique_ptr<ThreadPool> shared_pool;
+
+static size_t default_num_threads() {
+  const char* env_value = std::getenv(OPENFPGA_NUM_THREADS_ENV_VAR);
+  if (nullptr != env_value) {
+    char* env_end = nullptr;
+    long num_threads = std::strtol(env_value, &env_end, 10);
+    if ((env_end != env_value) && ('\0' == *env_end) && (0 < num_threads)) {
+      return size_t(num_threads);
+    }
+    VTR_LOG_WARN(
+      "Ignore invalid number of threads '%s' in environment variable '%s'!\n",
+      env_value, OPENFPGA_NUM_THREADS_ENV_VAR);
+  }
+  return std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+}
+
+/* Must be called with the lock of the shared pool */
+static size_t shared_num_threads_locked() {
+  if (0 == shared_num_threads) {
+    shared_num_threads = default_num_threads();
+  }
+  return shared_num_threads;
+}
+
+size_t num_threads() {
+  std::lock_guard<std::mutex> lock(shared_pool_mutex);
+  return shared_num_threads_locked();
+}
+
+void set_num_threads(const size_t& num_threads) {
+  std::lock_guard<std::mutex> lock(shared_pool_mutex);
+  shared_num_threads = num_threads;
+  /* The pool is created again on next use, when the size changes */
+  if (shared_pool &&
+      shared_pool->num_threads() != shared_num_threads_locked()) {
+    shared_pool.reset();
+  }
+}
+
+ThreadPool& shared_thread_pool() {
+  std::lock_guard<std::mutex> lock(shared_pool_mutex);
+  if (!shared_pool) {
+    shared_pool.reset(new ThreadPool(shared_num_threads_locked()));
+  }
+  return *shared_pool;
+}
+
+} /* namespace openfpga ends */
@@ -0,0 +1,152 @@
+#ifndef OPENFPGA_THREAD_POOL_H
+#define OPENFPGA_THREAD_POOL_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Environment variable to set the number of threads, which is overridden by
+ * the '--threads' option of the shell */
+constexpr const char* OPENFPGA_NUM_THREADS_ENV_VAR = "OPENFPGA_NUM_THREADS";
+
+/********************************************************************
+ * A pool of worker threads, which runs a number of independent tasks,
+ * each identified by an index.
+ *
+ * The indices are split into one contiguous range per thread, so that
+ * neighbouring tasks, which usually touch neighbouring data, run on the
+ * same thread. A thread which finishes its own range steals half of the
+ * remaining range of another thread.
+ *
+ * Notes:
+ * - The calling thread works as one of the threads, so a pool of one
+ *   thread has no worker and runs the tasks in order
+ * - A nested run() from inside a task runs sequentially on the current
+ *   thread, so loops can be parallelized without knowing their callers
+ * - If any task throws, no more tasks are started and the first exception
+ *   is rethrown to the caller of run()
+ * - The order in which tasks run is not deterministic. Tasks should write
+ *   their results to a slot owned by their index, and should not call
+ *   VTR_LOG, which is not thread-safe. See parallel_map_reduce() which
+ *   merges the results (and logs) on the calling thread in order
+ *******************************************************************/
+class ThreadPool {
+ public: /* Constructors */
+  explicit ThreadPool(const size_t& num_threads);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+ public: /* Accessors */
+  /* Number of threads, including the calling thread */
+  size_t num_threads() const;
+
+ public: /* Executors */
+  /* Run task(0) ... task(num_tasks - 1) and wait until all are done */
+  void run(const size_t& num_tasks,
+           const std::function<void(const size_t&)>& task);
+
+ private: /* Internal executors */
+  /* A range of tasks owned by a thread, which can be stolen by others */
+  struct TaskRange {
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+  };
+
+  void worker_loop(const size_t& ithread);
+  void run_tasks(const size_t& ithread);
+  bool pop_task(const size_t& ithread, size_t& task);
+  bool steal_tasks(const size_t& ithread);
+
+ private: /* Internal data */
+  std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<TaskRange>> ranges_;
+
+  /* Only one run() at a time */
+  std::mutex run_mutex_;
+
+  /* Synchronization between the caller of run() and the workers */
+  std::mutex state_mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  size_t generation_;
+  size_t num_busy_workers_;
+  bool stop_;
+
+  /* The current job */
+  const std::function<void(const size_t&)>* task_;
+  std::exception_ptr exception_;
+  std::atomic<bool> cancelled_;
+};
+
+/********************************************************************
+ * Configuration of the shared pool
+ *******************************************************************/
+/* Number of threads used by the shared pool. Unless set explicitly, it is
+ * taken from the environment variable, or the number of hardware threads */
+size_t num_threads();
+
+/* Set the number of threads of the shared pool. Zero restores the default.
+ * Must not be called while the shared pool is running tasks */
+void set_num_threads(const size_t& num_threads);
+
+/* The pool shared by all the algorithms, created on first use */
+ThreadPool& shared_thread_pool();
+
+/********************************************************************
+ * Run task(index) for each index in [begin, end) on the shared pool
+ *******************************************************************/
+template <typename Task>
+void parallel_for(const size_t& begin, const size_t& end, const Task& task) {
+  if (end <= begin) {
+    return;
+  }
+  shared_thread_pool().run(
+    end - begin, [&](const size_t& offset) { task(begin + offset); });
+}
+
+/********************************************************************
+ * Compute map(index) for each index in [begin, end) on the shared pool,
+ * then fold the results on the calling thread in the order of indices:
+ *   result = reduce(...reduce(reduce(init, map(begin)), map(begin + 1))...)
+ * The result is the same as a sequential loop regardless of the number of
+ * threads, and the reduction may safely call VTR_LOG.
+ * The result of map() must be default-constructible and movable.
+ *******************************************************************/
+template <typename Result, typename Map, typename Reduce>
+Result parallel_map_reduce(const size_t& begin, const size_t& end, Result init,
+                           const Map& map, const Reduce& reduce) {
+  typedef typename std::decay<decltype(map(begin))>::type MapResult;
+  /* Wrap the results, so that even std::vector<bool> has one object per
+   * index, which can be written by different threads */
+  struct MapSlot {
+    MapResult value;
+  };
+  std::vector<MapSlot> slots(end <= begin ? 0 : end - begin);
+  parallel_for(begin, end, [&](const size_t& index) {
+    slots[index - begin].value = map(index);
+  });
+  for (MapSlot& slot : slots) {
+    init = reduce(std::move(init), std::move(slot.value));
+  }
+  return init;
+}
+
+} /* namespace openfpga ends */
+
+#endif
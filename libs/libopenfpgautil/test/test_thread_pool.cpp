@@ -0,0 +1,159 @@
+/********************************************************************
+ * Unit test and benchmark of the thread pool
+ * 1. each task runs exactly once, for any number of threads and tasks
+ * 2. the results of parallel_map_reduce() do not depend on the number
+ *    of threads
+ * 3. exceptions thrown by tasks are rethrown to the caller
+ * 4. nested parallel loops are run without deadlock
+ * 5. the time of an unbalanced loop with 1 thread and with all threads
+ *******************************************************************/
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil */
+#include "openfpga_thread_pool.h"
+
+/* A task whose cost grows with its index, so that the ranges given to the
+ * threads are unbalanced and have to be stolen */
+static size_t unbalanced_task(const size_t& index) {
+  size_t value = index;
+  for (size_t iter = 0; iter < index % 1024; ++iter) {
+    value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+  }
+  return value;
+}
+
+static size_t test_run_once(const size_t& num_threads,
+                            const size_t& num_tasks) {
+  openfpga::ThreadPool pool(num_threads);
+  std::vector<std::atomic<size_t>> counts(num_tasks);
+  for (std::atomic<size_t>& count : counts) {
+    count = 0;
+  }
+  pool.run(num_tasks, [&](const size_t& itask) { counts[itask]++; });
+  size_t num_err = 0;
+  for (size_t itask = 0; itask < num_tasks; ++itask) {
+    if (1 != counts[itask]) {
+      VTR_LOG_ERROR("Task %lu of %lu ran %lu times with %lu threads\n", itask,
+                    num_tasks, size_t(counts[itask]), num_threads);
+      num_err++;
+    }
+  }
+  return num_err;
+}
+
+static std::string map_reduce_trace(const size_t& num_tasks) {
+  return openfpga::parallel_map_reduce(
+    0, num_tasks, std::string(),
+    [](const size_t& index) { return std::to_string(unbalanced_task(index)); },
+    [](std::string trace, std::string value) {
+      return trace + value + std::string(",");
+    });
+}
+
+static size_t test_exception(const size_t& num_threads) {
+  openfpga::ThreadPool pool(num_threads);
+  try {
+    pool.run(1000, [](const size_t& itask) {
+      if (500 == itask) {
+        throw std::runtime_error("expected");
+      }
+    });
+  } catch (const std::runtime_error&) {
+    /* The pool is still usable after an exception */
+    return test_run_once(num_threads, 100);
+  }
+  VTR_LOG_ERROR("Exception of a task is not rethrown with %lu threads\n",
+                num_threads);
+  return 1;
+}
+
+static size_t test_nested_loops() {
+  std::vector<size_t> sums(64, 0);
+  openfpga::parallel_for(0, sums.size(), [&](const size_t& outer) {
+    sums[outer] = openfpga::parallel_map_reduce(
+      0, outer, size_t(0), [](const size_t& inner) { return inner; },
+      [](const size_t& sum, const size_t& inner) { return sum + inner; });
+  });
+  size_t num_err = 0;
+  for (size_t outer = 0; outer < sums.size(); ++outer) {
+    if (outer * (outer - 1) / 2 != sums[outer]) {
+      VTR_LOG_ERROR("Nested loop %lu has a wrong sum %lu\n", outer,
+                    sums[outer]);
+      num_err++;
+    }
+  }
+  return num_err;
+}
+
+static double benchmark_unbalanced_loop(const size_t& num_tasks,
+                                        std::vector<size_t>& results) {
+  vtr::Timer timer;
+  results.assign(num_tasks, 0);
+  openfpga::parallel_for(0, num_tasks, [&](const size_t& index) {
+    results[index] = unbalanced_task(index);
+  });
+  return timer.elapsed_sec();
+}
+
+int main(int argc, const char** argv) {
+  /* Optional argument: <num_tasks> of the benchmark */
+  VTR_ASSERT((1 == argc) || (2 == argc));
+  size_t num_bench_tasks = 1000000;
+  if (2 == argc) {
+    num_bench_tasks = std::stoul(argv[1]);
+  }
+
+  size_t num_err = 0;
+  for (size_t num_threads : {1, 2, 3, 8}) {
+    for (size_t num_tasks : {0, 1, 2, 7, 1000}) {
+      num_err += test_run_once(num_threads, num_tasks);
+    }
+    num_err += test_exception(num_threads);
+  }
+
+  openfpga::set_num_threads(1);
+  std::string sequential_trace = map_reduce_trace(1000);
+  for (size_t num_threads : {2, 3, 8}) {
+    openfpga::set_num_threads(num_threads);
+    if (sequential_trace != map_reduce_trace(1000)) {
+      VTR_LOG_ERROR("Results of map-reduce differ with %lu threads\n",
+                    num_threads);
+      num_err++;
+    }
+    num_err += test_nested_loops();
+  }
+
+  /* Benchmark */
+  std::vector<size_t> sequential_results;
+  std::vector<size_t> parallel_results;
+  openfpga::set_num_threads(1);
+  double sequential_time =
+    benchmark_unbalanced_loop(num_bench_tasks, sequential_results);
+  openfpga::set_num_threads(0);
+  double parallel_time =
+    benchmark_unbalanced_loop(num_bench_tasks, parallel_results);
+  if (sequential_results != parallel_results) {
+    VTR_LOG_ERROR("Results of the benchmark differ with %lu threads\n",
+                  openfpga::num_threads());
+    num_err++;
+  }
+  VTR_LOG("Ran %lu unbalanced tasks in %g s with 1 thread and %g s with %lu "
+          "threads\n",
+          num_bench_tasks, sequential_time, parallel_time,
+          openfpga::num_threads());
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors\n", num_err);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests\n");
+  return 0;
+}
@@ -41,36 +41,45 @@ size_t IoLocationMap::io_index(const size_t& x, const size_t& y,
 }
 
 size_t IoLocationMap::io_x(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[0];
-      }
-    }
+  auto result = io_coordinates_.find(io_port);
+  if (result == io_coordinates_.end()) {
+    return size_t(-1);
   }
-  return size_t(-1);
+  return result->second[0];
 }
 
 size_t IoLocationMap::io_y(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[1];
-      }
-    }
+  auto result = io_coordinates_.find(io_port);
+  if (result == io_coordinates_.end()) {
+    return size_t(-1);
   }
-  return size_t(-1);
+  return result->second[1];
 }
 
 size_t IoLocationMap::io_z(const BasicPort& io_port) const {
-  for (auto pair : io_indices_) {
-    for (const BasicPort& candidate : pair.second) {
-      if (candidate == io_port) {
-        return pair.first[2];
-      }
-    }
+  auto result = io_coordinates_.find(io_port);
+  if (result == io_coordinates_.end()) {
+    return size_t(-1);
   }
-  return size_t(-1);
+  return result->second[2];
+}
+
+std::vector<std::array<size_t, 3>> IoLocationMap::io_coordinates() const {
+  std::vector<std::array<size_t, 3>> coords;
+  coords.reserve(io_indices_.size());
+  for (const auto& pair : io_indices_) {
+    coords.push_back(pair.first);
+  }
+  return coords;
+}
+
+std::vector<BasicPort> IoLocationMap::io_ports(
+  const std::array<size_t, 3>& coord) const {
+  auto result = io_indices_.find(coord);
+  if (result == io_indices_.end()) {
+    return std::vector<BasicPort>();
+  }
+  return result->second;
 }
 
 void IoLocationMap::set_io_index(const size_t& x, const size_t& y,
@@ -92,6 +101,13 @@ void IoLocationMap::set_io_index(const size_t& x, const size_t& y,
   }
 
   io_indices_[coord].push_back(port_to_add);
+
+  /* Update the reversed lookup. Keep the smallest coordinate when the I/O has
+   * been assigned before */
+  auto coord_result = io_coordinates_.emplace(port_to_add, coord);
+  if (!coord_result.second && coord < coord_result.first->second) {
+    coord_result.first->second = coord;
+  }
 }
 
 int IoLocationMap::write_to_xml_file(const std::string& fname,
@@ -9,6 +9,7 @@
 #include <array>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "openfpga_port.h"
@@ -39,6 +40,10 @@ class IoLocationMap {
   size_t io_x(const BasicPort& io_port) const;
   size_t io_y(const BasicPort& io_port) const;
   size_t io_z(const BasicPort& io_port) const;
+  /* Coordinates which have I/Os, in the order of [x][y][z] */
+  std::vector<std::array<size_t, 3>> io_coordinates() const;
+  /* I/Os at a coordinate, in the order of assignment */
+  std::vector<BasicPort> io_ports(const std::array<size_t, 3>& coord) const;
 
  public: /* Public mutators */
   void set_io_index(const size_t& x, const size_t& y, const size_t& z,
@@ -54,6 +59,12 @@ class IoLocationMap {
    * Note that multiple I/Os may be assigned to the same coordinate!
    */
   std::map<std::array<size_t, 3>, std::vector<BasicPort>> io_indices_;
+
+  /* Reversed fast lookup: [io_port] -> [x][y][z] location
+   * When an I/O is assigned to multiple coordinates, the smallest coordinate
+   * is kept, which is consistent with the ordered walk through io_indices_
+   */
+  std::unordered_map<BasicPort, std::array<size_t, 3>> io_coordinates_;
 };
 
 } /* End namespace openfpga*/
@@ -54,14 +54,15 @@ IoPinTable::e_io_direction IoPinTable::pin_direction(
 
 std::vector<IoPinTableId> IoPinTable::find_internal_pin(
   const BasicPort& ext_pin, const e_io_direction& pin_direction) const {
-  std::vector<IoPinTableId> int_pin_ids;
-  for (auto pin_id : pin_ids_) {
-    if ((external_pins_[pin_id] == ext_pin) &&
-        (pin_directions_[pin_id] == pin_direction)) {
-      int_pin_ids.push_back(pin_id);
-    }
+  if (NUM_IO_DIRECTIONS == pin_direction) {
+    return std::vector<IoPinTableId>();
   }
-  return int_pin_ids;
+  const auto& lookup = ext_pin_lookup_[pin_direction];
+  auto result = lookup.find(ext_pin);
+  if (result == lookup.end()) {
+    return std::vector<IoPinTableId>();
+  }
+  return result->second;
 }
 
 bool IoPinTable::empty() const { return 0 == pin_ids_.size(); }
@@ -99,7 +100,9 @@ void IoPinTable::set_internal_pin(const IoPinTableId& pin_id,
 void IoPinTable::set_external_pin(const IoPinTableId& pin_id,
                                   const BasicPort& pin) {
   VTR_ASSERT(valid_pin_id(pin_id));
+  unregister_pin_lookup(pin_id);
   external_pins_[pin_id] = pin;
+  register_pin_lookup(pin_id);
 }
 
 void IoPinTable::set_pin_side(const IoPinTableId& pin_id, const e_side& side) {
@@ -110,7 +113,38 @@ void IoPinTable::set_pin_side(const IoPinTableId& pin_id, const e_side& side) {
 void IoPinTable::set_pin_direction(const IoPinTableId& pin_id,
                                    const e_io_direction& direction) {
   VTR_ASSERT(valid_pin_id(pin_id));
+  unregister_pin_lookup(pin_id);
   pin_directions_[pin_id] = direction;
+  register_pin_lookup(pin_id);
+}
+
+/************************************************************************
+ * Internal utilities
+ ***********************************************************************/
+void IoPinTable::register_pin_lookup(const IoPinTableId& pin_id) {
+  if (NUM_IO_DIRECTIONS == pin_directions_[pin_id]) {
+    return;
+  }
+  std::vector<IoPinTableId>& ids =
+    ext_pin_lookup_[pin_directions_[pin_id]][external_pins_[pin_id]];
+  /* Keep the ids sorted so that queries follow the creation order of pins */
+  ids.insert(std::lower_bound(ids.begin(), ids.end(), pin_id), pin_id);
+}
+
+void IoPinTable::unregister_pin_lookup(const IoPinTableId& pin_id) {
+  if (NUM_IO_DIRECTIONS == pin_directions_[pin_id]) {
+    return;
+  }
+  auto& lookup = ext_pin_lookup_[pin_directions_[pin_id]];
+  auto result = lookup.find(external_pins_[pin_id]);
+  if (result == lookup.end()) {
+    return;
+  }
+  std::vector<IoPinTableId>& ids = result->second;
+  ids.erase(std::remove(ids.begin(), ids.end(), pin_id), ids.end());
+  if (ids.empty()) {
+    lookup.erase(result);
+  }
 }
 
 /************************************************************************
@@ -7,6 +7,7 @@
 #include <array>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 /* Headers from vtrutil library */
 #include "vtr_geometry.h"
@@ -102,6 +103,11 @@ class IoPinTable {
   /* Show if the pin id is a valid for data queries */
   bool valid_pin_id(const IoPinTableId& pin_id) const;
 
+ private: /* Internal utilities */
+  /* Add/remove a pin to/from the fast lookup of external pins */
+  void register_pin_lookup(const IoPinTableId& pin_id);
+  void unregister_pin_lookup(const IoPinTableId& pin_id);
+
  private: /* Internal data */
   /* Unique ids for each design constraint */
   vtr::vector<IoPinTableId, IoPinTableId> pin_ids_;
@@ -111,6 +117,13 @@ class IoPinTable {
   vtr::vector<IoPinTableId, BasicPort> external_pins_;
   vtr::vector<IoPinTableId, e_side> pin_sides_;
   vtr::vector<IoPinTableId, e_io_direction> pin_directions_;
+
+  /* Fast lookup to find internal pins: [direction][external_pin] -> pin ids
+   * The pin ids are sorted in ascending order for each external pin
+   */
+  std::array<std::unordered_map<BasicPort, std::vector<IoPinTableId>>,
+             NUM_IO_DIRECTIONS>
+    ext_pin_lookup_;
 };
 
 } /* end namespace openfpga */
@@ -2,6 +2,7 @@
  * Inspired from https://github.com/genbtc/VerilogPCFparser
  ******************************************************************************/
 #include <sstream>
+#include <unordered_set>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -41,6 +42,12 @@ int pcf2place(const PcfData& pcf_data,
     VTR_LOG("PCF basic check passed\n");
   }
 
+  /* Build fast lookups on net names to avoid linear searches per constraint */
+  std::unordered_set<std::string> input_net_lookup(input_nets.begin(),
+                                                   input_nets.end());
+  std::unordered_set<std::string> output_net_lookup(output_nets.begin(),
+                                                    output_nets.end());
+
   /* Build the I/O place */
   for (const PcfIoConstraintId& io_id : pcf_data.io_constraints()) {
     /* Find the net name */
@@ -49,11 +56,9 @@ int pcf2place(const PcfData& pcf_data,
     BasicPort ext_pin = pcf_data.io_pin(io_id);
     /* Find the pin direction from blif reader */
     IoPinTable::e_io_direction pin_direction = IoPinTable::NUM_IO_DIRECTIONS;
-    if (input_nets.end() !=
-        std::find(input_nets.begin(), input_nets.end(), net)) {
+    if (input_net_lookup.end() != input_net_lookup.find(net)) {
       pin_direction = IoPinTable::INPUT;
-    } else if (output_nets.end() !=
-               std::find(output_nets.begin(), output_nets.end(), net)) {
+    } else if (output_net_lookup.end() != output_net_lookup.find(net)) {
       pin_direction = IoPinTable::OUTPUT;
     } else {
       /* Cannot find the pin, error out! */
@@ -0,0 +1,121 @@
+/********************************************************************
+ * Benchmark to validate the scalability of pcf2place on large packages
+ * A synthetic I/O pin table, I/O location map and pcf data are built,
+ * where each external pin is mapped to an input and an output internal pin.
+ * The runtime of each step is reported and the placement results are
+ * checked against the expected coordinates
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from libpcf */
+#include "io_location_map.h"
+#include "io_net_place.h"
+#include "io_pin_table.h"
+#include "pcf2place.h"
+#include "pcf_data.h"
+
+int main(int argc, const char** argv) {
+  /* Optional argument: number of external pins, 10k by default */
+  VTR_ASSERT((1 == argc) || (2 == argc));
+  size_t num_pins = 10000;
+  if (2 == argc) {
+    num_pins = std::stoul(argv[1]);
+  }
+  /* Number of I/Os per grid location */
+  constexpr size_t NUM_IO_PER_TILE = 8;
+
+  openfpga::IoPinTable io_pin_table;
+  openfpga::IoLocationMap io_location_map;
+  openfpga::PcfData pcf_data;
+  std::vector<std::string> input_nets;
+  std::vector<std::string> output_nets;
+
+  {
+    vtr::ScopedStartFinishTimer timer("Build synthetic I/O pin table");
+    io_pin_table.reserve_pins(2 * num_pins);
+    for (size_t ipin = 0; ipin < num_pins; ++ipin) {
+      openfpga::BasicPort ext_pin("CHIP_IO", ipin, ipin);
+      /* Input path */
+      IoPinTableId in_pin_id = io_pin_table.create_pin();
+      io_pin_table.set_internal_pin(
+        in_pin_id, openfpga::BasicPort("gfpga_pad_IN", ipin, ipin));
+      io_pin_table.set_external_pin(in_pin_id, ext_pin);
+      io_pin_table.set_pin_side(in_pin_id, BOTTOM);
+      io_pin_table.set_pin_direction(in_pin_id, openfpga::IoPinTable::INPUT);
+      /* Output path */
+      IoPinTableId out_pin_id = io_pin_table.create_pin();
+      io_pin_table.set_internal_pin(
+        out_pin_id, openfpga::BasicPort("gfpga_pad_OUT", ipin, ipin));
+      io_pin_table.set_external_pin(out_pin_id, ext_pin);
+      io_pin_table.set_pin_side(out_pin_id, BOTTOM);
+      io_pin_table.set_pin_direction(out_pin_id,
+                                     openfpga::IoPinTable::OUTPUT);
+    }
+  }
+
+  {
+    vtr::ScopedStartFinishTimer timer("Build synthetic I/O location map");
+    for (size_t ipin = 0; ipin < num_pins; ++ipin) {
+      size_t x = 1 + ipin / NUM_IO_PER_TILE;
+      size_t z = ipin % NUM_IO_PER_TILE;
+      io_location_map.set_io_index(x, 0, z, std::string("gfpga_pad_IN"), ipin);
+      io_location_map.set_io_index(x, 0, z, std::string("gfpga_pad_OUT"),
+                                   ipin);
+    }
+  }
+
+  {
+    vtr::ScopedStartFinishTimer timer("Build synthetic design constraints");
+    pcf_data.reserve_io_constraints(num_pins);
+    for (size_t ipin = 0; ipin < num_pins; ++ipin) {
+      std::string net = std::string("net") + std::to_string(ipin);
+      /* Even pins are used as inputs while odd pins are used as outputs */
+      if (0 == ipin % 2) {
+        input_nets.push_back(net);
+      } else {
+        output_nets.push_back(net);
+      }
+      PcfIoConstraintId io_id = pcf_data.create_io_constraint();
+      pcf_data.set_io_net(io_id, net);
+      pcf_data.set_io_pin(io_id,
+                          std::string("CHIP_IO[") + std::to_string(ipin) + "]");
+    }
+  }
+
+  openfpga::IoNetPlace io_net_place;
+  int status = 0;
+  {
+    vtr::ScopedStartFinishTimer timer("Run pcf2place");
+    status = pcf2place(pcf_data, input_nets, output_nets, io_pin_table,
+                       io_location_map, io_net_place);
+  }
+  if (status) {
+    VTR_LOG_ERROR("pcf2place failed with %d errors!\n", status);
+    return status;
+  }
+
+  /* Validate the coordinates */
+  size_t num_err = 0;
+  for (size_t ipin = 0; ipin < num_pins; ++ipin) {
+    std::string net = std::string("net") + std::to_string(ipin);
+    if (1 == ipin % 2) {
+      net = "out:" + net;
+    }
+    if ((1 + ipin / NUM_IO_PER_TILE != io_net_place.io_x(net)) ||
+        (0 != io_net_place.io_y(net)) ||
+        (ipin % NUM_IO_PER_TILE != io_net_place.io_z(net))) {
+      VTR_LOG_ERROR("Net '%s' is placed to an unexpected coordinate!\n",
+                    net.c_str());
+      num_err++;
+    }
+  }
+  VTR_LOG("Placed %lu nets with %lu errors\n", num_pins, num_err);
+
+  return num_err ? 1 : 0;
+}
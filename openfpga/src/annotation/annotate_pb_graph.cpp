@@ -5,7 +5,11 @@
 /* Headers from vtrutil library */
 #include "annotate_pb_graph.h"
 
+#include <utility>
+#include <vector>
+
 #include "check_pb_graph_annotation.h"
+#include "openfpga_thread_pool.h"
 #include "pb_graph_utils.h"
 #include "pb_type_utils.h"
 #include "vtr_assert.h"
@@ -17,17 +21,17 @@ namespace openfpga {
 /********************************************************************
  * This function will recursively walk through all the pb_graph nodes
  * starting from a top node.
- * It aims to annotate the physical type of each interconnect.
- * This is due to that the type of interconnect 'complete' may diverge
- * in physical implmentation.
- *  - When there is only one input driving a 'complete' interconnection,
- *    it will be implemented with wires
- *  - When there are multiple inputs driving a 'complete' interconnection,
- *    it will be implemented with routing multiplexers
+ * It aims to find the number of inputs of each interconnect, from which
+ * the physical type of the interconnect is inferred.
+ * The results are appended to interc_num_inputs in the order of visit.
+ * The device annotation is only read, so that different top nodes can be
+ * walked through in parallel
  *******************************************************************/
-static void rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
-  t_pb_graph_node* pb_graph_node, VprDeviceAnnotation& vpr_device_annotation,
-  const bool& verbose_output) {
+static void rec_find_vpr_pb_graph_interconnect_num_inputs(
+  t_pb_graph_node* pb_graph_node,
+  const VprDeviceAnnotation& vpr_device_annotation,
+  std::vector<InterconnectNumInputs>& interc_num_inputs,
+  std::vector<std::pair<size_t, t_pb_graph_pin*>>& pin_inputs) {
   /* Skip the root node because we start from the inputs of child pb_graph node
    *
    *   pb_graph_node
@@ -48,102 +52,17 @@ static void rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
       pb_graph_node->parent_pb_graph_node->pb_type);
     VTR_ASSERT(nullptr != child_physical_mode);
 
-    std::map<t_interconnect*, size_t> interc_num_inputs;
-
-    /* Find all the interconnects sourced from the input and clock pins */
-    for (int iport = 0; iport < pb_graph_node->num_input_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ++ipin) {
-        for (int iedge = 0;
-             iedge < pb_graph_node->input_pins[iport][ipin].num_input_edges;
-             ++iedge) {
-          t_interconnect* interc = pb_graph_node->input_pins[iport][ipin]
-                                     .input_edges[iedge]
-                                     ->interconnect;
-          /* Ensure that the interconnect is unique in the list */
-          if (0 < interc_num_inputs.count(interc)) {
-            continue;
-          }
-          /* Unique interconnect, initialize the counter to be zero */
-          interc_num_inputs[interc] = 0;
-        }
-      }
-    }
-
-    for (int iport = 0; iport < pb_graph_node->num_clock_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ++ipin) {
-        for (int iedge = 0;
-             iedge < pb_graph_node->clock_pins[iport][ipin].num_input_edges;
-             ++iedge) {
-          t_interconnect* interc = pb_graph_node->clock_pins[iport][ipin]
-                                     .input_edges[iedge]
-                                     ->interconnect;
-          /* Ensure that the interconnect is unique in the list */
-          if (0 < interc_num_inputs.count(interc)) {
-            continue;
-          }
-          /* Unique interconnect, initialize the counter to be zero */
-          interc_num_inputs[interc] = 0;
-        }
-      }
-    }
-
-    /* Check: all the element should be initialized to 0 */
-    for (const auto& pair : interc_num_inputs) {
-      VTR_ASSERT(nullptr != pair.first);
-      VTR_ASSERT(0 == pair.second);
-    }
-
     /* We only care input and clock pins */
-    for (int iport = 0; iport < pb_graph_node->num_input_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ++ipin) {
-        /* For each interconnect, we count the total number of inputs */
-        for (const auto& pair : interc_num_inputs) {
-          interc_num_inputs[pair.first] +=
-            pb_graph_pin_inputs(&(pb_graph_node->input_pins[iport][ipin]),
-                                pair.first)
-              .size();
-        }
-      }
-    }
-
-    for (int iport = 0; iport < pb_graph_node->num_clock_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ++ipin) {
-        /* For each interconnect, we count the total number of inputs */
-        for (const auto& pair : interc_num_inputs) {
-          interc_num_inputs[pair.first] +=
-            pb_graph_pin_inputs(&(pb_graph_node->clock_pins[iport][ipin]),
-                                pair.first)
-              .size();
-        }
-      }
-    }
-
-    /* For each interconnect that has more than 1 input, we can infer the
-     * physical type */
-    for (const auto& pair : interc_num_inputs) {
-      t_interconnect* interc = pair.first;
-      size_t actual_interc_num_inputs = pair.second;
-      /* If the number inputs for an interconnect is zero, this is a 0-driver
-       * pin we just set 1 to use direct wires
-       */
-      if (0 == actual_interc_num_inputs) {
-        actual_interc_num_inputs = 1;
-      }
-
-      e_interconnect interc_physical_type =
-        pb_interconnect_physical_type(interc, actual_interc_num_inputs);
-      if (interc_physical_type ==
-          vpr_device_annotation.interconnect_physical_type(interc)) {
-        /* Skip annotation if we have already done! */
-        continue;
-      }
-      VTR_LOGV(verbose_output,
-               "Infer physical type '%s' of interconnect '%s' (was '%s')\n",
-               INTERCONNECT_TYPE_STRING[interc_physical_type], interc->name,
-               INTERCONNECT_TYPE_STRING[interc->type]);
-      vpr_device_annotation.add_interconnect_physical_type(
-        interc, interc_physical_type);
-    }
+    std::vector<InterconnectNumInputs> node_interc_num_inputs;
+    count_pb_graph_pins_interconnect_num_inputs(
+      pb_graph_node->input_pins, pb_graph_node->num_input_ports,
+      pb_graph_node->num_input_pins, node_interc_num_inputs, pin_inputs);
+    count_pb_graph_pins_interconnect_num_inputs(
+      pb_graph_node->clock_pins, pb_graph_node->num_clock_ports,
+      pb_graph_node->num_clock_pins, node_interc_num_inputs, pin_inputs);
+    interc_num_inputs.insert(interc_num_inputs.end(),
+                             node_interc_num_inputs.begin(),
+                             node_interc_num_inputs.end());
   }
 
   /* If we reach a primitive pb_graph node, we return */
@@ -171,70 +90,13 @@ static void rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
    *
    */
   { /* Use a code block to use local variables freely */
-    std::map<t_interconnect*, size_t> interc_num_inputs;
-    /* Find all the interconnects sourced from the output pins */
-    for (int iport = 0; iport < pb_graph_node->num_output_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_output_pins[iport]; ++ipin) {
-        for (int iedge = 0;
-             iedge < pb_graph_node->output_pins[iport][ipin].num_input_edges;
-             ++iedge) {
-          t_interconnect* interc = pb_graph_node->output_pins[iport][ipin]
-                                     .input_edges[iedge]
-                                     ->interconnect;
-          /* Ensure that the interconnect is unique in the list */
-          if (0 < interc_num_inputs.count(interc)) {
-            continue;
-          }
-          /* Unique interconnect, initialize the counter to be zero */
-          interc_num_inputs[interc] = 0;
-        }
-      }
-    }
-
-    /* Check: all the element should be initialized to 0 */
-    for (const auto& pair : interc_num_inputs) {
-      VTR_ASSERT(nullptr != pair.first);
-      VTR_ASSERT(0 == pair.second);
-    }
-
-    /* We only care input and clock pins */
-    for (int iport = 0; iport < pb_graph_node->num_output_ports; ++iport) {
-      for (int ipin = 0; ipin < pb_graph_node->num_output_pins[iport]; ++ipin) {
-        /* For each interconnect, we count the total number of inputs */
-        for (const auto& pair : interc_num_inputs) {
-          interc_num_inputs[pair.first] +=
-            pb_graph_pin_inputs(&(pb_graph_node->output_pins[iport][ipin]),
-                                pair.first)
-              .size();
-        }
-      }
-    }
-    /* For each interconnect that has more than 1 input, we can infer the
-     * physical type */
-    for (const auto& pair : interc_num_inputs) {
-      t_interconnect* interc = pair.first;
-      size_t actual_interc_num_inputs = pair.second;
-      /* If the number inputs for an interconnect is zero, this is a 0-driver
-       * pin we just set 1 to use direct wires
-       */
-      if (0 == actual_interc_num_inputs) {
-        actual_interc_num_inputs = 1;
-      }
-
-      e_interconnect interc_physical_type =
-        pb_interconnect_physical_type(interc, actual_interc_num_inputs);
-      if (interc_physical_type ==
-          vpr_device_annotation.interconnect_physical_type(interc)) {
-        /* Skip annotation if we have already done! */
-        continue;
-      }
-      VTR_LOGV(verbose_output,
-               "Infer physical type '%s' of interconnect '%s' (was '%s')\n",
-               INTERCONNECT_TYPE_STRING[interc_physical_type], interc->name,
-               INTERCONNECT_TYPE_STRING[interc->type]);
-      vpr_device_annotation.add_interconnect_physical_type(
-        interc, interc_physical_type);
-    }
+    std::vector<InterconnectNumInputs> node_interc_num_inputs;
+    count_pb_graph_pins_interconnect_num_inputs(
+      pb_graph_node->output_pins, pb_graph_node->num_output_ports,
+      pb_graph_node->num_output_pins, node_interc_num_inputs, pin_inputs);
+    interc_num_inputs.insert(interc_num_inputs.end(),
+                             node_interc_num_inputs.begin(),
+                             node_interc_num_inputs.end());
   }
 
   /* Recursively visit all the child pb_graph_nodes */
@@ -242,17 +104,60 @@ static void rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
     /* Each child may exist multiple times in the hierarchy*/
     for (int jpb = 0; jpb < physical_mode->pb_type_children[ipb].num_pb;
          ++jpb) {
-      rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
+      rec_find_vpr_pb_graph_interconnect_num_inputs(
         &(pb_graph_node->child_pb_graph_nodes[physical_mode->index][ipb][jpb]),
-        vpr_device_annotation, verbose_output);
+        vpr_device_annotation, interc_num_inputs, pin_inputs);
     }
   }
 }
 
+/********************************************************************
+ * Annotate the physical type of interconnects from their number of inputs
+ * This is due to that the type of interconnect 'complete' may diverge
+ * in physical implmentation.
+ *  - When there is only one input driving a 'complete' interconnection,
+ *    it will be implemented with wires
+ *  - When there are multiple inputs driving a 'complete' interconnection,
+ *    it will be implemented with routing multiplexers
+ *******************************************************************/
+static void annotate_interconnect_physical_types(
+  const std::vector<InterconnectNumInputs>& interc_num_inputs,
+  VprDeviceAnnotation& vpr_device_annotation, const bool& verbose_output) {
+  for (const auto& pair : interc_num_inputs) {
+    t_interconnect* interc = pair.first;
+    size_t actual_interc_num_inputs = pair.second;
+    /* If the number inputs for an interconnect is zero, this is a 0-driver
+     * pin we just set 1 to use direct wires
+     */
+    if (0 == actual_interc_num_inputs) {
+      actual_interc_num_inputs = 1;
+    }
+
+    e_interconnect interc_physical_type =
+      pb_interconnect_physical_type(interc, actual_interc_num_inputs);
+    if (interc_physical_type ==
+        vpr_device_annotation.interconnect_physical_type(interc)) {
+      /* Skip annotation if we have already done! */
+      continue;
+    }
+    VTR_LOGV(verbose_output,
+             "Infer physical type '%s' of interconnect '%s' (was '%s')\n",
+             INTERCONNECT_TYPE_STRING[interc_physical_type], interc->name,
+             INTERCONNECT_TYPE_STRING[interc->type]);
+    vpr_device_annotation.add_interconnect_physical_type(interc,
+                                                         interc_physical_type);
+  }
+}
+
 /********************************************************************
  * This function aims to annotate the physical type for each interconnect
  * inside the pb_graph
  *
+ * The pb_graphs of logical block types are walked through in parallel,
+ * while the annotation is done sequentially in the order of the logical
+ * block types, so that the results and logs are the same as a sequential
+ * run
+ *
  * Note:
  *   - This function should be executed AFTER functions
  *       build_vpr_physical_pb_mode_explicit_annotation()
@@ -261,14 +166,29 @@ static void rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
 void annotate_pb_graph_interconnect_physical_type(
   const DeviceContext& vpr_device_ctx,
   VprDeviceAnnotation& vpr_device_annotation, const bool& verbose_output) {
+  std::vector<t_pb_graph_node*> pb_graph_heads;
   for (const t_logical_block_type& lb_type :
        vpr_device_ctx.logical_block_types) {
     /* By pass nullptr for pb_graph head */
     if (nullptr == lb_type.pb_graph_head) {
       continue;
     }
-    rec_build_vpr_pb_graph_interconnect_physical_type_annotation(
-      lb_type.pb_graph_head, vpr_device_annotation, verbose_output);
+    pb_graph_heads.push_back(lb_type.pb_graph_head);
+  }
+
+  std::vector<std::vector<InterconnectNumInputs>> head_interc_num_inputs(
+    pb_graph_heads.size());
+  parallel_for(0, pb_graph_heads.size(), [&](const size_t& ihead) {
+    std::vector<std::pair<size_t, t_pb_graph_pin*>> pin_inputs;
+    rec_find_vpr_pb_graph_interconnect_num_inputs(
+      pb_graph_heads[ihead],
+      const_cast<const VprDeviceAnnotation&>(vpr_device_annotation),
+      head_interc_num_inputs[ihead], pin_inputs);
+  });
+
+  for (const auto& interc_num_inputs : head_interc_num_inputs) {
+    annotate_interconnect_physical_types(
+      interc_num_inputs, vpr_device_annotation, verbose_output);
   }
 }
 
@@ -1,7 +1,10 @@
 #include "append_clock_rr_graph.h"
 
+#include <utility>
+
 #include "command_exit_codes.h"
 #include "openfpga_physical_tile_utils.h"
+#include "openfpga_thread_pool.h"
 #include "rr_graph_builder_utils.h"
 #include "rr_graph_cost.h"
 #include "vtr_assert.h"
@@ -476,15 +479,16 @@ static std::vector<RRNodeId> find_clock_track2ipin_node(
 }
 
 /********************************************************************
- * Add edges for the clock nodes in a given connection block
+ * Find the edges for the clock nodes in a given connection block
+ * Edges are stored as pairs of source and sink nodes, in the order to be
+ * created. Note that this function only reads the routing resource graph, so
+ * that it can be called for different connection blocks in parallel
  *******************************************************************/
-static void add_rr_graph_block_clock_edges(
-  RRGraphBuilder& rr_graph_builder, size_t& num_edges_to_create,
+static void find_rr_graph_block_clock_edges(
+  std::vector<std::pair<RRNodeId, RRNodeId>>& clock_edges,
   const RRClockSpatialLookup& clk_rr_lookup, const RRGraphView& rr_graph_view,
   const DeviceGrid& grids, const ClockNetwork& clk_ntwk,
-  const vtr::Point<size_t>& chan_coord, const t_rr_type& chan_type,
-  const bool& verbose) {
-  size_t edge_count = 0;
+  const vtr::Point<size_t>& chan_coord, const t_rr_type& chan_type) {
   for (auto itree : clk_ntwk.trees()) {
     for (auto ilvl : clk_ntwk.levels(itree)) {
       /* As we want to keep uni-directional wires, clock routing tracks have to
@@ -508,51 +512,28 @@ static void add_rr_graph_block_clock_edges(
           RRNodeId src_node =
             clk_rr_lookup.find_node(chan_coord.x(), chan_coord.y(), itree, ilvl,
                                     ClockTreePinId(ipin), node_dir);
-          VTR_LOGV(verbose,
-                   "Try to find node '%lu' from clock node lookup (x='%lu' "
-                   "y='%lu' tree='%lu' level='%lu' pin='%lu' direction='%s')\n",
-                   size_t(src_node), chan_coord.x(), chan_coord.y(),
-                   size_t(itree), size_t(ilvl), size_t(ipin),
-                   DIRECTION_STRING[size_t(node_dir)]);
           VTR_ASSERT(rr_graph_view.valid_node(src_node));
           /* find the fan-out clock node through lookup */
-          {
-            size_t curr_edge_count = edge_count;
-            for (RRNodeId des_node : find_clock_track2track_node(
-                   rr_graph_view, clk_ntwk, clk_rr_lookup, chan_type,
-                   chan_coord, itree, ilvl, ClockTreePinId(ipin), node_dir)) {
-              /* Create edges */
-              VTR_ASSERT(rr_graph_view.valid_node(des_node));
-              rr_graph_builder.create_edge(src_node, des_node,
-                                           clk_ntwk.default_switch());
-              edge_count++;
-            }
-            VTR_LOGV(verbose, "\tWill add %lu edges to other clock nodes\n",
-                     edge_count - curr_edge_count);
+          for (RRNodeId des_node : find_clock_track2track_node(
+                 rr_graph_view, clk_ntwk, clk_rr_lookup, chan_type, chan_coord,
+                 itree, ilvl, ClockTreePinId(ipin), node_dir)) {
+            VTR_ASSERT(rr_graph_view.valid_node(des_node));
+            clock_edges.push_back(std::make_pair(src_node, des_node));
           }
           /* If this is the clock node at the last level of the tree,
            * should drive some grid IPINs which are clocks */
           if (clk_ntwk.is_last_level(itree, ilvl)) {
-            size_t curr_edge_count = edge_count;
             for (RRNodeId des_node : find_clock_track2ipin_node(
                    grids, rr_graph_view, chan_type, chan_coord, clk_ntwk, itree,
                    ClockTreePinId(ipin))) {
-              /* Create edges */
               VTR_ASSERT(rr_graph_view.valid_node(des_node));
-              rr_graph_builder.create_edge(src_node, des_node,
-                                           clk_ntwk.default_switch());
-              edge_count++;
+              clock_edges.push_back(std::make_pair(src_node, des_node));
             }
-            VTR_LOGV(verbose, "\tWill add %lu edges to other IPIN\n",
-                     edge_count - curr_edge_count);
           }
         }
       }
     }
   }
-  /* Allocate edges */
-  rr_graph_builder.build_edges(true);
-  num_edges_to_create += edge_count;
 }
 
 /********************************************************************
@@ -575,14 +556,26 @@ static void add_rr_graph_block_clock_edges(
  *                                     |
  *                                     v
  *                            clk0_lvl1_chany[1][1]
+ *
+ * The edges are found in two phases:
+ * - The candidate search is read-only, and is split into rows of X-direction
+ *   connection blocks and columns of Y-direction connection blocks, which are
+ *   processed by worker threads
+ * - The edges of each row/column are then created in a fixed order, so that
+ *   the resulting routing resource graph does not depend on the number of
+ *   threads
  *******************************************************************/
 static void add_rr_graph_clock_edges(
   RRGraphBuilder& rr_graph_builder, size_t& num_edges_to_create,
   const RRClockSpatialLookup& clk_rr_lookup, const RRGraphView& rr_graph_view,
   const DeviceGrid& grids, const bool& through_channel,
   const ClockNetwork& clk_ntwk, const bool& verbose) {
-  /* Add edges which is driven by X-direction clock routing tracks */
+  /* Group the connection blocks: a row for each X-direction routing channel
+   * and a column for each Y-direction routing channel */
+  std::vector<std::vector<vtr::Point<size_t>>> chan_coord_groups;
+  std::vector<t_rr_type> chan_group_types;
   for (size_t iy = 0; iy < grids.height() - 1; ++iy) {
+    std::vector<vtr::Point<size_t>> chanx_coords;
     for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
       vtr::Point<size_t> chanx_coord(ix, iy);
       /* Bypass if the routing channel does not exist when through channels are
@@ -591,14 +584,13 @@ static void add_rr_graph_clock_edges(
           (false == is_chanx_exist(grids, chanx_coord))) {
         continue;
       }
-      add_rr_graph_block_clock_edges(rr_graph_builder, num_edges_to_create,
-                                     clk_rr_lookup, rr_graph_view, grids,
-                                     clk_ntwk, chanx_coord, CHANX, verbose);
+      chanx_coords.push_back(chanx_coord);
     }
+    chan_coord_groups.push_back(chanx_coords);
+    chan_group_types.push_back(CHANX);
   }
-
-  /* Add edges which is driven by Y-direction clock routing tracks */
   for (size_t ix = 0; ix < grids.width() - 1; ++ix) {
+    std::vector<vtr::Point<size_t>> chany_coords;
     for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
       vtr::Point<size_t> chany_coord(ix, iy);
       /* Bypass if the routing channel does not exist when through channel are
@@ -607,10 +599,43 @@ static void add_rr_graph_clock_edges(
           (false == is_chany_exist(grids, chany_coord))) {
         continue;
       }
-      add_rr_graph_block_clock_edges(rr_graph_builder, num_edges_to_create,
-                                     clk_rr_lookup, rr_graph_view, grids,
-                                     clk_ntwk, chany_coord, CHANY, verbose);
+      chany_coords.push_back(chany_coord);
     }
+    chan_coord_groups.push_back(chany_coords);
+    chan_group_types.push_back(CHANY);
+  }
+
+  /* Phase 1: search for the fan-out nodes of each group in parallel */
+  std::vector<std::vector<std::pair<RRNodeId, RRNodeId>>> group_edges(
+    chan_coord_groups.size());
+  {
+    vtr::ScopedStartFinishTimer timer("Find clock edges");
+    parallel_for(0, chan_coord_groups.size(), [&](const size_t& igroup) {
+      for (const vtr::Point<size_t>& chan_coord : chan_coord_groups[igroup]) {
+        find_rr_graph_block_clock_edges(
+          group_edges[igroup], clk_rr_lookup, rr_graph_view, grids, clk_ntwk,
+          chan_coord, chan_group_types[igroup]);
+      }
+    });
+    VTR_LOGV(verbose, "Searched clock edges with %lu threads\n",
+             num_threads());
+  }
+
+  /* Phase 2: create the edges in a deterministic order */
+  {
+    vtr::ScopedStartFinishTimer timer("Create clock edges");
+    for (size_t igroup = 0; igroup < chan_coord_groups.size(); ++igroup) {
+      for (const std::pair<RRNodeId, RRNodeId>& edge : group_edges[igroup]) {
+        rr_graph_builder.create_edge(edge.first, edge.second,
+                                     clk_ntwk.default_switch());
+      }
+      num_edges_to_create += group_edges[igroup].size();
+      VTR_LOGV(verbose, "Will add %lu edges driven by %s clock nodes\n",
+               group_edges[igroup].size(),
+               rr_node_typename[chan_group_types[igroup]]);
+    }
+    /* Allocate edges */
+    rr_graph_builder.build_edges(true);
   }
 }
 
@@ -657,10 +682,13 @@ int append_clock_rr_graph(DeviceContext& vpr_device_ctx,
            num_clock_nodes, (float)(num_clock_nodes / orig_num_nodes));
 
   /* Add clock nodes */
-  add_rr_graph_clock_nodes(vpr_device_ctx.rr_graph_builder, clk_rr_lookup,
-                           vpr_device_ctx.rr_graph, vpr_device_ctx.grid,
-                           vpr_device_ctx.arch->through_channel, clk_ntwk,
-                           verbose);
+  {
+    vtr::ScopedStartFinishTimer node_timer("Add clock nodes");
+    add_rr_graph_clock_nodes(vpr_device_ctx.rr_graph_builder, clk_rr_lookup,
+                             vpr_device_ctx.rr_graph, vpr_device_ctx.grid,
+                             vpr_device_ctx.arch->through_channel, clk_ntwk,
+                             verbose);
+  }
   VTR_LOGV(verbose,
            "Added %lu clock nodes to routing "
            "resource graph.\n",
@@ -681,12 +709,16 @@ int append_clock_rr_graph(DeviceContext& vpr_device_ctx,
            num_clock_edges);
 
   /* TODO: Sanity checks */
-  VTR_LOGV(verbose, "Initializing fan-in of nodes\n");
-  vpr_device_ctx.rr_graph_builder.init_fan_in();
-  VTR_LOGV(verbose, "Apply edge partitioning\n");
-  vpr_device_ctx.rr_graph_builder.partition_edges();
-  VTR_LOGV(verbose, "Building incoming edges\n");
-  vpr_device_ctx.rr_graph_builder.build_in_edges();
+  {
+    vtr::ScopedStartFinishTimer finalize_timer(
+      "Finalize routing resource graph");
+    VTR_LOGV(verbose, "Initializing fan-in of nodes\n");
+    vpr_device_ctx.rr_graph_builder.init_fan_in();
+    VTR_LOGV(verbose, "Apply edge partitioning\n");
+    vpr_device_ctx.rr_graph_builder.partition_edges();
+    VTR_LOGV(verbose, "Building incoming edges\n");
+    vpr_device_ctx.rr_graph_builder.build_in_edges();
+  }
 
   /* Report number of added clock nodes and edges */
   VTR_LOG(
@@ -175,6 +175,35 @@ const RRGSB& DeviceRRGSB::get_sb_unique_module(
   return get_sb_unique_module(sb_unique_module_id);
 }
 
+/* Note that the heap memory owned by each RRGSB is not included, as it is
+ * internal to VPR */
+MemoryUsage DeviceRRGSB::memory_usage() const {
+  size_t num_gsbs = 0;
+  for (const auto& rr_gsb_column : rr_gsb_) {
+    num_gsbs += rr_gsb_column.size();
+  }
+  MemoryUsage usage("DeviceRRGSB");
+  usage.add_child(
+    MemoryUsage("gsbs", heap_memory_usage(rr_gsb_), num_gsbs));
+  usage.add_child(MemoryUsage("unique_gsbs",
+                              heap_memory_usage(gsb_unique_module_id_) +
+                                heap_memory_usage(gsb_unique_module_),
+                              gsb_unique_module_.size()));
+  usage.add_child(MemoryUsage("unique_sbs",
+                              heap_memory_usage(sb_unique_module_id_) +
+                                heap_memory_usage(sb_unique_module_),
+                              sb_unique_module_.size()));
+  usage.add_child(MemoryUsage("unique_cbxs",
+                              heap_memory_usage(cbx_unique_module_id_) +
+                                heap_memory_usage(cbx_unique_module_),
+                              cbx_unique_module_.size()));
+  usage.add_child(MemoryUsage("unique_cbys",
+                              heap_memory_usage(cby_unique_module_id_) +
+                                heap_memory_usage(cby_unique_module_),
+                              cby_unique_module_.size()));
+  return usage;
+}
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
@@ -7,6 +7,9 @@
 /* Header files from vtrutil library */
 #include "vtr_geometry.h"
 
+/* Header files from openfpgautil library */
+#include "openfpga_memory_usage.h"
+
 /* Header files from vpr library */
 #include "rr_graph_view.h"
 #include "rr_gsb.h"
@@ -59,6 +62,8 @@ class DeviceRRGSB {
   size_t get_num_cb_unique_module(const t_rr_type& cb_type)
     const; /* get the number of unique mirrors of CBs */
   bool is_gsb_exist(const vtr::Point<size_t> coord) const;
+  /* Estimate the heap memory of the GSBs and their unique modules */
+  MemoryUsage memory_usage() const;
 
  public: /* Mutators */
   void reserve(
@@ -1,7 +1,13 @@
 #include "route_clock_rr_graph.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <set>
+
 #include "command_exit_codes.h"
 #include "openfpga_atom_netlist_utils.h"
+#include "vpr_utils.h"
 #include "vtr_assert.h"
 #include "vtr_geometry.h"
 #include "vtr_log.h"
@@ -77,77 +83,236 @@ static int build_clock_tree_net_map(
   return CMD_EXEC_SUCCESS;
 }
 
+/********************************************************************
+ * Find the tile pins which are driven by each clock net in the clustered
+ * netlist. A tile pin is identified by the root coordinate of the tile and
+ * the physical pin index in the tile, which is also the ptc number of the
+ * associated IPIN node in the routing resource graph
+ *******************************************************************/
+static void build_clock_net_tile_pin_demands(
+  std::map<ClusterNetId, std::set<std::array<size_t, 3>>>& clk_net_demands,
+  const DeviceGrid& grids, const PlacementContext& vpr_place_ctx,
+  const ClusteredNetlist& cluster_nlist,
+  const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map) {
+  for (auto pin_net_pair : tree2clk_pin_map) {
+    ClusterNetId clk_net = pin_net_pair.second;
+    std::set<std::array<size_t, 3>>& tile_pins = clk_net_demands[clk_net];
+    for (ClusterPinId sink_pin : cluster_nlist.net_sinks(clk_net)) {
+      ClusterBlockId blk_id = cluster_nlist.pin_block(sink_pin);
+      t_pl_loc blk_loc = vpr_place_ctx.block_locs[blk_id].loc;
+      t_physical_tile_type_ptr physical_tile = grids[blk_loc.x][blk_loc.y].type;
+      t_logical_block_type_ptr logical_block = cluster_nlist.block_type(blk_id);
+      /* Consider the z offset of the subtile, which is not considered by
+       * get_physical_pin() */
+      int physical_pin =
+        blk_loc.sub_tile * logical_block->pb_type->num_pins +
+        get_physical_pin(physical_tile, logical_block,
+                         cluster_nlist.pin_logical_index(sink_pin));
+      tile_pins.insert(
+        {size_t(blk_loc.x), size_t(blk_loc.y), size_t(physical_pin)});
+    }
+  }
+}
+
+/********************************************************************
+ * Identify if a clock tap (an IPIN node) is required by a clock net
+ *******************************************************************/
+static bool is_clock_tap_used(
+  const RRGraphView& rr_graph, const DeviceGrid& grids,
+  const RRNodeId& ipin_node,
+  const std::set<std::array<size_t, 3>>& tile_pin_demands) {
+  size_t x = rr_graph.node_xlow(ipin_node);
+  size_t y = rr_graph.node_ylow(ipin_node);
+  /* IPINs of a large tile may locate at an offset to the root of the tile */
+  std::array<size_t, 3> tile_pin = {x - grids[x][y].width_offset,
+                                    y - grids[x][y].height_offset,
+                                    size_t(rr_graph.node_ptc_num(ipin_node))};
+  return tile_pin_demands.end() != tile_pin_demands.find(tile_pin);
+}
+
+/********************************************************************
+ * Find the clock nodes along a spine for a given clock pin, in the same order
+ * as the coordinates of the spine. This avoids querying the spatial lookup
+ * repeatedly when routing the backbone, the switch points and the taps
+ *******************************************************************/
+static std::vector<RRNodeId> find_clock_spine_nodes(
+  const RRGraphView& rr_graph, const RRClockSpatialLookup& clk_rr_lookup,
+  const ClockNetwork& clk_ntwk, const ClockTreeId& clk_tree,
+  const ClockSpineId& ispine, const ClockTreePinId& ipin) {
+  std::vector<vtr::Point<int>> spine_coords =
+    clk_ntwk.spine_coordinates(ispine);
+  Direction spine_direction = clk_ntwk.spine_direction(ispine);
+  ClockLevelId spine_level = clk_ntwk.spine_level(ispine);
+  std::vector<RRNodeId> spine_nodes;
+  spine_nodes.reserve(spine_coords.size());
+  for (const vtr::Point<int>& coord : spine_coords) {
+    RRNodeId node = clk_rr_lookup.find_node(
+      coord.x(), coord.y(), clk_tree, spine_level, ipin, spine_direction);
+    VTR_ASSERT(rr_graph.valid_node(node));
+    spine_nodes.push_back(node);
+  }
+  return spine_nodes;
+}
+
+/********************************************************************
+ * Find the index of a switch point in the list of coordinates of a spine.
+ * As spines are either horizontal or vertical, the index is the distance
+ * between the switch point and the starting point of the spine
+ *******************************************************************/
+static size_t find_spine_switch_point_coordinate_index(
+  const ClockNetwork& clk_ntwk, const ClockSpineId& ispine,
+  const ClockSwitchPointId& switch_point_id) {
+  vtr::Point<int> start_coord = clk_ntwk.spine_start_point(ispine);
+  vtr::Point<int> switch_coord =
+    clk_ntwk.spine_switch_point(ispine, switch_point_id);
+  return size_t(std::abs(switch_coord.x() - start_coord.x()) +
+                std::abs(switch_coord.y() - start_coord.y()));
+}
+
+/********************************************************************
+ * Find the number of coordinates (counted from the starting point) that a
+ * spine must cover to deliver a clock signal to all the demanding taps,
+ * either IPINs at the last level or switch points driving child spines in use.
+ * A zero value means that the spine is not used at all.
+ * Results of each spine are stored, so that child spines are visited once.
+ *******************************************************************/
+static size_t rec_find_spine_num_used_coordinates(
+  std::map<ClockSpineId, size_t>& spine_num_used_coords,
+  const RRGraphView& rr_graph, const DeviceGrid& grids,
+  const std::map<ClockSpineId, std::vector<RRNodeId>>& spine_nodes,
+  const std::set<std::array<size_t, 3>>& tile_pin_demands,
+  const ClockNetwork& clk_ntwk, const ClockSpineId& ispine) {
+  auto result = spine_num_used_coords.find(ispine);
+  if (result != spine_num_used_coords.end()) {
+    return result->second;
+  }
+  size_t num_used_coords = 0;
+  if (clk_ntwk.is_last_level(ispine)) {
+    const std::vector<RRNodeId>& curr_spine_nodes = spine_nodes.at(ispine);
+    for (size_t icoord = 0; icoord < curr_spine_nodes.size(); ++icoord) {
+      for (RREdgeId edge : rr_graph.edge_range(curr_spine_nodes[icoord])) {
+        RRNodeId des_node = rr_graph.edge_sink_node(edge);
+        if (rr_graph.node_type(des_node) == IPIN &&
+            is_clock_tap_used(rr_graph, grids, des_node, tile_pin_demands)) {
+          num_used_coords = icoord + 1;
+          break;
+        }
+      }
+    }
+  }
+  for (ClockSwitchPointId switch_point_id :
+       clk_ntwk.spine_switch_points(ispine)) {
+    ClockSpineId des_spine =
+      clk_ntwk.spine_switch_point_tap(ispine, switch_point_id);
+    if (0 == rec_find_spine_num_used_coordinates(
+               spine_num_used_coords, rr_graph, grids, spine_nodes,
+               tile_pin_demands, clk_ntwk, des_spine)) {
+      continue;
+    }
+    size_t switch_coord_idx = find_spine_switch_point_coordinate_index(
+      clk_ntwk, ispine, switch_point_id);
+    num_used_coords = std::min(std::max(num_used_coords, switch_coord_idx + 1),
+                               spine_nodes.at(ispine).size());
+  }
+  spine_num_used_coords[ispine] = num_used_coords;
+  return num_used_coords;
+}
+
 /********************************************************************
  * Route a clock tree on an existing routing resource graph
  * The strategy is to route spine one by one
  * - route the spine from the starting point to the ending point
  * - route the spine-to-spine switching points
  * - route the spine-to-IPIN connections (only for the last level)
+ * When unused spines are disabled, only the spines, switch points and taps
+ * which are on the paths to the tile pins that are driven by the clock net
+ * are routed, and each spine stops at its last used coordinate
  *******************************************************************/
 static int route_clock_tree_rr_graph(
   VprRoutingAnnotation& vpr_routing_annotation, const RRGraphView& rr_graph,
-  const RRClockSpatialLookup& clk_rr_lookup,
+  const DeviceGrid& grids, const RRClockSpatialLookup& clk_rr_lookup,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
+  const std::map<ClusterNetId, std::set<std::array<size_t, 3>>>&
+    clk_net_demands,
   const ClockNetwork& clk_ntwk, const ClockTreeId& clk_tree,
-  const bool& verbose) {
-  for (auto ispine : clk_ntwk.spines(clk_tree)) {
-    VTR_LOGV(verbose, "Routing spine '%s'...\n",
-             clk_ntwk.spine_name(ispine).c_str());
-    for (auto ipin : clk_ntwk.pins(clk_tree)) {
+  const bool& disable_unused_spines, const bool& verbose) {
+  size_t num_routed_spines = 0;
+  size_t num_routed_taps = 0;
+  for (auto ipin : clk_ntwk.pins(clk_tree)) {
+    /* It could happen that there is no net mapped some clock pin, skip the
+     * net mapping */
+    ClusterNetId clk_net = ClusterNetId::INVALID();
+    if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
+      clk_net = tree2clk_pin_map.at(ipin);
+    }
+    /* Unused clock pins require no routing when unused spines are disabled */
+    if (disable_unused_spines && !clk_net) {
+      continue;
+    }
+
+    /* Collect the clock nodes of each spine for this pin */
+    std::map<ClockSpineId, std::vector<RRNodeId>> spine_nodes;
+    for (auto ispine : clk_ntwk.spines(clk_tree)) {
+      spine_nodes[ispine] = find_clock_spine_nodes(
+        rr_graph, clk_rr_lookup, clk_ntwk, clk_tree, ispine, ipin);
+    }
+
+    /* Find the used part of each spine */
+    std::map<ClockSpineId, size_t> spine_num_used_coords;
+    std::set<std::array<size_t, 3>> tile_pin_demands;
+    if (disable_unused_spines) {
+      tile_pin_demands = clk_net_demands.at(clk_net);
+    }
+    for (auto ispine : clk_ntwk.spines(clk_tree)) {
+      if (disable_unused_spines) {
+        rec_find_spine_num_used_coordinates(spine_num_used_coords, rr_graph,
+                                            grids, spine_nodes,
+                                            tile_pin_demands, clk_ntwk, ispine);
+      } else {
+        spine_num_used_coords[ispine] = spine_nodes.at(ispine).size();
+      }
+    }
+
+    for (auto ispine : clk_ntwk.spines(clk_tree)) {
+      const std::vector<RRNodeId>& curr_spine_nodes = spine_nodes.at(ispine);
+      size_t num_used_coords = spine_num_used_coords.at(ispine);
+      if (0 == num_used_coords) {
+        VTR_LOGV(verbose, "Skip unused spine '%s'...\n",
+                 clk_ntwk.spine_name(ispine).c_str());
+        continue;
+      }
+      VTR_LOGV(verbose, "Routing spine '%s'...\n",
+               clk_ntwk.spine_name(ispine).c_str());
+      num_routed_spines++;
       /* Route the spine from starting point to ending point */
-      std::vector<vtr::Point<int>> spine_coords =
-        clk_ntwk.spine_coordinates(ispine);
       VTR_LOGV(verbose, "Routing backbone of spine '%s'...\n",
                clk_ntwk.spine_name(ispine).c_str());
-      for (size_t icoord = 0; icoord < spine_coords.size() - 1; ++icoord) {
-        vtr::Point<int> src_coord = spine_coords[icoord];
-        vtr::Point<int> des_coord = spine_coords[icoord + 1];
-        Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
-        Direction des_spine_direction = clk_ntwk.spine_direction(ispine);
-        ClockLevelId src_spine_level = clk_ntwk.spine_level(ispine);
-        ClockLevelId des_spine_level = clk_ntwk.spine_level(ispine);
-        RRNodeId src_node =
-          clk_rr_lookup.find_node(src_coord.x(), src_coord.y(), clk_tree,
-                                  src_spine_level, ipin, src_spine_direction);
-        RRNodeId des_node =
-          clk_rr_lookup.find_node(des_coord.x(), des_coord.y(), clk_tree,
-                                  des_spine_level, ipin, des_spine_direction);
-        VTR_ASSERT(rr_graph.valid_node(src_node));
-        VTR_ASSERT(rr_graph.valid_node(des_node));
-        vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
-                                                     src_node);
+      for (size_t icoord = 0; icoord < num_used_coords - 1; ++icoord) {
+        vpr_routing_annotation.set_rr_node_prev_node(
+          rr_graph, curr_spine_nodes[icoord + 1], curr_spine_nodes[icoord]);
       }
       /* Route the spine-to-spine switching points */
       VTR_LOGV(verbose, "Routing switch points of spine '%s'...\n",
                clk_ntwk.spine_name(ispine).c_str());
       for (ClockSwitchPointId switch_point_id :
            clk_ntwk.spine_switch_points(ispine)) {
-        vtr::Point<int> src_coord =
-          clk_ntwk.spine_switch_point(ispine, switch_point_id);
         ClockSpineId des_spine =
           clk_ntwk.spine_switch_point_tap(ispine, switch_point_id);
-        vtr::Point<int> des_coord = clk_ntwk.spine_start_point(des_spine);
-        Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
-        Direction des_spine_direction = clk_ntwk.spine_direction(des_spine);
-        ClockLevelId src_spine_level = clk_ntwk.spine_level(ispine);
-        ClockLevelId des_spine_level = clk_ntwk.spine_level(des_spine);
-        RRNodeId src_node =
-          clk_rr_lookup.find_node(src_coord.x(), src_coord.y(), clk_tree,
-                                  src_spine_level, ipin, src_spine_direction);
-        RRNodeId des_node =
-          clk_rr_lookup.find_node(des_coord.x(), des_coord.y(), clk_tree,
-                                  des_spine_level, ipin, des_spine_direction);
+        if (0 == spine_num_used_coords.at(des_spine)) {
+          continue;
+        }
+        vtr::Point<int> src_coord =
+          clk_ntwk.spine_switch_point(ispine, switch_point_id);
+        RRNodeId src_node = clk_rr_lookup.find_node(
+          src_coord.x(), src_coord.y(), clk_tree, clk_ntwk.spine_level(ispine),
+          ipin, clk_ntwk.spine_direction(ispine));
+        RRNodeId des_node = spine_nodes.at(des_spine).front();
         VTR_ASSERT(rr_graph.valid_node(src_node));
-        VTR_ASSERT(rr_graph.valid_node(des_node));
         vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
                                                      src_node);
-        /* It could happen that there is no net mapped some clock pin, skip the
-         * net mapping */
-        if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
-          vpr_routing_annotation.set_rr_node_net(src_node,
-                                                 tree2clk_pin_map.at(ipin));
-          vpr_routing_annotation.set_rr_node_net(des_node,
-                                                 tree2clk_pin_map.at(ipin));
+        if (clk_net) {
+          vpr_routing_annotation.set_rr_node_net(src_node, clk_net);
+          vpr_routing_annotation.set_rr_node_net(des_node, clk_net);
         }
       }
       /* Route the spine-to-IPIN connections (only for the last level) */
@@ -155,32 +320,34 @@ static int route_clock_tree_rr_graph(
         VTR_LOGV(verbose, "Routing clock taps of spine '%s'...\n",
                  clk_ntwk.spine_name(ispine).c_str());
         /* Connect to any fan-out node which is IPIN */
-        for (size_t icoord = 0; icoord < spine_coords.size(); ++icoord) {
-          vtr::Point<int> src_coord = spine_coords[icoord];
-          Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
-          ClockLevelId src_spine_level = clk_ntwk.spine_level(ispine);
-          RRNodeId src_node =
-            clk_rr_lookup.find_node(src_coord.x(), src_coord.y(), clk_tree,
-                                    src_spine_level, ipin, src_spine_direction);
+        for (size_t icoord = 0; icoord < num_used_coords; ++icoord) {
+          RRNodeId src_node = curr_spine_nodes[icoord];
           for (RREdgeId edge : rr_graph.edge_range(src_node)) {
             RRNodeId des_node = rr_graph.edge_sink_node(edge);
-            if (rr_graph.node_type(des_node) == IPIN) {
-              VTR_ASSERT(rr_graph.valid_node(src_node));
-              VTR_ASSERT(rr_graph.valid_node(des_node));
-              vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
-                                                           src_node);
-              if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
-                vpr_routing_annotation.set_rr_node_net(
-                  src_node, tree2clk_pin_map.at(ipin));
-                vpr_routing_annotation.set_rr_node_net(
-                  des_node, tree2clk_pin_map.at(ipin));
-              }
+            if (rr_graph.node_type(des_node) != IPIN) {
+              continue;
+            }
+            if (disable_unused_spines &&
+                !is_clock_tap_used(rr_graph, grids, des_node,
+                                   tile_pin_demands)) {
+              continue;
             }
+            VTR_ASSERT(rr_graph.valid_node(des_node));
+            vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
+                                                         src_node);
+            if (clk_net) {
+              vpr_routing_annotation.set_rr_node_net(src_node, clk_net);
+              vpr_routing_annotation.set_rr_node_net(des_node, clk_net);
+            }
+            num_routed_taps++;
           }
         }
       }
     }
   }
+  VTR_LOGV(verbose, "Routed %lu spines and %lu taps for clock tree '%s'\n",
+           num_routed_spines, num_routed_taps,
+           clk_ntwk.tree_name(clk_tree).c_str());
   return CMD_EXEC_SUCCESS;
 }
 
@@ -194,10 +361,12 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
                          const DeviceContext& vpr_device_ctx,
                          const AtomContext& atom_ctx,
                          const ClusteredNetlist& cluster_nlist,
+                         const PlacementContext& vpr_place_ctx,
                          const VprNetlistAnnotation& netlist_annotation,
                          const RRClockSpatialLookup& clk_rr_lookup,
                          const ClockNetwork& clk_ntwk,
                          const PinConstraints& pin_constraints,
+                         const bool& disable_unused_spines,
                          const bool& verbose) {
   vtr::ScopedStartFinishTimer timer(
     "Route programmable clock network based on routing resource graph");
@@ -249,11 +418,21 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
       return status;
     }
 
+    /* Find the tile pins requiring each clock net, which is used to skip
+     * unused spines and taps */
+    std::map<ClusterNetId, std::set<std::array<size_t, 3>>> clk_net_demands;
+    if (disable_unused_spines) {
+      build_clock_net_tile_pin_demands(clk_net_demands, vpr_device_ctx.grid,
+                                       vpr_place_ctx, cluster_nlist,
+                                       tree2clk_pin_map);
+    }
+
     VTR_LOGV(verbose, "Routing clock tree '%s'...\n",
              clk_ntwk.tree_name(itree).c_str());
     status = route_clock_tree_rr_graph(
-      vpr_routing_annotation, vpr_device_ctx.rr_graph, clk_rr_lookup,
-      tree2clk_pin_map, clk_ntwk, itree, verbose);
+      vpr_routing_annotation, vpr_device_ctx.rr_graph, vpr_device_ctx.grid,
+      clk_rr_lookup, tree2clk_pin_map, clk_net_demands, clk_ntwk, itree,
+      disable_unused_spines, verbose);
     if (status == CMD_EXEC_FATAL_ERROR) {
       return status;
     }
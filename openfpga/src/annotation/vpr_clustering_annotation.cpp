@@ -52,6 +52,20 @@ PhysicalPb VprClusteringAnnotation::physical_pb(
   return physical_pbs_.at(block_id);
 }
 
+MemoryUsage VprClusteringAnnotation::memory_usage() const {
+  MemoryUsage usage("VprClusteringAnnotation");
+  usage.add_child(container_memory_usage("net_names", net_names_));
+  usage.add_child(
+    container_memory_usage("block_truth_tables", block_truth_tables_));
+  MemoryUsage physical_pbs = container_memory_usage("physical_pbs",
+                                                    physical_pbs_);
+  for (const auto& physical_pb : physical_pbs_) {
+    physical_pbs.add_bytes(physical_pb.second.memory_usage().num_bytes());
+  }
+  usage.add_child(physical_pbs);
+  return usage;
+}
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
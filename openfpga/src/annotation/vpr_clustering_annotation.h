@@ -38,6 +38,8 @@ class VprClusteringAnnotation {
   bool is_truth_table_adapted(t_pb* pb) const;
   AtomNetlist::TruthTable truth_table(t_pb* pb) const;
   PhysicalPb physical_pb(const ClusterBlockId& block_id) const;
+  /* Estimate the heap memory of the annotation, including physical pbs */
+  MemoryUsage memory_usage() const;
 
  public: /* Public mutators */
   void rename_net(const ClusterBlockId& block_id, const int& pin_index,
@@ -21,155 +21,139 @@ VprDeviceAnnotation::VprDeviceAnnotation() { return; }
  ***********************************************************************/
 bool VprDeviceAnnotation::is_physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
+  auto it = physical_pb_types_.find(pb_type);
   if (it == physical_pb_types_.end()) {
     return false;
   }
   /* A physical pb_type should be mapped to itself! Otherwise, it is an
    * operating pb_type */
-  return pb_type == physical_pb_types_.at(pb_type);
+  return pb_type == it->second;
 }
 
 t_mode* VprDeviceAnnotation::physical_mode(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
+  auto it = physical_pb_modes_.find(pb_type);
   if (it == physical_pb_modes_.end()) {
     return nullptr;
   }
-  return physical_pb_modes_.at(pb_type);
+  return it->second;
 }
 
 t_pb_type* VprDeviceAnnotation::physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
+  auto it = physical_pb_types_.find(pb_type);
   if (it == physical_pb_types_.end()) {
     return nullptr;
   }
-  return physical_pb_types_.at(pb_type);
+  return it->second;
 }
 
 std::vector<t_port*> VprDeviceAnnotation::physical_pb_port(
   t_port* pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::vector<t_port*>>::const_iterator it =
-    physical_pb_ports_.find(pb_port);
+  auto it = physical_pb_ports_.find(pb_port);
   if (it == physical_pb_ports_.end()) {
     return std::vector<t_port*>();
   }
-  return physical_pb_ports_.at(pb_port);
+  return it->second;
 }
 
 BasicPort VprDeviceAnnotation::physical_pb_port_range(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
+  auto it = physical_pb_port_ranges_.find(operating_pb_port);
   if (it == physical_pb_port_ranges_.end()) {
     /* Return an invalid port. As such the port width will be 0, which is an
      * invalid value */
     return BasicPort();
   }
-  if (0 ==
-      physical_pb_port_ranges_.at(operating_pb_port).count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Return an invalid port. As such the port width will be 0, which is an
      * invalid value */
     return BasicPort();
   }
-  return physical_pb_port_ranges_.at(operating_pb_port).at(physical_pb_port);
+  return it_pin->second;
 }
 
 CircuitModelId VprDeviceAnnotation::pb_type_circuit_model(
   t_pb_type* physical_pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
+  auto it = pb_type_circuit_models_.find(physical_pb_type);
   if (it == pb_type_circuit_models_.end()) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return pb_type_circuit_models_.at(physical_pb_type);
+  return it->second;
 }
 
 CircuitModelId VprDeviceAnnotation::interconnect_circuit_model(
   t_interconnect* pb_interconnect) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
+  auto it = interconnect_circuit_models_.find(pb_interconnect);
   if (it == interconnect_circuit_models_.end()) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return interconnect_circuit_models_.at(pb_interconnect);
+  return it->second;
 }
 
 e_interconnect VprDeviceAnnotation::interconnect_physical_type(
   t_interconnect* pb_interconnect) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
+  auto it = interconnect_physical_types_.find(pb_interconnect);
   if (it == interconnect_physical_types_.end()) {
     /* Return an invalid interconnect type */
     return NUM_INTERC_TYPES;
   }
-  return interconnect_physical_types_.at(pb_interconnect);
+  return it->second;
 }
 
 CircuitPortId VprDeviceAnnotation::pb_circuit_port(t_port* pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
+  auto it = pb_circuit_ports_.find(pb_port);
   if (it == pb_circuit_ports_.end()) {
     /* Return an invalid circuit port id */
     return CircuitPortId::INVALID();
   }
-  return pb_circuit_ports_.at(pb_port);
+  return it->second;
 }
 
 std::vector<size_t> VprDeviceAnnotation::pb_type_mode_bits(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
+  auto it = pb_type_mode_bits_.find(pb_type);
   if (it == pb_type_mode_bits_.end()) {
     /* Return an empty vector */
     return std::vector<size_t>();
   }
-  return pb_type_mode_bits_.at(pb_type);
+  return it->second;
 }
 
 PbGraphNodeId VprDeviceAnnotation::pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_graph_node->pb_type);
+  auto it = pb_graph_node_unique_index_.find(pb_graph_node->pb_type);
   if (it == pb_graph_node_unique_index_.end()) {
     /* Invalid pb_type, return a null pointer */
     return PbGraphNodeId::INVALID();
   }
 
-  /* Try to find the pb_graph_node in the vector */
-  std::vector<t_pb_graph_node*>::const_iterator it_node =
-    std::find(pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin(),
-              pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end(),
-              pb_graph_node);
-  /* If it exists, return the index
+  /* Try to find the pb_graph_node in the reverse look-up
+   * If it exists, return the index
    * Otherwise, return an invalid id
    */
-  if (it_node == pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end()) {
+  auto it_node = pb_graph_node_unique_ids_.find(pb_graph_node);
+  if (it_node == pb_graph_node_unique_ids_.end()) {
     return PbGraphNodeId::INVALID();
   }
-  return PbGraphNodeId(
-    it_node - pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin());
+  return it_node->second;
 }
 
 t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
   t_pb_type* pb_type, const PbGraphNodeId& unique_index) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_type);
+  auto it = pb_graph_node_unique_index_.find(pb_type);
   if (it == pb_graph_node_unique_index_.end()) {
     /* Invalid pb_type, return a null pointer */
     return nullptr;
@@ -178,168 +162,151 @@ t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
    *  - Out of range: return a null pointer
    *  - In range: return the pointer
    */
-  if ((size_t)unique_index >
-      pb_graph_node_unique_index_.at(pb_type).size() - 1) {
+  if ((size_t)unique_index > it->second.size() - 1) {
     return nullptr;
   }
 
-  return pb_graph_node_unique_index_.at(pb_type)[size_t(unique_index)];
+  return it->second[size_t(unique_index)];
 }
 
 t_pb_graph_node* VprDeviceAnnotation::physical_pb_graph_node(
   t_pb_graph_node* pb_graph_node) const {
   /* Ensure that the pb_graph_node is in the list */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(pb_graph_node);
+  auto it = physical_pb_graph_nodes_.find(pb_graph_node);
   if (it == physical_pb_graph_nodes_.end()) {
     return nullptr;
   }
-  return physical_pb_graph_nodes_.at(pb_graph_node);
+  return it->second;
 }
 
 float VprDeviceAnnotation::physical_pb_type_index_factor(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
+  auto it = physical_pb_type_index_factors_.find(pb_type);
   if (it == physical_pb_type_index_factors_.end()) {
     /* Default value is 1 */
     return 1.;
   }
-  return physical_pb_type_index_factors_.at(pb_type);
+  return it->second;
 }
 
 int VprDeviceAnnotation::physical_pb_type_index_offset(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
+  auto it = physical_pb_type_index_offsets_.find(pb_type);
   if (it == physical_pb_type_index_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_type_index_offsets_.at(pb_type);
+  return it->second;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
+  auto it = physical_pb_pin_initial_offsets_.find(operating_pb_port);
   if (it == physical_pb_pin_initial_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_pin_initial_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_pin_initial_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return it_pin->second;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
+  auto it = physical_pb_pin_rotate_offsets_.find(operating_pb_port);
   if (it == physical_pb_pin_rotate_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return it_pin->second;
 }
 
 int VprDeviceAnnotation::physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
+  auto it = physical_pb_port_rotate_offsets_.find(operating_pb_port);
   if (it == physical_pb_port_rotate_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_port_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_port_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return it_pin->second;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_offsets_.find(operating_pb_port);
+  auto it = physical_pb_pin_offsets_.find(operating_pb_port);
   if (it == physical_pb_pin_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 ==
-      physical_pb_pin_offsets_.at(operating_pb_port).count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_pin_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return it_pin->second;
 }
 
 int VprDeviceAnnotation::physical_pb_port_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_offsets_.find(operating_pb_port);
+  auto it = physical_pb_port_offsets_.find(operating_pb_port);
   if (it == physical_pb_port_offsets_.end()) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 ==
-      physical_pb_port_offsets_.at(operating_pb_port).count(physical_pb_port)) {
+  auto it_pin = it->second.find(physical_pb_port);
+  if (it_pin == it->second.end()) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_port_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return it_pin->second;
 }
 
 t_pb_graph_pin* VprDeviceAnnotation::physical_pb_graph_pin(
   const t_pb_graph_pin* pb_graph_pin) const {
   /* Ensure that the pb_type is in the list */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(pb_graph_pin);
+  auto it = physical_pb_graph_pins_.find(pb_graph_pin);
   if (it == physical_pb_graph_pins_.end()) {
     return nullptr;
   }
-  return physical_pb_graph_pins_.at(pb_graph_pin);
+  return it->second;
 }
 
 CircuitModelId VprDeviceAnnotation::rr_switch_circuit_model(
   const RRSwitchId& rr_switch) const {
   /* Ensure that the rr_switch is in the list */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it == rr_switch_circuit_models_.end()) {
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_switch_circuit_models_.at(rr_switch);
+  return rr_switch_circuit_models_[rr_switch];
 }
 
 CircuitModelId VprDeviceAnnotation::rr_segment_circuit_model(
   const RRSegmentId& rr_segment) const {
-  /* Ensure that the rr_switch is in the list */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it == rr_segment_circuit_models_.end()) {
+  /* Ensure that the rr_segment is in the list */
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_segment_circuit_models_.at(rr_segment);
+  return rr_segment_circuit_models_[rr_segment];
 }
 
 ArchDirectId VprDeviceAnnotation::direct_annotation(
@@ -351,13 +318,17 @@ ArchDirectId VprDeviceAnnotation::direct_annotation(
   return direct_annotations_.at(direct);
 }
 
-LbRRGraph VprDeviceAnnotation::physical_lb_rr_graph(
+const LbRRGraph& VprDeviceAnnotation::physical_lb_rr_graph(
   t_pb_graph_node* pb_graph_head) const {
-  /* Ensure that the rr_switch is in the list */
-  if (0 == physical_lb_rr_graphs_.count(pb_graph_head)) {
-    return LbRRGraph();
+  /* Return a reference rather than a copy, as the graph is queried for each
+   * clustered block during repacking. An empty graph is returned when the
+   * pb_graph_head is not in the list */
+  static const LbRRGraph empty_lb_rr_graph;
+  auto it = physical_lb_rr_graphs_.find(pb_graph_head);
+  if (it == physical_lb_rr_graphs_.end()) {
+    return empty_lb_rr_graph;
   }
-  return physical_lb_rr_graphs_.at(pb_graph_head);
+  return it->second;
 }
 
 BasicPort VprDeviceAnnotation::physical_tile_pin_port_info(
@@ -446,14 +417,67 @@ int VprDeviceAnnotation::physical_tile_z_to_start_pin_index(
   return pin_search_result->second;
 }
 
+MemoryUsage VprDeviceAnnotation::memory_usage() const {
+  MemoryUsage usage("VprDeviceAnnotation");
+  usage.add_child(MemoryUsage(
+    "pb_types",
+    heap_memory_usage(physical_pb_types_) +
+      heap_memory_usage(physical_pb_type_index_factors_) +
+      heap_memory_usage(physical_pb_type_index_offsets_) +
+      heap_memory_usage(physical_pb_modes_) +
+      heap_memory_usage(pb_type_circuit_models_) +
+      heap_memory_usage(pb_type_mode_bits_),
+    physical_pb_types_.size()));
+  usage.add_child(
+    MemoryUsage("interconnects",
+                heap_memory_usage(interconnect_circuit_models_) +
+                  heap_memory_usage(interconnect_physical_types_),
+                interconnect_circuit_models_.size()));
+  usage.add_child(MemoryUsage(
+    "pb_ports",
+    heap_memory_usage(physical_pb_ports_) +
+      heap_memory_usage(physical_pb_pin_initial_offsets_) +
+      heap_memory_usage(physical_pb_pin_rotate_offsets_) +
+      heap_memory_usage(physical_pb_port_rotate_offsets_) +
+      heap_memory_usage(physical_pb_port_offsets_) +
+      heap_memory_usage(physical_pb_pin_offsets_) +
+      heap_memory_usage(physical_pb_port_ranges_) +
+      heap_memory_usage(pb_circuit_ports_),
+    physical_pb_ports_.size()));
+  usage.add_child(MemoryUsage(
+    "pb_graph",
+    heap_memory_usage(pb_graph_node_unique_index_) +
+      heap_memory_usage(pb_graph_node_unique_ids_) +
+      heap_memory_usage(physical_pb_graph_nodes_) +
+      heap_memory_usage(physical_pb_graph_pins_),
+    pb_graph_node_unique_ids_.size()));
+  usage.add_child(MemoryUsage(
+    "routing", heap_memory_usage(rr_switch_circuit_models_) +
+                 heap_memory_usage(rr_segment_circuit_models_) +
+                 heap_memory_usage(direct_annotations_)));
+  /* Each physical LbRRGraph is a copy owned by the annotation */
+  MemoryUsage& lb_rr_graph_usage = usage.add_child(
+    container_memory_usage("lb_rr_graphs", physical_lb_rr_graphs_));
+  for (const auto& lb_rr_graph : physical_lb_rr_graphs_) {
+    lb_rr_graph_usage.add_bytes(lb_rr_graph.second.memory_usage().num_bytes());
+  }
+  usage.add_child(MemoryUsage(
+    "physical_tiles",
+    heap_memory_usage(physical_tile_pin2port_info_map_) +
+      heap_memory_usage(physical_tile_pin_subtile_indices_) +
+      heap_memory_usage(physical_tile_z_to_subtile_indices_) +
+      heap_memory_usage(physical_tile_z_to_start_pin_indices_),
+    physical_tile_pin2port_info_map_.size()));
+  return usage;
+}
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
 void VprDeviceAnnotation::add_pb_type_physical_mode(t_pb_type* pb_type,
                                                     t_mode* physical_mode) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
+  auto it = physical_pb_modes_.find(pb_type);
   if (it != physical_pb_modes_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between pb_type '%s' and it physical mode "
@@ -467,8 +491,7 @@ void VprDeviceAnnotation::add_pb_type_physical_mode(t_pb_type* pb_type,
 void VprDeviceAnnotation::add_physical_pb_type(t_pb_type* operating_pb_type,
                                                t_pb_type* physical_pb_type) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(operating_pb_type);
+  auto it = physical_pb_types_.find(operating_pb_type);
   if (it != physical_pb_types_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
@@ -491,8 +514,7 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
   VTR_ASSERT((size_t)operating_pb_port->num_pins >= port_range.get_width());
 
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
+  auto it = physical_pb_port_ranges_.find(operating_pb_port);
   if ((it != physical_pb_port_ranges_.end()) &&
       (0 <
        physical_pb_port_ranges_[operating_pb_port].count(physical_pb_port))) {
@@ -509,8 +531,7 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
 void VprDeviceAnnotation::add_pb_type_circuit_model(
   t_pb_type* physical_pb_type, const CircuitModelId& circuit_model) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
+  auto it = pb_type_circuit_models_.find(physical_pb_type);
   if (it != pb_type_circuit_models_.end()) {
     VTR_LOG_WARN("Override the circuit model for physical pb_type '%s'!\n",
                  physical_pb_type->name);
@@ -522,8 +543,7 @@ void VprDeviceAnnotation::add_pb_type_circuit_model(
 void VprDeviceAnnotation::add_interconnect_circuit_model(
   t_interconnect* pb_interconnect, const CircuitModelId& circuit_model) {
   /* Warn any override attempt */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
+  auto it = interconnect_circuit_models_.find(pb_interconnect);
   if (it != interconnect_circuit_models_.end()) {
     VTR_LOG_WARN("Override the circuit model for interconnect '%s'!\n",
                  pb_interconnect->name);
@@ -535,8 +555,7 @@ void VprDeviceAnnotation::add_interconnect_circuit_model(
 void VprDeviceAnnotation::add_interconnect_physical_type(
   t_interconnect* pb_interconnect, const e_interconnect& physical_type) {
   /* Warn any override attempt */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
+  auto it = interconnect_physical_types_.find(pb_interconnect);
   if (it != interconnect_physical_types_.end()) {
     VTR_LOG_WARN("Override the physical interconnect for interconnect '%s'!\n",
                  pb_interconnect->name);
@@ -548,8 +567,7 @@ void VprDeviceAnnotation::add_interconnect_physical_type(
 void VprDeviceAnnotation::add_pb_circuit_port(
   t_port* pb_port, const CircuitPortId& circuit_port) {
   /* Warn any override attempt */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
+  auto it = pb_circuit_ports_.find(pb_port);
   if (it != pb_circuit_ports_.end()) {
     VTR_LOG_WARN("Override the circuit port mapping for pb_type port '%s'!\n",
                  pb_port->name);
@@ -561,8 +579,7 @@ void VprDeviceAnnotation::add_pb_circuit_port(
 void VprDeviceAnnotation::add_pb_type_mode_bits(
   t_pb_type* pb_type, const std::vector<size_t>& mode_bits) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
+  auto it = pb_type_mode_bits_.find(pb_type);
   if (it != pb_type_mode_bits_.end()) {
     VTR_LOG_WARN("Override the mode bits mapping for pb_type '%s'!\n",
                  pb_type->name);
@@ -573,15 +590,19 @@ void VprDeviceAnnotation::add_pb_type_mode_bits(
 
 void VprDeviceAnnotation::add_pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) {
-  pb_graph_node_unique_index_[pb_graph_node->pb_type].push_back(pb_graph_node);
+  std::vector<t_pb_graph_node*>& pb_graph_nodes =
+    pb_graph_node_unique_index_[pb_graph_node->pb_type];
+  /* Keep the first index if a pb_graph_node is added more than once */
+  pb_graph_node_unique_ids_.emplace(pb_graph_node,
+                                    PbGraphNodeId(pb_graph_nodes.size()));
+  pb_graph_nodes.push_back(pb_graph_node);
 }
 
 void VprDeviceAnnotation::add_physical_pb_graph_node(
   t_pb_graph_node* operating_pb_graph_node,
   t_pb_graph_node* physical_pb_graph_node) {
   /* Warn any override attempt */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(operating_pb_graph_node);
+  auto it = physical_pb_graph_nodes_.find(operating_pb_graph_node);
   if (it != physical_pb_graph_nodes_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_node '%s[%d]' and it "
@@ -598,8 +619,7 @@ void VprDeviceAnnotation::add_physical_pb_graph_node(
 void VprDeviceAnnotation::add_physical_pb_type_index_factor(
   t_pb_type* pb_type, const float& factor) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
+  auto it = physical_pb_type_index_factors_.find(pb_type);
   if (it != physical_pb_type_index_factors_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
@@ -613,8 +633,7 @@ void VprDeviceAnnotation::add_physical_pb_type_index_factor(
 void VprDeviceAnnotation::add_physical_pb_type_index_offset(t_pb_type* pb_type,
                                                             const int& offset) {
   /* Warn any override attempt */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
+  auto it = physical_pb_type_index_offsets_.find(pb_type);
   if (it != physical_pb_type_index_offsets_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
@@ -628,8 +647,7 @@ void VprDeviceAnnotation::add_physical_pb_type_index_offset(t_pb_type* pb_type,
 void VprDeviceAnnotation::add_physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
+  auto it = physical_pb_pin_initial_offsets_.find(operating_pb_port);
   if ((it != physical_pb_pin_initial_offsets_.end()) &&
       (0 < physical_pb_pin_initial_offsets_[operating_pb_port].count(
              physical_pb_port))) {
@@ -646,8 +664,7 @@ void VprDeviceAnnotation::add_physical_pb_pin_initial_offset(
 void VprDeviceAnnotation::add_physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
+  auto it = physical_pb_port_rotate_offsets_.find(operating_pb_port);
   if ((it != physical_pb_port_rotate_offsets_.end()) &&
       (0 < physical_pb_port_rotate_offsets_[operating_pb_port].count(
              physical_pb_port))) {
@@ -672,8 +689,7 @@ void VprDeviceAnnotation::accumulate_physical_pb_port_rotate_offset(
 void VprDeviceAnnotation::add_physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
+  auto it = physical_pb_pin_rotate_offsets_.find(operating_pb_port);
   if ((it != physical_pb_pin_rotate_offsets_.end()) &&
       (0 < physical_pb_pin_rotate_offsets_[operating_pb_port].count(
              physical_pb_port))) {
@@ -692,8 +708,7 @@ void VprDeviceAnnotation::add_physical_pb_graph_pin(
   const t_pb_graph_pin* operating_pb_graph_pin,
   t_pb_graph_pin* physical_pb_graph_pin) {
   /* Warn any override attempt */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(operating_pb_graph_pin);
+  auto it = physical_pb_graph_pins_.find(operating_pb_graph_pin);
   if (it != physical_pb_graph_pins_.end()) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_pin '%s' and it "
@@ -737,10 +752,14 @@ void VprDeviceAnnotation::add_physical_pb_graph_pin(
 
 void VprDeviceAnnotation::add_rr_switch_circuit_model(
   const RRSwitchId& rr_switch, const CircuitModelId& circuit_model) {
+  VTR_ASSERT(rr_switch);
+  /* Expand the look-up on demand */
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
+    rr_switch_circuit_models_.resize(size_t(rr_switch) + 1,
+                                     CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it != rr_switch_circuit_models_.end()) {
+  if (rr_switch_circuit_models_[rr_switch]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_switch '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -752,10 +771,14 @@ void VprDeviceAnnotation::add_rr_switch_circuit_model(
 
 void VprDeviceAnnotation::add_rr_segment_circuit_model(
   const RRSegmentId& rr_segment, const CircuitModelId& circuit_model) {
+  VTR_ASSERT(rr_segment);
+  /* Expand the look-up on demand */
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
+    rr_segment_circuit_models_.resize(size_t(rr_segment) + 1,
+                                      CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it != rr_segment_circuit_models_.end()) {
+  if (rr_segment_circuit_models_[rr_segment]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_segment '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -4,10 +4,11 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
-#include <map>
+#include <unordered_map>
 
 /* Header from vtrutil library */
 #include "vtr_strong_id.h"
+#include "vtr_vector.h"
 
 /* Header from archfpga library */
 #include "physical_types.h"
@@ -16,6 +17,7 @@
 #include "arch_direct.h"
 #include "circuit_library.h"
 #include "lb_rr_graph.h"
+#include "openfpga_memory_usage.h"
 #include "openfpga_port.h"
 
 /* Begin namespace openfpga */
@@ -88,7 +90,8 @@ class VprDeviceAnnotation {
   CircuitModelId rr_switch_circuit_model(const RRSwitchId& rr_switch) const;
   CircuitModelId rr_segment_circuit_model(const RRSegmentId& rr_segment) const;
   ArchDirectId direct_annotation(const size_t& direct) const;
-  LbRRGraph physical_lb_rr_graph(t_pb_graph_node* pb_graph_head) const;
+  const LbRRGraph& physical_lb_rr_graph(
+    t_pb_graph_node* pb_graph_head) const;
   BasicPort physical_tile_pin_port_info(t_physical_tile_type_ptr physical_tile,
                                         const int& pin_index) const;
   int physical_tile_pin_subtile_index(t_physical_tile_type_ptr physical_tile,
@@ -97,6 +100,8 @@ class VprDeviceAnnotation {
                                        const int& subtile_z) const;
   int physical_tile_z_to_start_pin_index(t_physical_tile_type_ptr physical_tile,
                                          const int& subtile_z) const;
+  /* Estimate the heap memory of the annotation, grouped by members */
+  MemoryUsage memory_usage() const;
 
  public: /* Public mutators */
   void add_pb_type_physical_mode(t_pb_type* pb_type, t_mode* physical_mode);
@@ -158,34 +163,36 @@ class VprDeviceAnnotation {
 
  private: /* Internal data */
   /* Pair a regular pb_type to its physical pb_type */
-  std::map<t_pb_type*, t_pb_type*> physical_pb_types_;
-  std::map<t_pb_type*, float> physical_pb_type_index_factors_;
-  std::map<t_pb_type*, int> physical_pb_type_index_offsets_;
+  std::unordered_map<t_pb_type*, t_pb_type*> physical_pb_types_;
+  std::unordered_map<t_pb_type*, float> physical_pb_type_index_factors_;
+  std::unordered_map<t_pb_type*, int> physical_pb_type_index_offsets_;
 
   /* Pair a physical mode for a pb_type
    * Note:
    * - the physical mode MUST be a child mode of the pb_type
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, t_mode*> physical_pb_modes_;
+  std::unordered_map<t_pb_type*, t_mode*> physical_pb_modes_;
 
   /* Pair a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, CircuitModelId> pb_type_circuit_models_;
+  std::unordered_map<t_pb_type*, CircuitModelId> pb_type_circuit_models_;
 
   /* Pair a interconnect of a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_interconnect*, CircuitModelId> interconnect_circuit_models_;
+  std::unordered_map<t_interconnect*, CircuitModelId>
+    interconnect_circuit_models_;
 
   /* Physical type of interconnect
    * Note:
    * - only applicable to an interconnect belongs to physical mode
    */
-  std::map<t_interconnect*, e_interconnect> interconnect_physical_types_;
+  std::unordered_map<t_interconnect*, e_interconnect>
+    interconnect_physical_types_;
 
   /* Pair a pb_type to its mode selection bits
    * - if the pb_type is a physical pb_type, the mode bits are the default mode
@@ -193,80 +200,97 @@ class VprDeviceAnnotation {
    * - if the pb_type is an operating pb_type, the mode bits will be applied
    *   when the operating pb_type is used by packer
    */
-  std::map<t_pb_type*, std::vector<size_t>> pb_type_mode_bits_;
+  std::unordered_map<t_pb_type*, std::vector<size_t>> pb_type_mode_bits_;
 
   /* Pair a pb_port to its physical pb_port
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
    */
-  std::map<t_port*, std::vector<t_port*>> physical_pb_ports_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_initial_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_rotate_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_rotate_offsets_;
+  std::unordered_map<t_port*, std::vector<t_port*>> physical_pb_ports_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, int>>
+    physical_pb_pin_initial_offsets_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, int>>
+    physical_pb_pin_rotate_offsets_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, int>>
+    physical_pb_port_rotate_offsets_;
 
   /* Accumulated offsets for a physical pb port, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_offsets_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, int>>
+    physical_pb_port_offsets_;
   /* Accumulated offsets for a physical pb_graph_pin, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_offsets_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, int>>
+    physical_pb_pin_offsets_;
 
   /* Pair a pb_port to its LSB and MSB of a physical pb_port
    * Note:
    * - the LSB and MSB MUST be in range of the physical pb_port
    */
-  std::map<t_port*, std::map<t_port*, BasicPort>> physical_pb_port_ranges_;
+  std::unordered_map<t_port*, std::unordered_map<t_port*, BasicPort>>
+    physical_pb_port_ranges_;
 
   /* Pair a pb_port to a circuit port in circuit model
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
    */
-  std::map<t_port*, CircuitPortId> pb_circuit_ports_;
+  std::unordered_map<t_port*, CircuitPortId> pb_circuit_ports_;
 
   /* Pair each pb_graph_node to an unique index in the graph
    * The unique index if the index in the array of t_pb_graph_node*
    */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>
+  std::unordered_map<t_pb_type*, std::vector<t_pb_graph_node*>>
     pb_graph_node_unique_index_;
+  /* Reverse look-up from a pb_graph_node to its unique index */
+  std::unordered_map<t_pb_graph_node*, PbGraphNodeId> pb_graph_node_unique_ids_;
 
   /* Pair a pb_graph_node to a physical pb_graph_node
    * Note:
    * - the pb_type of physical pb_graph_node must be a physical pb_type
    */
-  std::map<t_pb_graph_node*, t_pb_graph_node*> physical_pb_graph_nodes_;
+  std::unordered_map<t_pb_graph_node*, t_pb_graph_node*>
+    physical_pb_graph_nodes_;
 
   /* Pair a pb_graph_pin to a physical pb_graph_pin */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*> physical_pb_graph_pins_;
+  std::unordered_map<const t_pb_graph_pin*, t_pb_graph_pin*>
+    physical_pb_graph_pins_;
 
-  /* Pair a Routing Resource Switch (rr_switch) to a circuit model */
-  std::map<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
+  /* Pair a Routing Resource Switch (rr_switch) to a circuit model
+   * Indexed by rr_switch ids, which are dense; unannotated switches are
+   * INVALID
+   */
+  vtr::vector<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
 
-  /* Pair a Routing Segment (rr_segment) to a circuit model */
-  std::map<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
+  /* Pair a Routing Segment (rr_segment) to a circuit model
+   * Indexed by rr_segment ids, which are dense; unannotated segments are
+   * INVALID
+   */
+  vtr::vector<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
 
   /* Pair a direct connection (direct) to a annotation which contains circuit
    * model id */
-  std::map<size_t, ArchDirectId> direct_annotations_;
+  std::unordered_map<size_t, ArchDirectId> direct_annotations_;
 
   /* Logical type routing resource graphs built from physical modes */
-  std::map<t_pb_graph_node*, LbRRGraph> physical_lb_rr_graphs_;
+  std::unordered_map<t_pb_graph_node*, LbRRGraph> physical_lb_rr_graphs_;
 
   /* A fast look-up from pin index in physical tile to physical tile port */
-  std::map<t_physical_tile_type_ptr, std::map<int, BasicPort>>
+  std::unordered_map<t_physical_tile_type_ptr,
+                     std::unordered_map<int, BasicPort>>
     physical_tile_pin2port_info_map_;
   /* A fast look-up from pin index in physical tile to sub tile index */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
+  std::unordered_map<t_physical_tile_type_ptr, std::unordered_map<int, int>>
     physical_tile_pin_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index in sub tile array The instance index
    * starts from 0 to the sum of the capacity of each sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
+  std::unordered_map<t_physical_tile_type_ptr, std::unordered_map<int, int>>
     physical_tile_z_to_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index of the first pin in a given physcial
    * tile The instance index starts from 0 to the sum of the capacity of each
    * sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
+  std::unordered_map<t_physical_tile_type_ptr, std::unordered_map<int, int>>
     physical_tile_z_to_start_pin_indices_;
 };
 
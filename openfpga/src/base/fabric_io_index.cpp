@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Member functions for data structure FabricIoIndex
+ ******************************************************************************/
+#include "fabric_io_index.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+#include "module_manager_utils.h"
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+FabricIoIndex::FabricIoIndex(const ModuleManager& module_manager,
+                             const ModuleId& top_module,
+                             const IoLocationMap& io_location_map) {
+  /* Only mappable i/o ports can be considered. Remember the order of each
+   * port, which decides the priority of the ports at a coordinate */
+  std::map<std::string, std::pair<size_t, ModulePortId>> module_io_ports;
+  for (const ModuleManager::e_module_port_type& module_io_port_type :
+       MODULE_IO_PORT_TYPES) {
+    for (const ModulePortId& gpio_port_id :
+         module_manager.module_port_ids_by_type(top_module,
+                                                module_io_port_type)) {
+      if (false ==
+          module_manager.port_is_mappable_io(top_module, gpio_port_id)) {
+        continue;
+      }
+      size_t port_order = module_io_ports.size();
+      module_io_ports.emplace(
+        module_manager.module_port(top_module, gpio_port_id).get_name(),
+        std::make_pair(port_order, gpio_port_id));
+    }
+  }
+
+  for (const std::array<size_t, 3>& coord : io_location_map.io_coordinates()) {
+    std::vector<std::pair<size_t, IoPin>> ordered_pins;
+    for (const BasicPort& io_port : io_location_map.io_ports(coord)) {
+      auto result = module_io_ports.find(io_port.get_name());
+      if (result == module_io_ports.end()) {
+        continue;
+      }
+      /* First found, first kept */
+      size_t port_order = result->second.first;
+      if (ordered_pins.end() !=
+          std::find_if(ordered_pins.begin(), ordered_pins.end(),
+                       [&](const std::pair<size_t, IoPin>& ordered_pin) {
+                         return port_order == ordered_pin.first;
+                       })) {
+        continue;
+      }
+      IoPin io_pin;
+      io_pin.port = result->second.second;
+      io_pin.port_type = module_manager.port_type(top_module, io_pin.port);
+      io_pin.pin = io_port.get_lsb();
+      ordered_pins.push_back(std::make_pair(port_order, io_pin));
+    }
+    if (ordered_pins.empty()) {
+      continue;
+    }
+    std::sort(ordered_pins.begin(), ordered_pins.end(),
+              [](const std::pair<size_t, IoPin>& lhs,
+                 const std::pair<size_t, IoPin>& rhs) {
+                return lhs.first < rhs.first;
+              });
+    std::vector<IoPin>& io_pins = io_pins_[coord];
+    for (const std::pair<size_t, IoPin>& ordered_pin : ordered_pins) {
+      io_pins.push_back(ordered_pin.second);
+    }
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+std::pair<ModulePortId, size_t> FabricIoIndex::find_io_pin(
+  const size_t& x, const size_t& y, const size_t& z,
+  const ModuleManager::e_module_port_type& port_type) const {
+  std::array<size_t, 3> coord = {x, y, z};
+  auto result = io_pins_.find(coord);
+  if (result != io_pins_.end()) {
+    for (const IoPin& io_pin : result->second) {
+      if ((ModuleManager::MODULE_GPIO_PORT == io_pin.port_type) ||
+          (port_type == io_pin.port_type)) {
+        return std::make_pair(io_pin.port, io_pin.pin);
+      }
+    }
+  }
+  return std::make_pair(ModulePortId::INVALID(), size_t(-1));
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,58 @@
+#ifndef FABRIC_IO_INDEX_H
+#define FABRIC_IO_INDEX_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "io_location_map.h"
+#include "module_manager.h"
+#include "openfpga_hash.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A lookup from the VPR coordinate [x][y][z] of an I/O to the mappable
+ * I/O ports of the top-level module and the pin index, which is built once
+ * from an I/O location map. It replaces a search through all the I/O ports
+ * of the top-level module for each I/O block of a netlist.
+ *
+ * Note:
+ * - The ports at a coordinate are kept in the order of the module ports,
+ *   i.e., GPIN, GPOUT and then GPIO ports
+ * - When a port is assigned more than once to a coordinate, the first
+ *   assignment is kept, as IoLocationMap::io_index() does
+ *******************************************************************/
+class FabricIoIndex {
+ public: /* Public constructor */
+  FabricIoIndex(const ModuleManager& module_manager, const ModuleId& top_module,
+                const IoLocationMap& io_location_map);
+
+ public: /* Public accessors */
+  /* Find the port and pin index which an I/O block at a coordinate is
+   * mapped to. A GPIO port is used if it comes first, otherwise the port
+   * must be in the given type, e.g., a GPIN port for an input pad.
+   * Return an invalid port if there is no such port */
+  std::pair<ModulePortId, size_t> find_io_pin(
+    const size_t& x, const size_t& y, const size_t& z,
+    const ModuleManager::e_module_port_type& port_type) const;
+
+ private: /* Internal data */
+  struct IoPin {
+    ModulePortId port;
+    ModuleManager::e_module_port_type port_type;
+    size_t pin;
+  };
+  std::unordered_map<std::array<size_t, 3>, std::vector<IoPin>,
+                     IndexTripleHash>
+    io_pins_;
+};
+
+} /* End namespace openfpga*/
+
+#endif
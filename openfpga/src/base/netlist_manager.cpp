@@ -105,6 +105,25 @@ std::vector<std::string> NetlistManager::netlist_preprocessing_flags(
   return flags;
 }
 
+MemoryUsage NetlistManager::memory_usage() const {
+  MemoryUsage usage("NetlistManager");
+  usage.add_child(MemoryUsage(
+    "netlists",
+    heap_memory_usage(netlist_ids_) + heap_memory_usage(netlist_names_) +
+      heap_memory_usage(netlist_types_) +
+      heap_memory_usage(included_module_ids_) +
+      heap_memory_usage(included_preprocessing_flag_ids_),
+    netlist_ids_.size()));
+  usage.add_child(MemoryUsage("preprocessing_flags",
+                              heap_memory_usage(preprocessing_flag_ids_) +
+                                heap_memory_usage(preprocessing_flag_names_),
+                              preprocessing_flag_ids_.size()));
+  usage.add_child(MemoryUsage("lookups",
+                              heap_memory_usage(name_id_map_) +
+                                heap_memory_usage(module_netlist_map_)));
+  return usage;
+}
+
 /******************************************************************************
  * Public mutators
  ******************************************************************************/
@@ -72,6 +72,8 @@ class NetlistManager {
                             const ModuleId& module) const;
   /* Find the netlist that a module belongs to */
   NetlistId find_module_netlist(const ModuleId& module) const;
+  /* Estimate the heap memory of the netlists */
+  MemoryUsage memory_usage() const;
 
  public: /* Public mutators */
   /* Add a netlist to the library */
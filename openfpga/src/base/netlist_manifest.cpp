@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Member functions for data structure NetlistManifest, and the functions
+ * to read and write manifest files
+ *
+ * A manifest file is a plain text file, e.g.,
+ *   openfpga_netlist_manifest 1
+ *   options 3f2a6c0e9b8d7a15
+ *   5c0d1e2f3a4b5c6d routing/sb_0__0_.v
+ *   ...
+ * where each line after the options is the content hash of a netlist
+ * followed by its name
+ ******************************************************************************/
+#include "netlist_manifest.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "command_exit_codes.h"
+#include "openfpga_digest.h"
+#include "vtr_log.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Header of manifest files. The version must be increased whenever the
+ * netlist writers change their outputs, so that old netlists are not reused */
+constexpr const char* NETLIST_MANIFEST_HEADER = "openfpga_netlist_manifest";
+constexpr size_t NETLIST_MANIFEST_VERSION = 1;
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+NetlistManifest::NetlistManifest(const std::string& options_hash)
+  : options_hash_(options_hash), num_reused_netlists_(0) {}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+const std::string& NetlistManifest::options_hash() const {
+  return options_hash_;
+}
+
+const std::map<std::string, std::string>& NetlistManifest::netlist_hashes()
+  const {
+  return netlist_hashes_;
+}
+
+bool NetlistManifest::is_netlist_up_to_date(
+  const std::string& netlist_name, const std::string& netlist_path,
+  const std::string& content_hash) const {
+  auto result = previous_netlist_hashes_.find(netlist_name);
+  if ((result == previous_netlist_hashes_.end()) ||
+      (result->second != content_hash)) {
+    return false;
+  }
+  /* The netlist may have been removed by users */
+  std::ifstream fp(netlist_path);
+  return fp.good();
+}
+
+size_t NetlistManifest::num_reused_netlists() const {
+  return num_reused_netlists_;
+}
+
+/**************************************************
+ * Public Mutators
+ *************************************************/
+void NetlistManifest::add_previous_netlist(const std::string& netlist_name,
+                                           const std::string& content_hash) {
+  previous_netlist_hashes_[netlist_name] = content_hash;
+}
+
+void NetlistManifest::add_netlist(const std::string& netlist_name,
+                                  const std::string& content_hash,
+                                  const bool& reused) {
+  netlist_hashes_[netlist_name] = content_hash;
+  if (reused) {
+    num_reused_netlists_++;
+  }
+}
+
+/**************************************************
+ * Readers and writers
+ *************************************************/
+void read_netlist_manifest(NetlistManifest& netlist_manifest,
+                           const std::string& fname) {
+  std::ifstream fp(fname);
+  if (!fp.good()) {
+    VTR_LOG("No netlist manifest '%s' from a previous run\n", fname.c_str());
+    return;
+  }
+
+  std::string header;
+  size_t version = 0;
+  std::string options_keyword;
+  std::string options_hash;
+  fp >> header >> version >> options_keyword >> options_hash;
+  if ((!fp) || (std::string(NETLIST_MANIFEST_HEADER) != header) ||
+      (NETLIST_MANIFEST_VERSION != version) ||
+      (std::string("options") != options_keyword)) {
+    VTR_LOG_WARN("Ignore netlist manifest '%s' in an unknown format\n",
+                 fname.c_str());
+    return;
+  }
+  if (netlist_manifest.options_hash() != options_hash) {
+    VTR_LOG("Netlist manifest '%s' was written with other options\n",
+            fname.c_str());
+    return;
+  }
+
+  std::string content_hash;
+  std::string netlist_name;
+  while (fp >> content_hash && std::getline(fp >> std::ws, netlist_name)) {
+    netlist_manifest.add_previous_netlist(netlist_name, content_hash);
+  }
+}
+
+int write_netlist_manifest(const NetlistManifest& netlist_manifest,
+                           const std::string& fname) {
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  check_file_stream(fname.c_str(), fp);
+
+  fp << NETLIST_MANIFEST_HEADER << " " << NETLIST_MANIFEST_VERSION << "\n";
+  fp << "options " << netlist_manifest.options_hash() << "\n";
+  for (const auto& netlist_hash : netlist_manifest.netlist_hashes()) {
+    fp << netlist_hash.second << " " << netlist_hash.first << "\n";
+  }
+
+  if (!fp.good()) {
+    VTR_LOG_ERROR("Failed to write netlist manifest '%s'!\n", fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  fp.close();
+  return CMD_EXEC_SUCCESS;
+}
+
+void remove_netlist_manifest(const std::string& fname) {
+  std::ifstream fp(fname);
+  if (!fp.good()) {
+    return;
+  }
+  fp.close();
+  if (0 != std::remove(fname.c_str())) {
+    VTR_LOG_WARN("Failed to remove netlist manifest '%s'\n", fname.c_str());
+  }
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,63 @@
+/******************************************************************************
+ * This file includes the data structure of the manifest of netlists, which
+ * records the content hash of each netlist written to an output directory.
+ * When the netlists are written again to the same directory, a netlist
+ * whose content hash is the same as in the manifest of the previous run
+ * does not need to be regenerated.
+ ******************************************************************************/
+#ifndef NETLIST_MANIFEST_H
+#define NETLIST_MANIFEST_H
+
+#include <map>
+#include <string>
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+class NetlistManifest {
+ public: /* Constructors */
+  /* The options hash covers the writer options which affect the content of
+   * all the netlists. Netlists written with other options are never reused */
+  explicit NetlistManifest(const std::string& options_hash);
+
+ public: /* Public accessors */
+  const std::string& options_hash() const;
+  /* Netlists of the current run, by name, and their content hashes */
+  const std::map<std::string, std::string>& netlist_hashes() const;
+  /* Find if a netlist was written with the same content hash in the
+   * previous run, and the file still exists at the given path */
+  bool is_netlist_up_to_date(const std::string& netlist_name,
+                             const std::string& netlist_path,
+                             const std::string& content_hash) const;
+  size_t num_reused_netlists() const;
+
+ public: /* Public mutators */
+  /* Record a netlist of the previous run */
+  void add_previous_netlist(const std::string& netlist_name,
+                            const std::string& content_hash);
+  /* Record a netlist of the current run, which is either written or reused */
+  void add_netlist(const std::string& netlist_name,
+                   const std::string& content_hash, const bool& reused);
+
+ private: /* Internal data */
+  std::string options_hash_;
+  std::map<std::string, std::string> previous_netlist_hashes_;
+  std::map<std::string, std::string> netlist_hashes_;
+  size_t num_reused_netlists_;
+};
+
+/* Load the netlists of a previous run from a manifest file. Nothing is
+ * loaded if the file does not exist, or was written with other options */
+void read_netlist_manifest(NetlistManifest& netlist_manifest,
+                           const std::string& fname);
+
+int write_netlist_manifest(const NetlistManifest& netlist_manifest,
+                           const std::string& fname);
+
+/* Remove a manifest file, if any, before its netlists are overwritten, so
+ * that an interrupted run does not leave a manifest of stale netlists */
+void remove_netlist_manifest(const std::string& fname);
+
+} /* end namespace openfpga */
+
+#endif
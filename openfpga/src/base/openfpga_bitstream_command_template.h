@@ -7,6 +7,7 @@
  * - repack : create physical pbs and redo packing
  *******************************************************************/
 #include "openfpga_bitstream_template.h"
+#include "openfpga_context_checkpoint_template.h"
 #include "openfpga_repack_template.h"
 #include "shell.h"
 
@@ -53,6 +54,80 @@ ShellCommandId add_repack_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: write_context_checkpoint
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_write_context_checkpoint_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("write_context_checkpoint");
+
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId opt_file =
+    shell_cmd.add_option("file", true, "file path to output the checkpoint");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'write_context_checkpoint' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd, "Write the results of repack and fix-ups to a checkpoint file",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_const_execute_function(
+    shell_cmd_id, write_context_checkpoint_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
+/********************************************************************
+ * - Add a command to Shell environment: read_context_checkpoint
+ * - Add associated options
+ * - Add command dependency
+ * - Add the commands whose results are restored by the command
+ *******************************************************************/
+template <class T>
+ShellCommandId add_read_context_checkpoint_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds,
+  const std::vector<ShellCommandId>& restored_cmds, const bool& hidden) {
+  Command shell_cmd("read_context_checkpoint");
+
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId opt_file =
+    shell_cmd.add_option("file", true, "file path to the checkpoint");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'read_context_checkpoint' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Restore the results of repack and fix-ups from a checkpoint file",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id,
+                                     read_context_checkpoint_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  /* Commands depending on the restored ones can run after this command */
+  shell.set_command_restores(shell_cmd_id, restored_cmds);
+
+  return shell_cmd_id;
+}
+
 /********************************************************************
  * - Add a command to Shell environment: build_architecture_bitstream
  * - Add associated options
@@ -136,6 +211,44 @@ ShellCommandId add_report_bitstream_distribution_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: diff_architecture_bitstream
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_diff_arch_bitstream_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("diff_architecture_bitstream");
+
+  /* Add an option '--reference' */
+  CommandOptionId opt_reference = shell_cmd.add_option(
+    "reference", false,
+    "file path to read the reference bitstream database to compare with");
+  shell_cmd.set_option_require_value(opt_reference, openfpga::OPT_STRING);
+
+  /* Add an option '--digest_file' */
+  CommandOptionId opt_digest_file = shell_cmd.add_option(
+    "digest_file", false, "file path to output the digest of the bitstream");
+  shell_cmd.set_option_require_value(opt_digest_file, openfpga::OPT_STRING);
+
+  /* Add command 'diff_architecture_bitstream' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Compare the fabric-independent bitstream database with a reference one "
+    "by hierarchical digests",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_const_execute_function(
+    shell_cmd_id, diff_architecture_bitstream_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 /********************************************************************
  * - Add a command to Shell environment: build_fabric_bitstream
  * - Add associated options
@@ -281,6 +394,34 @@ void add_bitstream_command_templates(openfpga::Shell<T>& shell,
   ShellCommandId shell_cmd_repack_id = add_repack_command_template(
     shell, openfpga_bitstream_cmd_class, cmd_dependency_repack, hidden);
 
+  /********************************
+   * Command 'write_context_checkpoint'
+   */
+  /* The 'write_context_checkpoint' command should NOT be executed before
+   * 'repack' */
+  std::vector<ShellCommandId> cmd_dependency_write_context_checkpoint;
+  cmd_dependency_write_context_checkpoint.push_back(shell_cmd_repack_id);
+  add_write_context_checkpoint_command_template(
+    shell, openfpga_bitstream_cmd_class,
+    cmd_dependency_write_context_checkpoint, hidden);
+
+  /********************************
+   * Command 'read_context_checkpoint'
+   */
+  /* The 'read_context_checkpoint' command should NOT be executed before
+   * 'build_fabric'. It restores the results of 'repack' and the fix-ups */
+  std::vector<ShellCommandId> cmd_dependency_read_context_checkpoint;
+  cmd_dependency_read_context_checkpoint.push_back(shell_cmd_build_fabric_id);
+  std::vector<ShellCommandId> cmd_restored_by_read_context_checkpoint;
+  cmd_restored_by_read_context_checkpoint.push_back(shell_cmd_repack_id);
+  cmd_restored_by_read_context_checkpoint.push_back(
+    shell.command(std::string("pb_pin_fixup")));
+  cmd_restored_by_read_context_checkpoint.push_back(
+    shell.command(std::string("lut_truth_table_fixup")));
+  add_read_context_checkpoint_command_template(
+    shell, openfpga_bitstream_cmd_class, cmd_dependency_read_context_checkpoint,
+    cmd_restored_by_read_context_checkpoint, hidden);
+
   /********************************
    * Command 'build_architecture_bitstream'
    */
@@ -305,6 +446,18 @@ void add_bitstream_command_templates(openfpga::Shell<T>& shell,
     shell, openfpga_bitstream_cmd_class,
     cmd_dependency_report_bitstream_distribution, hidden);
 
+  /********************************
+   * Command 'diff_architecture_bitstream'
+   */
+  /* The 'diff_architecture_bitstream' command should NOT be executed before
+   * 'build_architecture_bitstream' */
+  std::vector<ShellCommandId> cmd_dependency_diff_arch_bitstream;
+  cmd_dependency_diff_arch_bitstream.push_back(
+    shell_cmd_build_arch_bitstream_id);
+  add_diff_arch_bitstream_command_template(shell, openfpga_bitstream_cmd_class,
+                                           cmd_dependency_diff_arch_bitstream,
+                                           hidden);
+
   /********************************
    * Command 'build_fabric_bitstream'
    */
@@ -4,6 +4,7 @@
 /********************************************************************
  * This file includes functions to build bitstream database
  *******************************************************************/
+#include "bitstream_digest.h"
 #include "build_device_bitstream.h"
 #include "build_fabric_bitstream.h"
 #include "build_io_mapping_info.h"
@@ -223,6 +224,85 @@ int report_bitstream_distribution_template(const T& openfpga_ctx,
   return status;
 }
 
+/********************************************************************
+ * A wrapper function to compare the architecture bitstream with a
+ * reference one, and to write the digest of the architecture bitstream
+ *******************************************************************/
+template <class T>
+int diff_architecture_bitstream_template(const T& openfpga_ctx,
+                                         const Command& cmd,
+                                         const CommandContext& cmd_context) {
+  CommandOptionId opt_reference = cmd.option("reference");
+  CommandOptionId opt_digest_file = cmd.option("digest_file");
+
+  if ((false == cmd_context.option_enable(cmd, opt_reference)) &&
+      (false == cmd_context.option_enable(cmd, opt_digest_file))) {
+    VTR_LOG_ERROR(
+      "Expect at least one of the options '--reference' and "
+      "'--digest_file'!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  vtr::ScopedStartFinishTimer timer("Compute architecture bitstream digests");
+
+  const BitstreamManager& bitstream_manager = openfpga_ctx.bitstream_manager();
+  BitstreamBlockDigests block_digests =
+    build_bitstream_manager_block_digests(bitstream_manager);
+  VTR_LOG("Architecture bitstream digest: %016lx\n",
+          find_bitstream_manager_digest(bitstream_manager, block_digests));
+
+  if (true == cmd_context.option_enable(cmd, opt_digest_file)) {
+    std::string digest_fname = cmd_context.option_value(cmd, opt_digest_file);
+    create_directory(find_path_dir_name(digest_fname));
+    if (0 != write_bitstream_manager_digest(bitstream_manager, block_digests,
+                                            digest_fname)) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    VTR_LOG("Wrote architecture bitstream digest to file '%s'\n",
+            digest_fname.c_str());
+  }
+
+  if (false == cmd_context.option_enable(cmd, opt_reference)) {
+    return CMD_EXEC_SUCCESS;
+  }
+
+  BitstreamManager ref_bitstream_manager = read_xml_architecture_bitstream(
+    cmd_context.option_value(cmd, opt_reference).c_str());
+  BitstreamBlockDigests ref_block_digests =
+    build_bitstream_manager_block_digests(ref_bitstream_manager);
+
+  std::vector<BitstreamBlockDiff> diffs =
+    diff_bitstream_managers(ref_bitstream_manager, ref_block_digests,
+                            bitstream_manager, block_digests);
+  if (diffs.empty()) {
+    VTR_LOG("Architecture bitstream is the same as the reference '%s'\n",
+            cmd_context.option_value(cmd, opt_reference).c_str());
+    return CMD_EXEC_SUCCESS;
+  }
+
+  /* Differences are not fatal, so that the rest of a script can continue */
+  size_t num_diff_bits = 0;
+  for (const BitstreamBlockDiff& diff : diffs) {
+    num_diff_bits += diff.num_diff_bits;
+    if (BITSTREAM_DIFF_BITS == diff.type &&
+        diff.num_ref_bits == diff.num_curr_bits) {
+      VTR_LOG("[%s] %s: %lu of %lu bits differ\n",
+              BITSTREAM_DIFF_TYPE_STRING[diff.type], diff.path.c_str(),
+              diff.num_diff_bits, diff.num_curr_bits);
+    } else {
+      VTR_LOG("[%s] %s: %lu bits in reference, %lu bits in current\n",
+              BITSTREAM_DIFF_TYPE_STRING[diff.type], diff.path.c_str(),
+              diff.num_ref_bits, diff.num_curr_bits);
+    }
+  }
+  VTR_LOG_WARN(
+    "Found %lu different blocks (%lu bits differ in blocks of the same size) "
+    "compared to the reference '%s'\n",
+    diffs.size(), num_diff_bits,
+    cmd_context.option_value(cmd, opt_reference).c_str());
+  return CMD_EXEC_MINOR_ERROR;
+}
+
 } /* end namespace openfpga */
 
 #endif
@@ -95,8 +95,21 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     cmd.option("generate_random_fabric_key");
   CommandOptionId opt_write_fabric_key = cmd.option("write_fabric_key");
   CommandOptionId opt_load_fabric_key = cmd.option("load_fabric_key");
+  CommandOptionId opt_balance_config_regions =
+    cmd.option("balance_config_regions");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  /* Balanced regions are built from the default organization, which should
+   * not be overwritten by any fabric key */
+  if ((true == cmd_context.option_enable(cmd, opt_balance_config_regions)) &&
+      ((true == cmd_context.option_enable(cmd, opt_load_fabric_key)) ||
+       (true == cmd_context.option_enable(cmd, opt_gen_random_fabric_key)))) {
+    VTR_LOG_ERROR(
+      "Option '--balance_config_regions' cannot be used with "
+      "'--load_fabric_key' or '--generate_random_fabric_key'!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   if (true == cmd_context.option_enable(cmd, opt_compress_routing)) {
     compress_routing_hierarchy_template<T>(
       openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
@@ -131,6 +144,7 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     cmd_context.option_enable(cmd, opt_duplicate_grid_pin),
     predefined_fabric_key,
     cmd_context.option_enable(cmd, opt_gen_random_fabric_key),
+    cmd_context.option_enable(cmd, opt_balance_config_regions),
     cmd_context.option_enable(cmd, opt_verbose));
 
   /* If there is any error, final status cannot be overwritten by a success flag
@@ -0,0 +1,918 @@
+/********************************************************************
+ * This file includes functions to write and read checkpoints of the
+ * design-dependent annotations of OpenFPGA context, i.e., the results of
+ * repack and the fix-ups on pins and truth tables, so that the commands
+ * after repack can be rerun without redoing them.
+ *
+ * A checkpoint is a binary file, which starts with a signature, a format
+ * version, and the hashes of the design and the fabric it is created for.
+ * The annotations refer to VPR data structures by pointers, which are not
+ * stable between runs. Instead, they are stored by keys which only depend
+ * on the design and the fabric:
+ * - a pb_type or an interconnect is keyed by its index in a depth-first
+ *   walk through the pb_type hierarchy of all the logical block types
+ * - a pb of a clustered block is keyed by its index in a depth-first walk
+ *   through the pb tree of the block
+ * - a physical pb is keyed by its id, as physical pbs are allocated in a
+ *   deterministic order from the pb graph, and a pb_graph_pin by the
+ *   physical pb of its parent node and its index among the pins of the node
+ *
+ * Integers are stored in a variable-length encoding (LEB128), where small
+ * values, e.g., most of the ids, take only one byte. Ids are shifted by one,
+ * so that an invalid id is stored as zero.
+ *******************************************************************/
+#include "openfpga_context_checkpoint.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "command_exit_codes.h"
+#include "mux_bitstream_constants.h"
+#include "openfpga_digest.h"
+#include "openfpga_hash.h"
+#include "physical_pb_utils.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Signature of checkpoint files. The version must be increased whenever the
+ * format is changed, so that outdated checkpoints are rejected */
+constexpr const char* CONTEXT_CHECKPOINT_SIGNATURE = "OPENFPGA_CHECKPOINT";
+constexpr uint64_t CONTEXT_CHECKPOINT_VERSION = 3;
+
+/********************************************************************
+ * Encoders
+ *******************************************************************/
+static void write_checkpoint_integer(std::ostream& fp, uint64_t value) {
+  do {
+    unsigned char byte = value & 0x7f;
+    value >>= 7;
+    if (0 != value) {
+      byte |= 0x80;
+    }
+    fp.put(byte);
+  } while (0 != value);
+}
+
+static void write_checkpoint_string(std::ostream& fp, const std::string& str) {
+  write_checkpoint_integer(fp, str.size());
+  fp.write(str.data(), str.size());
+}
+
+template <typename ID>
+static void write_checkpoint_id(std::ostream& fp, const ID& id) {
+  write_checkpoint_integer(fp, id ? size_t(id) + 1 : 0);
+}
+
+static void write_checkpoint_truth_table(
+  std::ostream& fp, const AtomNetlist::TruthTable& truth_table) {
+  write_checkpoint_integer(fp, truth_table.size());
+  for (const auto& row : truth_table) {
+    write_checkpoint_integer(fp, row.size());
+    for (const vtr::LogicValue& value : row) {
+      write_checkpoint_integer(fp, size_t(value));
+    }
+  }
+}
+
+/********************************************************************
+ * Decoder, which remembers any failure, e.g., a truncated file, so that
+ * the callers only need to check once after a group of reads
+ *******************************************************************/
+class CheckpointReader {
+ public:
+  explicit CheckpointReader(std::istream& fp) : fp_(fp), valid_(true) {
+    /* Find the end of file, to bound the lengths of arrays */
+    std::streampos begin = fp_.tellg();
+    fp_.seekg(0, std::ios::end);
+    end_ = fp_.tellg();
+    fp_.seekg(begin);
+    valid_ = fp_.good() && (begin <= end_);
+  }
+
+  bool valid() const { return valid_; }
+
+  void invalidate() { valid_ = false; }
+
+  uint64_t read_integer() {
+    uint64_t value = 0;
+    for (size_t shift = 0; valid_ && shift < 64; shift += 7) {
+      int byte = fp_.get();
+      if (std::istream::traits_type::eof() == byte) {
+        break;
+      }
+      value |= uint64_t(byte & 0x7f) << shift;
+      if (0 == (byte & 0x80)) {
+        return value;
+      }
+    }
+    valid_ = false;
+    return 0;
+  }
+
+  /* Read the length of an array. Each element takes at least one byte, so a
+   * length beyond the end of file means a corrupted file, which is rejected
+   * before allocating the array */
+  uint64_t read_length() {
+    uint64_t length = read_integer();
+    if (!valid_ || uint64_t(end_ - fp_.tellg()) < length) {
+      valid_ = false;
+      return 0;
+    }
+    return length;
+  }
+
+  std::string read_string() {
+    uint64_t length = read_length();
+    if (!valid_) {
+      return std::string();
+    }
+    std::string str(length, '\0');
+    fp_.read(&str[0], length);
+    if (!fp_) {
+      valid_ = false;
+      return std::string();
+    }
+    return str;
+  }
+
+  /* Read an id, which must be invalid or less than the given bound */
+  template <typename ID>
+  ID read_id(const size_t& bound) {
+    uint64_t value = read_integer();
+    if (0 == value) {
+      return ID::INVALID();
+    }
+    if (bound < value) {
+      valid_ = false;
+      return ID::INVALID();
+    }
+    return ID(value - 1);
+  }
+
+  AtomNetlist::TruthTable read_truth_table() {
+    AtomNetlist::TruthTable truth_table(read_length());
+    for (auto& row : truth_table) {
+      if (!valid_) {
+        break;
+      }
+      row.resize(read_length());
+      for (vtr::LogicValue& value : row) {
+        value = static_cast<vtr::LogicValue>(read_integer());
+      }
+    }
+    return truth_table;
+  }
+
+ private:
+  std::istream& fp_;
+  std::streampos end_;
+  bool valid_;
+};
+
+/********************************************************************
+ * Keys of VPR data structures
+ *******************************************************************/
+static void rec_collect_checkpoint_pb_types(
+  t_pb_type* pb_type, std::vector<t_pb_type*>& pb_types,
+  std::vector<t_interconnect*>& interconnects) {
+  pb_types.push_back(pb_type);
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    t_mode* mode = &(pb_type->modes[imode]);
+    for (int iinterc = 0; iinterc < mode->num_interconnect; ++iinterc) {
+      interconnects.push_back(&(mode->interconnect[iinterc]));
+    }
+    for (int ichild = 0; ichild < mode->num_pb_type_children; ++ichild) {
+      rec_collect_checkpoint_pb_types(&(mode->pb_type_children[ichild]),
+                                      pb_types, interconnects);
+    }
+  }
+}
+
+static void collect_checkpoint_pb_types(
+  const DeviceContext& device_ctx, std::vector<t_pb_type*>& pb_types,
+  std::vector<t_interconnect*>& interconnects) {
+  for (const t_logical_block_type& lb_type : device_ctx.logical_block_types) {
+    if (nullptr == lb_type.pb_type) {
+      continue;
+    }
+    rec_collect_checkpoint_pb_types(lb_type.pb_type, pb_types, interconnects);
+  }
+}
+
+/* Visit the used pbs in the same way as the fix-up on truth tables */
+static void rec_collect_checkpoint_cluster_pbs(t_pb* pb,
+                                               std::vector<t_pb*>& pbs) {
+  pbs.push_back(pb);
+  t_pb_type* pb_type = pb->pb_graph_node->pb_type;
+  if ((nullptr == pb->child_pbs) || (0 == pb_type->num_modes)) {
+    return;
+  }
+  t_mode* mapped_mode = &(pb_type->modes[pb->mode]);
+  for (int ipb = 0; ipb < mapped_mode->num_pb_type_children; ++ipb) {
+    for (int jpb = 0; jpb < mapped_mode->pb_type_children[ipb].num_pb; ++jpb) {
+      if ((pb->child_pbs[ipb] != nullptr) &&
+          (pb->child_pbs[ipb][jpb].name != nullptr)) {
+        rec_collect_checkpoint_cluster_pbs(&(pb->child_pbs[ipb][jpb]), pbs);
+      }
+    }
+  }
+}
+
+static std::vector<t_pb*> collect_checkpoint_cluster_pbs(
+  const ClusteringContext& clustering_ctx, const ClusterBlockId& blk_id) {
+  std::vector<t_pb*> pbs;
+  rec_collect_checkpoint_cluster_pbs(clustering_ctx.clb_nlist.block_pb(blk_id),
+                                     pbs);
+  return pbs;
+}
+
+static std::vector<t_pb_graph_pin*> collect_checkpoint_pb_graph_pins(
+  const t_pb_graph_node* pb_graph_node) {
+  std::vector<t_pb_graph_pin*> pins;
+  for (int iport = 0; iport < pb_graph_node->num_input_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_input_pins[iport]; ++ipin) {
+      pins.push_back(&(pb_graph_node->input_pins[iport][ipin]));
+    }
+  }
+  for (int iport = 0; iport < pb_graph_node->num_output_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_output_pins[iport]; ++ipin) {
+      pins.push_back(&(pb_graph_node->output_pins[iport][ipin]));
+    }
+  }
+  for (int iport = 0; iport < pb_graph_node->num_clock_ports; ++iport) {
+    for (int ipin = 0; ipin < pb_graph_node->num_clock_pins[iport]; ++ipin) {
+      pins.push_back(&(pb_graph_node->clock_pins[iport][ipin]));
+    }
+  }
+  return pins;
+}
+
+static void write_checkpoint_pb_graph_pin(std::ostream& fp,
+                                          const PhysicalPb& phy_pb,
+                                          const t_pb_graph_pin* pin) {
+  PhysicalPbId owner = phy_pb.find_pb(pin->parent_node);
+  VTR_ASSERT(true == phy_pb.valid_pb_id(owner));
+  std::vector<t_pb_graph_pin*> pins =
+    collect_checkpoint_pb_graph_pins(pin->parent_node);
+  auto result = std::find(pins.begin(), pins.end(), pin);
+  VTR_ASSERT(result != pins.end());
+  write_checkpoint_id(fp, owner);
+  write_checkpoint_integer(fp, std::distance(pins.begin(), result));
+}
+
+static const t_pb_graph_pin* read_checkpoint_pb_graph_pin(
+  CheckpointReader& reader, const PhysicalPb& phy_pb) {
+  PhysicalPbId owner = reader.read_id<PhysicalPbId>(phy_pb.pbs().size());
+  uint64_t index = reader.read_integer();
+  if (!reader.valid() || !phy_pb.valid_pb_id(owner)) {
+    reader.invalidate();
+    return nullptr;
+  }
+  std::vector<t_pb_graph_pin*> pins =
+    collect_checkpoint_pb_graph_pins(phy_pb.pb_graph_node(owner));
+  if (pins.size() <= index) {
+    reader.invalidate();
+    return nullptr;
+  }
+  return pins[index];
+}
+
+/********************************************************************
+ * Hashes. The fabric hash covers the data which the keys refer to, i.e.,
+ * the routing resource graph and the pb_type hierarchy, while the design
+ * hash covers the netlists, the placement and the routing.
+ *******************************************************************/
+static uint64_t compute_checkpoint_fabric_hash(
+  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
+  const std::vector<t_pb_type*>& pb_types,
+  const std::vector<t_interconnect*>& interconnects) {
+  StableHash hash;
+  hash.add_integer(device_ctx.grid.width());
+  hash.add_integer(device_ctx.grid.height());
+
+  const RRGraphView& rr_graph = device_ctx.rr_graph;
+  hash.add_integer(rr_graph.nodes().size());
+  for (const RRNodeId& node : rr_graph.nodes()) {
+    hash.add_integer(size_t(rr_graph.node_type(node)));
+    hash.add_integer(rr_graph.node_xlow(node));
+    hash.add_integer(rr_graph.node_ylow(node));
+    hash.add_integer(rr_graph.node_xhigh(node));
+    hash.add_integer(rr_graph.node_yhigh(node));
+    hash.add_integer(rr_graph.node_ptc_num(node));
+    hash.add_integer(rr_graph.num_edges(node));
+  }
+
+  hash.add_integer(pb_types.size());
+  for (t_pb_type* pb_type : pb_types) {
+    hash.add_string(std::string(pb_type->name));
+    hash.add_integer(pb_type->num_modes);
+    t_mode* physical_mode = device_annotation.physical_mode(pb_type);
+    hash.add_integer(nullptr == physical_mode ? 0 : physical_mode->index + 1);
+  }
+  hash.add_integer(interconnects.size());
+  for (t_interconnect* interconnect : interconnects) {
+    hash.add_string(std::string(interconnect->name));
+  }
+  return hash.value();
+}
+
+static uint64_t compute_checkpoint_design_hash(
+  const AtomContext& atom_ctx, const ClusteringContext& clustering_ctx,
+  const PlacementContext& placement_ctx, const RoutingContext& routing_ctx) {
+  StableHash hash;
+  hash.add_integer(atom_ctx.nlist.blocks().size());
+  for (const AtomBlockId& blk : atom_ctx.nlist.blocks()) {
+    hash.add_string(atom_ctx.nlist.block_name(blk));
+  }
+  hash.add_integer(atom_ctx.nlist.nets().size());
+  for (const AtomNetId& net : atom_ctx.nlist.nets()) {
+    hash.add_string(atom_ctx.nlist.net_name(net));
+  }
+
+  const ClusteredNetlist& clb_nlist = clustering_ctx.clb_nlist;
+  hash.add_integer(clb_nlist.blocks().size());
+  for (const ClusterBlockId& blk : clb_nlist.blocks()) {
+    hash.add_string(clb_nlist.block_name(blk));
+    hash.add_string(std::string(clb_nlist.block_type(blk)->name));
+    const t_pl_loc& loc = placement_ctx.block_locs[blk].loc;
+    hash.add_integer(loc.x);
+    hash.add_integer(loc.y);
+    hash.add_integer(loc.sub_tile);
+  }
+  hash.add_integer(clb_nlist.nets().size());
+  for (const ClusterNetId& net : clb_nlist.nets()) {
+    hash.add_string(clb_nlist.net_name(net));
+  }
+
+  /* The routing annotation in the checkpoint is derived from the routing
+   * traces of VPR, which must be the same. Note that the routing annotation
+   * of the context is not hashed, as it is the one to be restored */
+  for (const ClusterNetId& net : clb_nlist.nets()) {
+    if (routing_ctx.trace.size() <= size_t(net)) {
+      hash.add_integer(0);
+      continue;
+    }
+    for (t_trace* tptr = routing_ctx.trace[net].head; tptr != nullptr;
+         tptr = tptr->next) {
+      hash.add_integer(size_t(tptr->index) + 1);
+      hash.add_integer(size_t(tptr->iswitch) + 1);
+    }
+    hash.add_integer(0);
+  }
+  return hash.value();
+}
+
+/********************************************************************
+ * Writers of each annotation
+ *******************************************************************/
+static void write_checkpoint_physical_pb(std::ostream& fp,
+                                         const PhysicalPb& phy_pb) {
+  write_checkpoint_integer(fp, phy_pb.pbs().size());
+  for (const PhysicalPbId& pb : phy_pb.pbs()) {
+    std::vector<AtomBlockId> atom_blocks = phy_pb.atom_blocks(pb);
+    write_checkpoint_integer(fp, atom_blocks.size());
+    for (const AtomBlockId& atom_blk : atom_blocks) {
+      write_checkpoint_id(fp, atom_blk);
+    }
+
+    std::map<const t_pb_graph_pin*, AtomNetId> pin_atom_nets =
+      phy_pb.pb_graph_pin_atom_nets(pb);
+    write_checkpoint_integer(fp, pin_atom_nets.size());
+    for (const auto& pin_atom_net : pin_atom_nets) {
+      write_checkpoint_pb_graph_pin(fp, phy_pb, pin_atom_net.first);
+      write_checkpoint_id(fp, pin_atom_net.second);
+    }
+
+    std::map<const t_pb_graph_pin*, bool> wire_lut_outputs =
+      phy_pb.wire_lut_outputs(pb);
+    write_checkpoint_integer(fp, wire_lut_outputs.size());
+    for (const auto& wire_lut_output : wire_lut_outputs) {
+      write_checkpoint_pb_graph_pin(fp, phy_pb, wire_lut_output.first);
+      write_checkpoint_integer(fp, wire_lut_output.second ? 1 : 0);
+    }
+
+    std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable> truth_tables =
+      phy_pb.truth_tables(pb);
+    write_checkpoint_integer(fp, truth_tables.size());
+    for (const auto& truth_table : truth_tables) {
+      write_checkpoint_pb_graph_pin(fp, phy_pb, truth_table.first);
+      write_checkpoint_truth_table(fp, truth_table.second);
+    }
+
+    std::vector<size_t> mode_bits = phy_pb.mode_bits(pb);
+    write_checkpoint_integer(fp, mode_bits.size());
+    for (const size_t& mode_bit : mode_bits) {
+      write_checkpoint_integer(fp, mode_bit);
+    }
+
+    write_checkpoint_string(fp, phy_pb.fixed_bitstream(pb));
+    write_checkpoint_integer(fp, phy_pb.fixed_bitstream_offset(pb));
+    write_checkpoint_string(fp, phy_pb.fixed_mode_select_bitstream(pb));
+    write_checkpoint_integer(fp, phy_pb.fixed_mode_select_bitstream_offset(pb));
+  }
+}
+
+static void write_checkpoint_clustering_annotation(
+  std::ostream& fp, const ClusteringContext& clustering_ctx,
+  const VprClusteringAnnotation& clustering_annotation) {
+  const ClusteredNetlist& clb_nlist = clustering_ctx.clb_nlist;
+  write_checkpoint_integer(fp, clb_nlist.blocks().size());
+  for (const ClusterBlockId& blk : clb_nlist.blocks()) {
+    write_checkpoint_id(fp, blk);
+
+    /* Nets renamed by the fix-up on pins */
+    std::vector<int> renamed_pins;
+    for (int ipin = 0; ipin < clb_nlist.block_type(blk)->pb_type->num_pins;
+         ++ipin) {
+      if (clustering_annotation.is_net_renamed(blk, ipin)) {
+        renamed_pins.push_back(ipin);
+      }
+    }
+    write_checkpoint_integer(fp, renamed_pins.size());
+    for (const int& ipin : renamed_pins) {
+      write_checkpoint_integer(fp, ipin);
+      write_checkpoint_id(fp, clustering_annotation.net(blk, ipin));
+    }
+
+    /* Truth tables adapted by the fix-up on LUTs */
+    std::vector<t_pb*> pbs =
+      collect_checkpoint_cluster_pbs(clustering_ctx, blk);
+    std::vector<size_t> adapted_pbs;
+    for (size_t ipb = 0; ipb < pbs.size(); ++ipb) {
+      if (clustering_annotation.is_truth_table_adapted(pbs[ipb])) {
+        adapted_pbs.push_back(ipb);
+      }
+    }
+    write_checkpoint_integer(fp, adapted_pbs.size());
+    for (const size_t& ipb : adapted_pbs) {
+      write_checkpoint_integer(fp, ipb);
+      write_checkpoint_truth_table(
+        fp, clustering_annotation.truth_table(pbs[ipb]));
+    }
+
+    /* Results of repack */
+    write_checkpoint_physical_pb(fp, clustering_annotation.physical_pb(blk));
+  }
+}
+
+static void write_checkpoint_routing_annotation(
+  std::ostream& fp, const DeviceContext& device_ctx,
+  const VprRoutingAnnotation& routing_annotation) {
+  const RRGraphView& rr_graph = device_ctx.rr_graph;
+  write_checkpoint_integer(fp, rr_graph.nodes().size());
+  for (const RRNodeId& node : rr_graph.nodes()) {
+    write_checkpoint_id(fp, routing_annotation.rr_node_net(node));
+    write_checkpoint_id(fp, routing_annotation.rr_node_prev_node(node));
+  }
+}
+
+static void write_checkpoint_bitstream_annotation(
+  std::ostream& fp, const std::vector<t_pb_type*>& pb_types,
+  const std::vector<t_interconnect*>& interconnects,
+  const VprBitstreamAnnotation& bitstream_annotation) {
+  /* Only the pb_types and interconnects which are annotated are stored */
+  std::vector<size_t> annotated_pb_types;
+  for (size_t ipb_type = 0; ipb_type < pb_types.size(); ++ipb_type) {
+    t_pb_type* pb_type = pb_types[ipb_type];
+    if ((VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES !=
+         bitstream_annotation.pb_type_bitstream_source(pb_type)) ||
+        (!bitstream_annotation.pb_type_bitstream_content(pb_type).empty()) ||
+        (0 != bitstream_annotation.pb_type_bitstream_offset(pb_type)) ||
+        (VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES !=
+         bitstream_annotation.pb_type_mode_select_bitstream_source(pb_type)) ||
+        (!bitstream_annotation.pb_type_mode_select_bitstream_content(pb_type)
+            .empty()) ||
+        (0 !=
+         bitstream_annotation.pb_type_mode_select_bitstream_offset(pb_type))) {
+      annotated_pb_types.push_back(ipb_type);
+    }
+  }
+  write_checkpoint_integer(fp, annotated_pb_types.size());
+  for (const size_t& ipb_type : annotated_pb_types) {
+    t_pb_type* pb_type = pb_types[ipb_type];
+    write_checkpoint_integer(fp, ipb_type);
+    write_checkpoint_integer(
+      fp, bitstream_annotation.pb_type_bitstream_source(pb_type));
+    write_checkpoint_string(
+      fp, bitstream_annotation.pb_type_bitstream_content(pb_type));
+    write_checkpoint_integer(
+      fp, bitstream_annotation.pb_type_bitstream_offset(pb_type));
+    write_checkpoint_integer(
+      fp, bitstream_annotation.pb_type_mode_select_bitstream_source(pb_type));
+    write_checkpoint_string(
+      fp, bitstream_annotation.pb_type_mode_select_bitstream_content(pb_type));
+    write_checkpoint_integer(
+      fp, bitstream_annotation.pb_type_mode_select_bitstream_offset(pb_type));
+  }
+
+  std::vector<size_t> annotated_interconnects;
+  for (size_t iinterc = 0; iinterc < interconnects.size(); ++iinterc) {
+    if (size_t(DEFAULT_PATH_ID) !=
+        bitstream_annotation.interconnect_default_path_id(
+          interconnects[iinterc])) {
+      annotated_interconnects.push_back(iinterc);
+    }
+  }
+  write_checkpoint_integer(fp, annotated_interconnects.size());
+  for (const size_t& iinterc : annotated_interconnects) {
+    write_checkpoint_integer(fp, iinterc);
+    write_checkpoint_integer(fp,
+                             bitstream_annotation.interconnect_default_path_id(
+                               interconnects[iinterc]));
+  }
+}
+
+/********************************************************************
+ * Readers of each annotation. Any inconsistency is reported through the
+ * reader, and the caller discards the partial results
+ *******************************************************************/
+static void read_checkpoint_physical_pb(
+  CheckpointReader& reader, const AtomContext& atom_ctx,
+  const ClusteringContext& clustering_ctx,
+  const VprDeviceAnnotation& device_annotation, const ClusterBlockId& blk,
+  VprClusteringAnnotation& clustering_annotation) {
+  uint64_t num_pbs = reader.read_integer();
+  if (!reader.valid() || 0 == num_pbs) {
+    return;
+  }
+
+  /* The physical pbs are allocated in the same order as repack */
+  PhysicalPb phy_pb;
+  alloc_physical_pb_from_pb_graph(
+    phy_pb, clustering_ctx.clb_nlist.block_type(blk)->pb_graph_head,
+    device_annotation);
+  if (phy_pb.pbs().size() != num_pbs) {
+    reader.invalidate();
+    return;
+  }
+
+  size_t num_atom_blocks = atom_ctx.nlist.blocks().size();
+  size_t num_atom_nets = atom_ctx.nlist.nets().size();
+  for (const PhysicalPbId& pb : phy_pb.pbs()) {
+    uint64_t num_pb_atom_blocks = reader.read_integer();
+    for (uint64_t iblk = 0; reader.valid() && iblk < num_pb_atom_blocks;
+         ++iblk) {
+      phy_pb.add_atom_block(pb, reader.read_id<AtomBlockId>(num_atom_blocks));
+    }
+
+    uint64_t num_pin_atom_nets = reader.read_integer();
+    for (uint64_t ipin = 0; reader.valid() && ipin < num_pin_atom_nets;
+         ++ipin) {
+      const t_pb_graph_pin* pin = read_checkpoint_pb_graph_pin(reader, phy_pb);
+      AtomNetId atom_net = reader.read_id<AtomNetId>(num_atom_nets);
+      if (reader.valid()) {
+        phy_pb.set_pb_graph_pin_atom_net(pb, pin, atom_net);
+      }
+    }
+
+    uint64_t num_wire_lut_outputs = reader.read_integer();
+    for (uint64_t ipin = 0; reader.valid() && ipin < num_wire_lut_outputs;
+         ++ipin) {
+      const t_pb_graph_pin* pin = read_checkpoint_pb_graph_pin(reader, phy_pb);
+      bool wire_lut_output = (0 != reader.read_integer());
+      if (reader.valid()) {
+        phy_pb.set_wire_lut_output(pb, pin, wire_lut_output);
+      }
+    }
+
+    uint64_t num_truth_tables = reader.read_integer();
+    for (uint64_t ipin = 0; reader.valid() && ipin < num_truth_tables;
+         ++ipin) {
+      const t_pb_graph_pin* pin = read_checkpoint_pb_graph_pin(reader, phy_pb);
+      AtomNetlist::TruthTable truth_table = reader.read_truth_table();
+      if (reader.valid()) {
+        phy_pb.set_truth_table(pb, pin, truth_table);
+      }
+    }
+
+    std::vector<size_t> mode_bits(reader.read_length());
+    for (size_t& mode_bit : mode_bits) {
+      mode_bit = reader.read_integer();
+    }
+    phy_pb.set_mode_bits(pb, mode_bits);
+
+    phy_pb.set_fixed_bitstream(pb, reader.read_string());
+    phy_pb.set_fixed_bitstream_offset(pb, reader.read_integer());
+    phy_pb.set_fixed_mode_select_bitstream(pb, reader.read_string());
+    phy_pb.set_fixed_mode_select_bitstream_offset(pb, reader.read_integer());
+    if (!reader.valid()) {
+      return;
+    }
+  }
+
+  clustering_annotation.add_physical_pb(blk, phy_pb);
+}
+
+static void read_checkpoint_clustering_annotation(
+  CheckpointReader& reader, const AtomContext& atom_ctx,
+  const ClusteringContext& clustering_ctx,
+  const VprDeviceAnnotation& device_annotation,
+  VprClusteringAnnotation& clustering_annotation) {
+  const ClusteredNetlist& clb_nlist = clustering_ctx.clb_nlist;
+  size_t num_blocks = clb_nlist.blocks().size();
+  size_t num_nets = clb_nlist.nets().size();
+  if (reader.read_integer() != num_blocks) {
+    reader.invalidate();
+    return;
+  }
+  for (size_t iblk = 0; reader.valid() && iblk < num_blocks; ++iblk) {
+    ClusterBlockId blk = reader.read_id<ClusterBlockId>(num_blocks);
+    if (!reader.valid() || !clb_nlist.valid_block_id(blk)) {
+      reader.invalidate();
+      return;
+    }
+
+    uint64_t num_renamed_pins = reader.read_integer();
+    uint64_t num_pins = clb_nlist.block_type(blk)->pb_type->num_pins;
+    for (uint64_t ipin = 0; reader.valid() && ipin < num_renamed_pins;
+         ++ipin) {
+      uint64_t pin = reader.read_integer();
+      ClusterNetId net = reader.read_id<ClusterNetId>(num_nets);
+      if (num_pins <= pin) {
+        reader.invalidate();
+      }
+      if (reader.valid()) {
+        clustering_annotation.rename_net(blk, pin, net);
+      }
+    }
+
+    uint64_t num_adapted_pbs = reader.read_integer();
+    std::vector<t_pb*> pbs =
+      collect_checkpoint_cluster_pbs(clustering_ctx, blk);
+    for (uint64_t iadapt = 0; reader.valid() && iadapt < num_adapted_pbs;
+         ++iadapt) {
+      uint64_t ipb = reader.read_integer();
+      AtomNetlist::TruthTable truth_table = reader.read_truth_table();
+      if (pbs.size() <= ipb) {
+        reader.invalidate();
+      }
+      if (reader.valid()) {
+        clustering_annotation.adapt_truth_table(pbs[ipb], truth_table);
+      }
+    }
+
+    if (reader.valid()) {
+      read_checkpoint_physical_pb(reader, atom_ctx, clustering_ctx,
+                                  device_annotation, blk,
+                                  clustering_annotation);
+    }
+  }
+}
+
+static void read_checkpoint_routing_annotation(
+  CheckpointReader& reader, const DeviceContext& device_ctx,
+  const ClusteringContext& clustering_ctx,
+  VprRoutingAnnotation& routing_annotation) {
+  const RRGraphView& rr_graph = device_ctx.rr_graph;
+  size_t num_nodes = rr_graph.nodes().size();
+  size_t num_nets = clustering_ctx.clb_nlist.nets().size();
+  if (reader.read_integer() != num_nodes) {
+    reader.invalidate();
+    return;
+  }
+  routing_annotation.init(rr_graph);
+  for (const RRNodeId& node : rr_graph.nodes()) {
+    ClusterNetId net = reader.read_id<ClusterNetId>(num_nets);
+    RRNodeId prev_node = reader.read_id<RRNodeId>(num_nodes);
+    if (!reader.valid()) {
+      return;
+    }
+    if (net) {
+      routing_annotation.set_rr_node_net(node, net);
+    }
+    if (prev_node) {
+      routing_annotation.set_rr_node_prev_node(rr_graph, node, prev_node);
+    }
+  }
+}
+
+static void read_checkpoint_bitstream_annotation(
+  CheckpointReader& reader, const std::vector<t_pb_type*>& pb_types,
+  const std::vector<t_interconnect*>& interconnects,
+  VprBitstreamAnnotation& bitstream_annotation) {
+  uint64_t num_annotated_pb_types = reader.read_integer();
+  for (uint64_t iannot = 0; reader.valid() && iannot < num_annotated_pb_types;
+       ++iannot) {
+    uint64_t ipb_type = reader.read_integer();
+    uint64_t source = reader.read_integer();
+    std::string content = reader.read_string();
+    uint64_t offset = reader.read_integer();
+    uint64_t mode_select_source = reader.read_integer();
+    std::string mode_select_content = reader.read_string();
+    uint64_t mode_select_offset = reader.read_integer();
+    if ((pb_types.size() <= ipb_type) ||
+        (VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES < source) ||
+        (VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES <
+         mode_select_source)) {
+      reader.invalidate();
+    }
+    if (!reader.valid()) {
+      return;
+    }
+
+    /* Only set the values which differ from the defaults, as the annotation
+     * was created */
+    t_pb_type* pb_type = pb_types[ipb_type];
+    if (VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES != source) {
+      bitstream_annotation.set_pb_type_bitstream_source(
+        pb_type,
+        static_cast<VprBitstreamAnnotation::e_bitstream_source_type>(source));
+    }
+    if (!content.empty()) {
+      bitstream_annotation.set_pb_type_bitstream_content(pb_type, content);
+    }
+    if (0 != offset) {
+      bitstream_annotation.set_pb_type_bitstream_offset(pb_type, offset);
+    }
+    if (VprBitstreamAnnotation::NUM_BITSTREAM_SOURCE_TYPES !=
+        mode_select_source) {
+      bitstream_annotation.set_pb_type_mode_select_bitstream_source(
+        pb_type, static_cast<VprBitstreamAnnotation::e_bitstream_source_type>(
+                   mode_select_source));
+    }
+    if (!mode_select_content.empty()) {
+      bitstream_annotation.set_pb_type_mode_select_bitstream_content(
+        pb_type, mode_select_content);
+    }
+    if (0 != mode_select_offset) {
+      bitstream_annotation.set_pb_type_mode_select_bitstream_offset(
+        pb_type, mode_select_offset);
+    }
+  }
+
+  uint64_t num_annotated_interconnects = reader.read_integer();
+  for (uint64_t iannot = 0;
+       reader.valid() && iannot < num_annotated_interconnects; ++iannot) {
+    uint64_t iinterc = reader.read_integer();
+    uint64_t default_path_id = reader.read_integer();
+    if (interconnects.size() <= iinterc) {
+      reader.invalidate();
+    }
+    if (!reader.valid()) {
+      return;
+    }
+    bitstream_annotation.set_interconnect_default_path_id(
+      interconnects[iinterc], default_path_id);
+  }
+}
+
+/********************************************************************
+ * Write the design-dependent annotations to a checkpoint file
+ *******************************************************************/
+int write_context_checkpoint(
+  const std::string& fname, const DeviceContext& device_ctx,
+  const AtomContext& atom_ctx, const ClusteringContext& clustering_ctx,
+  const PlacementContext& placement_ctx, const RoutingContext& routing_ctx,
+  const VprDeviceAnnotation& device_annotation,
+  const VprClusteringAnnotation& clustering_annotation,
+  const VprRoutingAnnotation& routing_annotation,
+  const VprBitstreamAnnotation& bitstream_annotation, const bool& verbose) {
+  std::string timer_message =
+    std::string("Write context checkpoint '") + fname + std::string("'");
+  vtr::ScopedStartFinishTimer timer(timer_message);
+
+  std::vector<t_pb_type*> pb_types;
+  std::vector<t_interconnect*> interconnects;
+  collect_checkpoint_pb_types(device_ctx, pb_types, interconnects);
+  uint64_t design_hash = compute_checkpoint_design_hash(
+    atom_ctx, clustering_ctx, placement_ctx, routing_ctx);
+  uint64_t fabric_hash = compute_checkpoint_fabric_hash(
+    device_ctx, device_annotation, pb_types, interconnects);
+
+  /* Create the directory if it does not exist */
+  std::string dir_path = format_dir_path(find_path_dir_name(fname));
+  create_directory(dir_path);
+
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc |
+                   std::fstream::binary);
+  check_file_stream(fname.c_str(), fp);
+
+  write_checkpoint_string(fp, std::string(CONTEXT_CHECKPOINT_SIGNATURE));
+  write_checkpoint_integer(fp, CONTEXT_CHECKPOINT_VERSION);
+  write_checkpoint_integer(fp, design_hash);
+  write_checkpoint_integer(fp, fabric_hash);
+
+  write_checkpoint_clustering_annotation(fp, clustering_ctx,
+                                         clustering_annotation);
+  write_checkpoint_routing_annotation(fp, device_ctx, routing_annotation);
+  write_checkpoint_bitstream_annotation(fp, pb_types, interconnects,
+                                        bitstream_annotation);
+
+  if (!fp.good()) {
+    VTR_LOG_ERROR("Failed to write context checkpoint '%s'!\n",
+                  fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  VTR_LOGV(verbose,
+           "Written checkpoint of %lu clustered blocks and %lu routing "
+           "resource nodes (%lu bytes)\n",
+           clustering_ctx.clb_nlist.blocks().size(),
+           device_ctx.rr_graph.nodes().size(), size_t(fp.tellp()));
+  fp.close();
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Restore the design-dependent annotations from a checkpoint file.
+ * The checkpoint must be created for the same design and fabric as
+ * the current context. The annotations are only overwritten when the
+ * whole checkpoint is read successfully
+ *******************************************************************/
+int read_context_checkpoint(const std::string& fname,
+                            const DeviceContext& device_ctx,
+                            const AtomContext& atom_ctx,
+                            const ClusteringContext& clustering_ctx,
+                            const PlacementContext& placement_ctx,
+                            const RoutingContext& routing_ctx,
+                            const VprDeviceAnnotation& device_annotation,
+                            VprClusteringAnnotation& clustering_annotation,
+                            VprRoutingAnnotation& routing_annotation,
+                            VprBitstreamAnnotation& bitstream_annotation,
+                            const bool& verbose) {
+  std::string timer_message =
+    std::string("Read context checkpoint '") + fname + std::string("'");
+  vtr::ScopedStartFinishTimer timer(timer_message);
+
+  std::fstream fp;
+  fp.open(fname, std::fstream::in | std::fstream::binary);
+  if (!valid_file_stream(fp)) {
+    VTR_LOG_ERROR("Failed to open context checkpoint '%s'!\n", fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  CheckpointReader reader(fp);
+
+  std::string signature = reader.read_string();
+  uint64_t version = reader.read_integer();
+  if (!reader.valid() ||
+      std::string(CONTEXT_CHECKPOINT_SIGNATURE) != signature ||
+      CONTEXT_CHECKPOINT_VERSION != version) {
+    VTR_LOG_ERROR(
+      "File '%s' is not a context checkpoint of this version of OpenFPGA!\n",
+      fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  std::vector<t_pb_type*> pb_types;
+  std::vector<t_interconnect*> interconnects;
+  collect_checkpoint_pb_types(device_ctx, pb_types, interconnects);
+  uint64_t design_hash = reader.read_integer();
+  uint64_t fabric_hash = reader.read_integer();
+  if (design_hash !=
+      compute_checkpoint_design_hash(atom_ctx, clustering_ctx, placement_ctx,
+                                     routing_ctx)) {
+    VTR_LOG_ERROR(
+      "Context checkpoint '%s' is created for another design, placement or "
+      "routing!\n",
+      fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  if (fabric_hash != compute_checkpoint_fabric_hash(device_ctx,
+                                                    device_annotation,
+                                                    pb_types, interconnects)) {
+    VTR_LOG_ERROR(
+      "Context checkpoint '%s' is created for another fabric or "
+      "architecture!\n",
+      fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  VprClusteringAnnotation restored_clustering_annotation;
+  VprRoutingAnnotation restored_routing_annotation;
+  VprBitstreamAnnotation restored_bitstream_annotation;
+  read_checkpoint_clustering_annotation(reader, atom_ctx, clustering_ctx,
+                                        device_annotation,
+                                        restored_clustering_annotation);
+  if (reader.valid()) {
+    read_checkpoint_routing_annotation(reader, device_ctx, clustering_ctx,
+                                       restored_routing_annotation);
+  }
+  if (reader.valid()) {
+    read_checkpoint_bitstream_annotation(reader, pb_types, interconnects,
+                                         restored_bitstream_annotation);
+  }
+  if (!reader.valid()) {
+    VTR_LOG_ERROR("Context checkpoint '%s' is truncated or corrupted!\n",
+                  fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  clustering_annotation = restored_clustering_annotation;
+  routing_annotation = restored_routing_annotation;
+  bitstream_annotation = restored_bitstream_annotation;
+
+  VTR_LOGV(verbose,
+           "Restored checkpoint of %lu clustered blocks and %lu routing "
+           "resource nodes\n",
+           clustering_ctx.clb_nlist.blocks().size(),
+           device_ctx.rr_graph.nodes().size());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,45 @@
+#ifndef OPENFPGA_CONTEXT_CHECKPOINT_H
+#define OPENFPGA_CONTEXT_CHECKPOINT_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "vpr_bitstream_annotation.h"
+#include "vpr_clustering_annotation.h"
+#include "vpr_context.h"
+#include "vpr_device_annotation.h"
+#include "vpr_routing_annotation.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+int write_context_checkpoint(
+  const std::string& fname, const DeviceContext& device_ctx,
+  const AtomContext& atom_ctx, const ClusteringContext& clustering_ctx,
+  const PlacementContext& placement_ctx, const RoutingContext& routing_ctx,
+  const VprDeviceAnnotation& device_annotation,
+  const VprClusteringAnnotation& clustering_annotation,
+  const VprRoutingAnnotation& routing_annotation,
+  const VprBitstreamAnnotation& bitstream_annotation, const bool& verbose);
+
+int read_context_checkpoint(const std::string& fname,
+                            const DeviceContext& device_ctx,
+                            const AtomContext& atom_ctx,
+                            const ClusteringContext& clustering_ctx,
+                            const PlacementContext& placement_ctx,
+                            const RoutingContext& routing_ctx,
+                            const VprDeviceAnnotation& device_annotation,
+                            VprClusteringAnnotation& clustering_annotation,
+                            VprRoutingAnnotation& routing_annotation,
+                            VprBitstreamAnnotation& bitstream_annotation,
+                            const bool& verbose);
+
+} /* end namespace openfpga */
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef OPENFPGA_CONTEXT_CHECKPOINT_TEMPLATE_H
+#define OPENFPGA_CONTEXT_CHECKPOINT_TEMPLATE_H
+
+/********************************************************************
+ * This file includes functions to write and read checkpoints of the
+ * post-repack annotations of OpenFPGA context
+ *******************************************************************/
+#include "command.h"
+#include "command_context.h"
+#include "command_exit_codes.h"
+#include "globals.h"
+#include "openfpga_context_checkpoint.h"
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A wrapper function to write the results of repack and the fix-ups
+ * to a checkpoint file
+ *******************************************************************/
+template <class T>
+int write_context_checkpoint_template(const T& openfpga_ctx,
+                                      const Command& cmd,
+                                      const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  VTR_ASSERT(true == cmd_context.option_enable(cmd, opt_file));
+
+  return write_context_checkpoint(
+    cmd_context.option_value(cmd, opt_file), g_vpr_ctx.device(),
+    g_vpr_ctx.atom(), g_vpr_ctx.clustering(), g_vpr_ctx.placement(),
+    g_vpr_ctx.routing(), openfpga_ctx.vpr_device_annotation(),
+    openfpga_ctx.vpr_clustering_annotation(),
+    openfpga_ctx.vpr_routing_annotation(),
+    openfpga_ctx.vpr_bitstream_annotation(),
+    cmd_context.option_enable(cmd, opt_verbose));
+}
+
+/********************************************************************
+ * A wrapper function to restore the results of repack and the fix-ups
+ * from a checkpoint file, in place of running them again
+ *******************************************************************/
+template <class T>
+int read_context_checkpoint_template(T& openfpga_ctx, const Command& cmd,
+                                     const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  VTR_ASSERT(true == cmd_context.option_enable(cmd, opt_file));
+
+  return read_context_checkpoint(
+    cmd_context.option_value(cmd, opt_file), g_vpr_ctx.device(),
+    g_vpr_ctx.atom(), g_vpr_ctx.clustering(), g_vpr_ctx.placement(),
+    g_vpr_ctx.routing(), openfpga_ctx.vpr_device_annotation(),
+    openfpga_ctx.mutable_vpr_clustering_annotation(),
+    openfpga_ctx.mutable_vpr_routing_annotation(),
+    openfpga_ctx.mutable_vpr_bitstream_annotation(),
+    cmd_context.option_enable(cmd, opt_verbose));
+}
+
+} /* end namespace openfpga */
+
+#endif
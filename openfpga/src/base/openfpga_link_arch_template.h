@@ -217,6 +217,8 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
 
   /* add an option '--pin_constraints_file in short '-pcf' */
   CommandOptionId opt_pcf = cmd.option("pin_constraints_file");
+  CommandOptionId opt_disable_unused_spines =
+    cmd.option("disable_unused_spines");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* If pin constraints are enabled by command options, read the file */
@@ -229,8 +231,9 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
   return route_clock_rr_graph(
     openfpga_ctx.mutable_vpr_routing_annotation(), g_vpr_ctx.device(),
     g_vpr_ctx.atom(), g_vpr_ctx.clustering().clb_nlist,
-    openfpga_ctx.vpr_netlist_annotation(), openfpga_ctx.clock_rr_lookup(),
-    openfpga_ctx.clock_arch(), pin_constraints,
+    g_vpr_ctx.placement(), openfpga_ctx.vpr_netlist_annotation(),
+    openfpga_ctx.clock_rr_lookup(), openfpga_ctx.clock_arch(), pin_constraints,
+    cmd_context.option_enable(cmd, opt_disable_unused_spines),
     cmd_context.option_enable(cmd, opt_verbose));
 }
 
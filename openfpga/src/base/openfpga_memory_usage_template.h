@@ -0,0 +1,94 @@
+#ifndef OPENFPGA_MEMORY_USAGE_TEMPLATE_H
+#define OPENFPGA_MEMORY_USAGE_TEMPLATE_H
+/********************************************************************
+ * This file includes functions to report the memory usage of the
+ * data structures in OpenFPGA context
+ *******************************************************************/
+#include <fstream>
+#include <sstream>
+
+#include "command.h"
+#include "command_context.h"
+#include "command_exit_codes.h"
+#include "openfpga_digest.h"
+#include "openfpga_memory_usage.h"
+#include "openfpga_name_pool.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * Report the estimated heap memory of each member of OpenFPGA context,
+ * as a tree in either text or JSON format.
+ * The report is outputted to a file if specified, otherwise to the log
+ *******************************************************************/
+template <class T>
+int report_memory_usage_template(const T& openfpga_ctx, const Command& cmd,
+                                 const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_format = cmd.option("format");
+
+  std::string format("text");
+  if (true == cmd_context.option_enable(cmd, opt_format)) {
+    format = cmd_context.option_value(cmd, opt_format);
+  }
+  if ((std::string("text") != format) && (std::string("json") != format)) {
+    VTR_LOG_ERROR("Invalid format '%s'! Expect [text|json]\n",
+                  format.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  vtr::ScopedStartFinishTimer timer("Report memory usage");
+
+  MemoryUsage usage("OpenfpgaContext");
+  auto add_member = [&usage](const std::string& name, MemoryUsage member) {
+    member.set_name(name);
+    usage.add_child(member);
+  };
+  add_member("module_graph", openfpga_ctx.module_graph().memory_usage());
+  add_member("bitstream_manager",
+             openfpga_ctx.bitstream_manager().memory_usage());
+  add_member("fabric_bitstream",
+             openfpga_ctx.fabric_bitstream().memory_usage());
+  add_member("device_rr_gsb", openfpga_ctx.device_rr_gsb().memory_usage());
+  add_member("mux_lib", openfpga_ctx.mux_lib().memory_usage());
+  add_member("vpr_device_annotation",
+             openfpga_ctx.vpr_device_annotation().memory_usage());
+  add_member("vpr_clustering_annotation",
+             openfpga_ctx.vpr_clustering_annotation().memory_usage());
+  add_member("verilog_netlists",
+             openfpga_ctx.verilog_netlists().memory_usage());
+  add_member("spice_netlists", openfpga_ctx.spice_netlists().memory_usage());
+  add_member("clock_rr_lookup", openfpga_ctx.clock_rr_lookup().memory_usage());
+  /* Names of the module graph are interned in the global pool */
+  add_member("name_pool", global_name_pool().memory_usage());
+
+  std::stringstream report;
+  if (std::string("json") == format) {
+    print_memory_usage_json(report, usage);
+  } else {
+    print_memory_usage_text(report, usage);
+  }
+
+  if (false == cmd_context.option_enable(cmd, opt_file)) {
+    VTR_LOG("%s", report.str().c_str());
+    return CMD_EXEC_SUCCESS;
+  }
+
+  std::string fname = cmd_context.option_value(cmd, opt_file);
+  create_directory(format_dir_path(find_path_dir_name(fname)));
+  std::fstream fp;
+  fp.open(fname, std::fstream::out | std::fstream::trunc);
+  check_file_stream(fname.c_str(), fp);
+  fp << report.str();
+  fp.close();
+  VTR_LOG("Wrote memory usage report to '%s'\n", fname.c_str());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
+
+#endif
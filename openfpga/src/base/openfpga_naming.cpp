@@ -7,6 +7,10 @@
  ********************************************************************/
 #include "openfpga_naming.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include "circuit_library_utils.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_side_manager.h"
@@ -187,6 +191,20 @@ std::string generate_memory_decoder_with_data_in_subckt_name(
   return subckt_name;
 }
 
+/************************************************
+ * Generate the module name of a decoder with an address mask
+ * for memories
+ ***********************************************/
+std::string generate_memory_decoder_with_addr_mask_subckt_name(
+  const size_t& addr_size, const size_t& data_size) {
+  std::string subckt_name = "decoder_with_addr_mask_";
+  subckt_name += std::to_string(addr_size);
+  subckt_name += "to";
+  subckt_name += std::to_string(data_size);
+
+  return subckt_name;
+}
+
 /************************************************
  * Generate the module name of a routing track wire
  ***********************************************/
@@ -487,14 +505,53 @@ std::string generate_routing_track_middle_output_port_name(
   return port_name;
 }
 
+/*********************************************************************
+ * Find the interned name of a routing block module with a given kind and
+ * coordinate. The name is created by the given generator and interned in
+ * the global name pool only at the first request, so that the same name
+ * is not built again when the routing blocks are looked up many times,
+ * e.g., when building the top-level module
+ *********************************************************************/
+template <typename NameGenerator>
+static NameId find_routing_block_module_name_id(
+  const t_rr_type& kind, const vtr::Point<size_t>& coordinate,
+  const NameGenerator& generate_name) {
+  static std::mutex mutex;
+  static std::map<std::tuple<int, size_t, size_t>, NameId> name_ids;
+
+  std::tuple<int, size_t, size_t> key(int(kind), coordinate.x(),
+                                      coordinate.y());
+  std::lock_guard<std::mutex> lock(mutex);
+  auto result = name_ids.find(key);
+  if (result != name_ids.end()) {
+    return result->second;
+  }
+  NameId name_id = global_name_pool().intern(generate_name());
+  name_ids[key] = name_id;
+  return name_id;
+}
+
 /*********************************************************************
  * Generate the module name for a switch block with a given coordinate
  *********************************************************************/
 std::string generate_switch_block_module_name(
   const vtr::Point<size_t>& coordinate) {
-  return std::string("sb_" + std::to_string(coordinate.x()) +
-                     std::string("__") + std::to_string(coordinate.y()) +
-                     std::string("_"));
+  return global_name_pool().name(
+    generate_switch_block_module_name_id(coordinate));
+}
+
+/*********************************************************************
+ * Find the interned module name for a switch block with a given coordinate
+ * Switch blocks are keyed by the CHANX and CHANY kinds of connection
+ * blocks, so a kind which is never used by channels is given here
+ *********************************************************************/
+NameId generate_switch_block_module_name_id(
+  const vtr::Point<size_t>& coordinate) {
+  return find_routing_block_module_name_id(SOURCE, coordinate, [&]() {
+    return std::string("sb_" + std::to_string(coordinate.x()) +
+                       std::string("__") + std::to_string(coordinate.y()) +
+                       std::string("_"));
+  });
 }
 
 /*********************************************************************
@@ -502,22 +559,33 @@ std::string generate_switch_block_module_name(
  *********************************************************************/
 std::string generate_connection_block_module_name(
   const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate) {
-  std::string prefix("cb");
-  switch (cb_type) {
-    case CHANX:
-      prefix += std::string("x_");
-      break;
-    case CHANY:
-      prefix += std::string("y_");
-      break;
-    default:
-      VTR_LOG_ERROR("Invalid type of connection block!\n");
-      exit(1);
-  }
+  return global_name_pool().name(
+    generate_connection_block_module_name_id(cb_type, coordinate));
+}
 
-  return std::string(prefix + std::to_string(coordinate.x()) +
-                     std::string("__") + std::to_string(coordinate.y()) +
-                     std::string("_"));
+/*********************************************************************
+ * Find the interned module name for a connection block with a given
+ * coordinate
+ *********************************************************************/
+NameId generate_connection_block_module_name_id(
+  const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate) {
+  return find_routing_block_module_name_id(cb_type, coordinate, [&]() {
+    std::string prefix("cb");
+    switch (cb_type) {
+      case CHANX:
+        prefix += std::string("x_");
+        break;
+      case CHANY:
+        prefix += std::string("y_");
+        break;
+      default:
+        VTR_LOG_ERROR("Invalid type of connection block!\n");
+        exit(1);
+    }
+    return std::string(prefix + std::to_string(coordinate.x()) +
+                       std::string("__") + std::to_string(coordinate.y()) +
+                       std::string("_"));
+  });
 }
 
 /*********************************************************************
@@ -15,6 +15,7 @@
 #include "circuit_library.h"
 #include "device_grid.h"
 #include "module_manager_fwd.h"
+#include "openfpga_name_pool.h"
 #include "openfpga_port.h"
 #include "rr_node_types.h"
 #include "vtr_geometry.h"
@@ -59,6 +60,9 @@ std::string generate_memory_decoder_subckt_name(const size_t& addr_size,
 std::string generate_memory_decoder_with_data_in_subckt_name(
   const size_t& addr_size, const size_t& data_size);
 
+std::string generate_memory_decoder_with_addr_mask_subckt_name(
+  const size_t& addr_size, const size_t& data_size);
+
 std::string generate_segment_wire_subckt_name(
   const std::string& wire_model_name, const size_t& segment_id);
 
@@ -107,9 +111,15 @@ std::string generate_routing_track_middle_output_port_name(
 std::string generate_switch_block_module_name(
   const vtr::Point<size_t>& coordinate);
 
+NameId generate_switch_block_module_name_id(
+  const vtr::Point<size_t>& coordinate);
+
 std::string generate_connection_block_module_name(
   const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate);
 
+NameId generate_connection_block_module_name_id(
+  const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate);
+
 std::string generate_sb_mux_instance_name(const std::string& prefix,
                                           const e_side& sb_side,
                                           const size_t& track_id,
@@ -9,6 +9,7 @@
 #include "openfpga_build_fabric_template.h"
 #include "openfpga_link_arch_template.h"
 #include "openfpga_lut_truth_table_fixup_template.h"
+#include "openfpga_memory_usage_template.h"
 #include "openfpga_pb_pin_fixup_template.h"
 #include "openfpga_pcf2place_template.h"
 #include "openfpga_read_arch_template.h"
@@ -410,6 +411,13 @@ ShellCommandId add_build_fabric_command_template(
                        "Create a random fabric key which will shuffle the "
                        "memory address for encryption purpose");
 
+  /* Add an option '--balance_config_regions' */
+  shell_cmd.add_option(
+    "balance_config_regions", false,
+    "Split configurable children into regions by their locations, so that "
+    "the configuration bits are balanced across the regions. Use "
+    "'--write_fabric_key' to freeze the resulting regions");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -674,6 +682,11 @@ ShellCommandId add_route_clock_rr_graph_command_template(
   shell_cmd.set_option_short_name(opt_file, "pcf");
   shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
 
+  /* Add an option '--disable_unused_spines' */
+  shell_cmd.add_option("disable_unused_spines", false,
+                       "Disable the spines and taps of clock trees which are "
+                       "not required by any clock pins of the design");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -692,6 +705,42 @@ ShellCommandId add_route_clock_rr_graph_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: report_memory_usage
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_report_memory_usage_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const bool& hidden) {
+  Command shell_cmd("report_memory_usage");
+
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId opt_file = shell_cmd.add_option(
+    "file", false,
+    "file path to the report. If not specified, the report is outputted to "
+    "the log");
+  shell_cmd.set_option_short_name(opt_file, "f");
+  shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
+
+  /* Add an option '--format' */
+  CommandOptionId opt_format = shell_cmd.add_option(
+    "format", false, "format of the report [text|json]. Default: text");
+  shell_cmd.set_option_require_value(opt_format, openfpga::OPT_STRING);
+
+  /* Add command 'report_memory_usage' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Report the estimated memory usage of the data structures of OpenFPGA",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_const_execute_function(shell_cmd_id,
+                                           report_memory_usage_template<T>);
+
+  return shell_cmd_id;
+}
+
 template <class T>
 void add_setup_command_templates(openfpga::Shell<T>& shell,
                                  const bool& hidden = false) {
@@ -889,6 +938,14 @@ void add_setup_command_templates(openfpga::Shell<T>& shell,
   add_write_fabric_io_info_command_template<T>(
     shell, openfpga_setup_cmd_class, cmd_dependency_write_fabric_io_info,
     hidden);
+
+  /********************************
+   * Command 'report_memory_usage'
+   */
+  /* The 'report_memory_usage' command can be executed at any time, as it
+   * reports the data structures in their current states */
+  add_report_memory_usage_command_template<T>(shell, openfpga_setup_cmd_class,
+                                              hidden);
 }
 
 } /* end namespace openfpga */
@@ -1,5 +1,7 @@
 #include "openfpga_shell.h"
 
+#include <cstdlib>
+
 #include "basic_command.h"
 #include "command_echo.h"
 #include "command_parser.h"
@@ -8,9 +10,11 @@
 #include "openfpga_sdc_command.h"
 #include "openfpga_setup_command.h"
 #include "openfpga_spice_command.h"
+#include "openfpga_thread_pool.h"
 #include "openfpga_title.h"
 #include "openfpga_verilog_command.h"
 #include "vpr_command.h"
+#include "vtr_log.h"
 
 OpenfpgaShell::OpenfpgaShell() {
   shell_.set_name("OpenFPGA");
@@ -45,6 +49,14 @@ int OpenfpgaShell::run_command(const char* cmd_line) {
   return shell_.execute_command(cmd_line, openfpga_ctx_);
 }
 
+openfpga::BitstreamManagerView OpenfpgaShell::bitstream_manager_view() const {
+  return openfpga::BitstreamManagerView(openfpga_ctx_.bitstream_manager());
+}
+
+openfpga::FabricBitstreamView OpenfpgaShell::fabric_bitstream_view() const {
+  return openfpga::FabricBitstreamView(openfpga_ctx_.fabric_bitstream());
+}
+
 void OpenfpgaShell::reset() {
   /* TODO: reset the shell status */
   /* TODO: reset the data storage */
@@ -75,6 +87,14 @@ int OpenfpgaShell::start(int argc, char** argv) {
                          "Launch OpenFPGA in batch  mode when running scripts");
   start_cmd.set_option_short_name(opt_batch_exec, "batch");
 
+  /* '--threads': number of threads used by parallel algorithms */
+  openfpga::CommandOptionId opt_threads = start_cmd.add_option(
+    "threads", false,
+    "Specify the number of threads used by parallel algorithms. Default is "
+    "taken from environment variable OPENFPGA_NUM_THREADS, or the number of "
+    "hardware threads");
+  start_cmd.set_option_require_value(opt_threads, openfpga::OPT_INT);
+
   /* '--version', -v': print version information */
   openfpga::CommandOptionId opt_version =
     start_cmd.add_option("version", false, "Show OpenFPGA version");
@@ -99,6 +119,16 @@ int OpenfpgaShell::start(int argc, char** argv) {
     openfpga::print_command_options(start_cmd);
   } else {
     /* Parse succeed. Branch on options */
+    /* Set the number of threads before any command runs */
+    if (true == start_cmd_context.option_enable(start_cmd, opt_threads)) {
+      int num_threads = std::atoi(
+        start_cmd_context.option_value(start_cmd, opt_threads).c_str());
+      if (0 >= num_threads) {
+        VTR_LOG_ERROR("Number of threads must be a positive integer!\n");
+        return 1;
+      }
+      openfpga::set_num_threads(num_threads);
+    }
     /* Show version */
     if (true == start_cmd_context.option_enable(start_cmd, opt_version)) {
       print_openfpga_version_info();
@@ -3,6 +3,7 @@
 
 #include <string>
 
+#include "bitstream_view.h"
 #include "openfpga_context.h"
 #include "shell.h"
 
@@ -39,6 +40,13 @@ class OpenfpgaShell {
   /* Reset the data storage and shell status, to ensure a clean start */
   void reset();
 
+ public: /* Accessors */
+  /* Read-only snapshots of the bitstreams in the data storage, which are
+   * mainly used by scripting interfaces to analyze the bitstreams without
+   * writing and parsing files */
+  openfpga::BitstreamManagerView bitstream_manager_view() const;
+  openfpga::FabricBitstreamView fabric_bitstream_view() const;
+
  private: /* Internal data */
   openfpga::Shell<OpenfpgaContext> shell_;
   OpenfpgaContext openfpga_ctx_;
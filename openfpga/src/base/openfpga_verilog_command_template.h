@@ -59,6 +59,11 @@ ShellCommandId add_write_fabric_verilog_command_template(
     "use_relative_path", false,
     "Force to use relative path in netlists when including other netlists");
 
+  /* Add an option '--incremental' */
+  shell_cmd.add_option("incremental", false,
+                       "Only rewrite the netlists whose modules have changed "
+                       "since the last run in the same directory");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
@@ -392,6 +397,45 @@ ShellCommandId add_write_simulation_task_info_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: write_configured_fabric_netlist
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_write_configured_fabric_netlist_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("write_configured_fabric_netlist");
+
+  /* Add an option '--file' in short '-f'*/
+  CommandOptionId output_opt = shell_cmd.add_option(
+    "file", true, "Specify the file path to output the configured netlist");
+  shell_cmd.set_option_short_name(output_opt, "f");
+  shell_cmd.set_option_require_value(output_opt, openfpga::OPT_STRING);
+
+  /* Add an option '--no_time_stamp' */
+  shell_cmd.add_option("no_time_stamp", false,
+                       "Do not print a time stamp in the output files");
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "generate a flattened netlist of the fabric configured by the bitstream",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(
+    shell_cmd_id, write_configured_fabric_netlist_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 template <class T>
 void add_verilog_command_templates(openfpga::Shell<T>& shell,
                                    const bool& hidden = false) {
@@ -455,6 +499,17 @@ void add_verilog_command_templates(openfpga::Shell<T>& shell,
   sim_task_info_dependent_cmds.push_back(build_fabric_cmd_id);
   add_write_simulation_task_info_command_template<T>(
     shell, openfpga_verilog_cmd_class, sim_task_info_dependent_cmds, hidden);
+
+  /********************************
+   * Command 'write_configured_fabric_netlist'
+   */
+  /* The command 'write_configured_fabric_netlist' should NOT be executed
+   * before 'build_fabric' */
+  std::vector<ShellCommandId> configured_fabric_dependent_cmds;
+  configured_fabric_dependent_cmds.push_back(build_fabric_cmd_id);
+  add_write_configured_fabric_netlist_command_template<T>(
+    shell, openfpga_verilog_cmd_class, configured_fabric_dependent_cmds,
+    hidden);
 }
 
 } /* end namespace openfpga */
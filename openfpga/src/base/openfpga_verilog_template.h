@@ -33,6 +33,7 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_default_net_type = cmd.option("default_net_type");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
   CommandOptionId opt_use_relative_path = cmd.option("use_relative_path");
+  CommandOptionId opt_incremental = cmd.option("incremental");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* This is an intermediate data structure which is designed to modularize the
@@ -53,6 +54,7 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
     options.set_default_net_type(
       cmd_context.option_value(cmd, opt_default_net_type));
   }
+  options.set_incremental(cmd_context.option_enable(cmd, opt_incremental));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
 
@@ -333,6 +335,34 @@ int write_simulation_task_info_template(const T& openfpga_ctx,
     options);
 }
 
+/********************************************************************
+ * A wrapper function to call the configured fabric netlist generator of
+ *FPGA-Verilog
+ *******************************************************************/
+template <class T>
+int write_configured_fabric_netlist_template(
+  const T& openfpga_ctx, const Command& cmd,
+  const CommandContext& cmd_context) {
+  CommandOptionId opt_file = cmd.option("file");
+  CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* The bitstream is required to configure the fabric */
+  if (0 == openfpga_ctx.bitstream_manager().num_blocks()) {
+    VTR_LOG_ERROR(
+      "No architecture bitstream is found! Please build one before writing "
+      "the configured fabric netlist\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  return fpga_verilog_configured_fabric_netlist(
+    openfpga_ctx.module_graph(), openfpga_ctx.bitstream_manager(),
+    openfpga_ctx.arch().circuit_lib, openfpga_ctx.mux_lib(),
+    cmd_context.option_value(cmd, opt_file),
+    !cmd_context.option_enable(cmd, opt_no_time_stamp),
+    cmd_context.option_enable(cmd, opt_verbose));
+}
+
 } /* end namespace openfpga */
 
 #endif
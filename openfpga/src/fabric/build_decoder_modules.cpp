@@ -36,6 +36,10 @@ namespace openfpga {
  *  The outputs are assumes to be one-hot codes (at most only one '1' exist)
  *  Considering this fact, there are only num_of_outputs conditions to be
  *encoded. Therefore, the number of inputs is ceil(log(num_of_outputs)/log(2))
+ *
+ *  If the decoder uses an address mask, the masked address bits are ignored,
+ *  so that all the data outputs matching the rest of address bits are
+ *activated (broadcast)
  ***************************************************************************************/
 ModuleId build_frame_memory_decoder_module(ModuleManager& module_manager,
                                            const DecoderLibrary& decoder_lib,
@@ -47,6 +51,10 @@ ModuleId build_frame_memory_decoder_module(ModuleManager& module_manager,
   /* Create a name for the local encoder */
   std::string module_name =
     generate_memory_decoder_subckt_name(addr_size, data_size);
+  if (true == decoder_lib.use_addr_mask(decoder)) {
+    module_name =
+      generate_memory_decoder_with_addr_mask_subckt_name(addr_size, data_size);
+  }
 
   /* Create a Verilog Module based on the circuit model, and add to module
    * manager */
@@ -60,6 +68,13 @@ ModuleId build_frame_memory_decoder_module(ModuleManager& module_manager,
   BasicPort addr_port(std::string(DECODER_ADDRESS_PORT_NAME), addr_size);
   module_manager.add_port(module_id, addr_port,
                           ModuleManager::MODULE_INPUT_PORT);
+  /* Add address mask port, whose width is the same as the address port */
+  if (true == decoder_lib.use_addr_mask(decoder)) {
+    BasicPort addr_mask_port(std::string(DECODER_ADDRESS_MASK_PORT_NAME),
+                             addr_size);
+    module_manager.add_port(module_id, addr_mask_port,
+                            ModuleManager::MODULE_INPUT_PORT);
+  }
   /* Add each output port */
   BasicPort data_port(std::string(DECODER_DATA_OUT_PORT_NAME), data_size);
   module_manager.add_port(module_id, data_port,
@@ -223,6 +238,81 @@ ModuleId build_wl_memory_decoder_module(ModuleManager& module_manager,
   return module_id;
 }
 
+/***************************************************************************************
+ * Create a module for a run-length decompressor which drives the head of a
+ * configuration chain
+ *
+ *          ccff_head  ccff_rle_load  ccff_rle_count
+ *              |           |           | | ... |
+ *              v           v           v v     v
+ *            +---------------------------------+
+ *  prog_clk->|       RLE decompressor          |
+ *            +---------------------------------+
+ *                 |                     |
+ *                 v                     v
+ *             ccff_tail           ccff_rle_ready
+ *
+ *  When the load signal is enabled, a token <value, run length> is latched.
+ *  The value is then outputted to the configuration chain for (run length +
+ *1) programming clock cycles. The ready signal is raised when the decompressor
+ *is about to output the last bit of the token, so that the next token can be
+ *loaded without any idle cycle.
+ *
+ *  The decompressor is clocked by the programming clock of the configuration
+ *chain flip-flops, which is a global port of the module
+ ***************************************************************************************/
+ModuleId build_config_chain_rle_decompressor_module(
+  ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const CircuitModelId& sram_model, const size_t& count_size) {
+  /* Find the programming clock of the configuration chain flip-flops */
+  std::vector<CircuitPortId> prog_clock_ports;
+  for (const CircuitPortId& port : circuit_lib.model_global_ports_by_type(
+         sram_model, CIRCUIT_MODEL_PORT_CLOCK, true, false)) {
+    if (true == circuit_lib.port_is_prog(port)) {
+      prog_clock_ports.push_back(port);
+    }
+  }
+  if (1 != prog_clock_ports.size()) {
+    VTR_LOG_ERROR(
+      "Expect only 1 global programming clock for circuit model '%s' to drive "
+      "a run-length decompressor while %lu are found!\n",
+      circuit_lib.model_name(sram_model).c_str(), prog_clock_ports.size());
+    return ModuleId::INVALID();
+  }
+
+  ModuleId module_id = module_manager.add_module(
+    std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
+  VTR_ASSERT(true == module_manager.valid_module_id(module_id));
+
+  /* Add the programming clock port */
+  BasicPort clock_port(circuit_lib.port_prefix(prog_clock_ports[0]),
+                       circuit_lib.port_size(prog_clock_ports[0]));
+  module_manager.add_port(module_id, clock_port,
+                          ModuleManager::MODULE_GLOBAL_PORT);
+  /* Add token ports */
+  BasicPort head_port(std::string(CONFIGURABLE_MEMORY_CHAIN_IN_NAME), 1);
+  module_manager.add_port(module_id, head_port,
+                          ModuleManager::MODULE_INPUT_PORT);
+  BasicPort load_port(std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME), 1);
+  module_manager.add_port(module_id, load_port,
+                          ModuleManager::MODULE_INPUT_PORT);
+  BasicPort count_port(std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME),
+                       count_size);
+  module_manager.add_port(module_id, count_port,
+                          ModuleManager::MODULE_INPUT_PORT);
+  /* Add output ports */
+  BasicPort tail_port(std::string(CONFIGURABLE_MEMORY_CHAIN_OUT_NAME), 1);
+  module_manager.add_port(module_id, tail_port,
+                          ModuleManager::MODULE_OUTPUT_PORT);
+  BasicPort ready_port(std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME), 1);
+  module_manager.add_port(module_id, ready_port,
+                          ModuleManager::MODULE_OUTPUT_PORT);
+
+  module_manager.set_module_usage(module_id, ModuleManager::MODULE_CONFIG);
+
+  return module_id;
+}
+
 /***************************************************************************************
  * Create a module for a decoder with a given output size
  *
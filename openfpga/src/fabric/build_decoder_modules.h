@@ -28,6 +28,10 @@ ModuleId build_wl_memory_decoder_module(ModuleManager& module_manager,
                                         const DecoderLibrary& decoder_lib,
                                         const DecoderId& decoder);
 
+ModuleId build_config_chain_rle_decompressor_module(
+  ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const CircuitModelId& sram_model, const size_t& count_size);
+
 void build_mux_local_decoder_modules(ModuleManager& module_manager,
                                      const MuxLibrary& mux_lib,
                                      const CircuitLibrary& circuit_lib);
@@ -34,7 +34,8 @@ int build_device_module_graph(
   const OpenfpgaContext& openfpga_ctx, const DeviceContext& vpr_device_ctx,
   const bool& frame_view, const bool& compress_routing,
   const bool& duplicate_grid_pin, const FabricKey& fabric_key,
-  const bool& generate_random_fabric_key, const bool& verbose) {
+  const bool& generate_random_fabric_key, const bool& balance_config_regions,
+  const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build fabric module graph");
 
   int status = CMD_EXEC_SUCCESS;
@@ -107,7 +108,7 @@ int build_device_module_graph(
     openfpga_ctx.device_rr_gsb(), openfpga_ctx.tile_direct(),
     openfpga_ctx.arch().arch_direct, openfpga_ctx.arch().config_protocol,
     sram_model, frame_view, compress_routing, duplicate_grid_pin, fabric_key,
-    generate_random_fabric_key);
+    generate_random_fabric_key, balance_config_regions);
 
   if (CMD_EXEC_FATAL_ERROR == status) {
     return status;
@@ -439,7 +439,8 @@ int build_top_module(
   const ArchDirect& arch_direct, const ConfigProtocol& config_protocol,
   const CircuitModelId& sram_model, const bool& frame_view,
   const bool& compact_routing_hierarchy, const bool& duplicate_grid_pin,
-  const FabricKey& fabric_key, const bool& generate_random_fabric_key) {
+  const FabricKey& fabric_key, const bool& generate_random_fabric_key,
+  const bool& balance_config_regions) {
   vtr::ScopedStartFinishTimer timer("Build FPGA fabric module");
 
   int status = CMD_EXEC_SUCCESS;
@@ -516,6 +517,11 @@ int build_top_module(
       module_manager, top_module, circuit_lib, config_protocol, sram_model,
       grids, grid_instance_ids, device_rr_gsb, sb_instance_ids, cb_instance_ids,
       compact_routing_hierarchy);
+    /* Rebuild the regions to balance the configuration bits if required */
+    if (true == balance_config_regions) {
+      balance_top_module_configurable_regions(
+        module_manager, top_module, circuit_lib, sram_model, config_protocol);
+    }
   } else {
     VTR_ASSERT_SAFE(false == fabric_key.empty());
     /* Throw a fatal error when the fabric key has a mismatch in region
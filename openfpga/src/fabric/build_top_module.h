@@ -42,7 +42,8 @@ int build_top_module(
   const ArchDirect& arch_direct, const ConfigProtocol& config_protocol,
   const CircuitModelId& sram_model, const bool& frame_view,
   const bool& compact_routing_hierarchy, const bool& duplicate_grid_pin,
-  const FabricKey& fabric_key, const bool& generate_random_fabric_key);
+  const FabricKey& fabric_key, const bool& generate_random_fabric_key,
+  const bool& balance_config_regions);
 
 } /* end namespace openfpga */
 
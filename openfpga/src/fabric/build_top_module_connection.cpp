@@ -62,7 +62,7 @@ namespace openfpga {
  *
  *******************************************************************/
 static void add_top_module_nets_connect_grids_and_sb(
-  ModuleManager& module_manager, const ModuleId& top_module,
+  ModuleNetBatch& net_batch, const ModuleManager& module_manager,
   const VprDeviceAnnotation& vpr_device_annotation, const DeviceGrid& grids,
   const vtr::Matrix<size_t>& grid_instance_ids, const RRGraphView& rr_graph,
   const DeviceRRGSB& device_rr_gsb, const RRGSB& rr_gsb,
@@ -94,9 +94,8 @@ static void add_top_module_nets_connect_grids_and_sb(
                                           module_sb.get_sb_y());
 
   /* Collect sink-related information */
-  std::string sink_sb_module_name =
-    generate_switch_block_module_name(module_sb_coordinate);
-  ModuleId sink_sb_module = module_manager.find_module(sink_sb_module_name);
+  ModuleId sink_sb_module = module_manager.find_module(
+    generate_switch_block_module_name_id(module_sb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(sink_sb_module));
   size_t sink_sb_instance =
     sb_instance_ids[instance_sb_coordinate.x()][instance_sb_coordinate.y()];
@@ -174,16 +173,11 @@ static void add_top_module_nets_connect_grids_and_sb(
       /* Source and sink port should match in size */
       VTR_ASSERT(src_grid_port.get_width() == sink_sb_port.get_width());
 
-      /* Create a net for each pin */
-      for (size_t pin_id = 0; pin_id < src_grid_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(
-          module_manager, top_module, src_grid_module, src_grid_instance,
-          src_grid_port_id, src_grid_port.pins()[pin_id]);
-        /* Configure the net sink */
-        module_manager.add_module_net_sink(top_module, net, sink_sb_module,
-                                           sink_sb_instance, sink_sb_port_id,
-                                           sink_sb_port.pins()[pin_id]);
-      }
+      /* Connect each pin, the nets are created in batch */
+      net_batch.add_bus_connection(src_grid_module, src_grid_instance,
+                                   src_grid_port_id, src_grid_port.pins(),
+                                   sink_sb_module, sink_sb_instance,
+                                   sink_sb_port_id, sink_sb_port.pins());
     }
   }
 }
@@ -225,7 +219,7 @@ static void add_top_module_nets_connect_grids_and_sb(
  *
  *******************************************************************/
 static void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(
-  ModuleManager& module_manager, const ModuleId& top_module,
+  ModuleNetBatch& net_batch, const ModuleManager& module_manager,
   const VprDeviceAnnotation& vpr_device_annotation, const DeviceGrid& grids,
   const vtr::Matrix<size_t>& grid_instance_ids, const RRGraphView& rr_graph,
   const DeviceRRGSB& device_rr_gsb, const RRGSB& rr_gsb,
@@ -257,9 +251,8 @@ static void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(
                                           module_sb.get_sb_y());
 
   /* Collect sink-related information */
-  std::string sink_sb_module_name =
-    generate_switch_block_module_name(module_sb_coordinate);
-  ModuleId sink_sb_module = module_manager.find_module(sink_sb_module_name);
+  ModuleId sink_sb_module = module_manager.find_module(
+    generate_switch_block_module_name_id(module_sb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(sink_sb_module));
   size_t sink_sb_instance =
     sb_instance_ids[instance_sb_coordinate.x()][instance_sb_coordinate.y()];
@@ -365,16 +358,11 @@ static void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(
       /* Source and sink port should match in size */
       VTR_ASSERT(src_grid_port.get_width() == sink_sb_port.get_width());
 
-      /* Create a net for each pin */
-      for (size_t pin_id = 0; pin_id < src_grid_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(
-          module_manager, top_module, src_grid_module, src_grid_instance,
-          src_grid_port_id, src_grid_port.pins()[pin_id]);
-        /* Configure the net sink */
-        module_manager.add_module_net_sink(top_module, net, sink_sb_module,
-                                           sink_sb_instance, sink_sb_port_id,
-                                           sink_sb_port.pins()[pin_id]);
-      }
+      /* Connect each pin, the nets are created in batch */
+      net_batch.add_bus_connection(src_grid_module, src_grid_instance,
+                                   src_grid_port_id, src_grid_port.pins(),
+                                   sink_sb_module, sink_sb_instance,
+                                   sink_sb_port_id, sink_sb_port.pins());
     }
   }
 }
@@ -435,7 +423,7 @@ static void add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(
  *
  *******************************************************************/
 static void add_top_module_nets_connect_grids_and_cb(
-  ModuleManager& module_manager, const ModuleId& top_module,
+  ModuleNetBatch& net_batch, const ModuleManager& module_manager,
   const VprDeviceAnnotation& vpr_device_annotation, const DeviceGrid& grids,
   const vtr::Matrix<size_t>& grid_instance_ids, const RRGraphView& rr_graph,
   const DeviceRRGSB& device_rr_gsb, const RRGSB& rr_gsb,
@@ -473,9 +461,8 @@ static void add_top_module_nets_connect_grids_and_cb(
                                           module_cb.get_cb_y(cb_type));
 
   /* Collect source-related information */
-  std::string src_cb_module_name =
-    generate_connection_block_module_name(cb_type, module_cb_coordinate);
-  ModuleId src_cb_module = module_manager.find_module(src_cb_module_name);
+  ModuleId src_cb_module = module_manager.find_module(
+    generate_connection_block_module_name_id(cb_type, module_cb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(src_cb_module));
   /* Instance id should follow the instance cb coordinate */
   size_t src_cb_instance =
@@ -548,16 +535,11 @@ static void add_top_module_nets_connect_grids_and_cb(
       /* Source and sink port should match in size */
       VTR_ASSERT(src_cb_port.get_width() == sink_grid_port.get_width());
 
-      /* Create a net for each pin */
-      for (size_t pin_id = 0; pin_id < src_cb_port.pins().size(); ++pin_id) {
-        ModuleNetId net = create_module_source_pin_net(
-          module_manager, top_module, src_cb_module, src_cb_instance,
-          src_cb_port_id, src_cb_port.pins()[pin_id]);
-        /* Configure the net sink */
-        module_manager.add_module_net_sink(
-          top_module, net, sink_grid_module, sink_grid_instance,
-          sink_grid_port_id, sink_grid_port.pins()[pin_id]);
-      }
+      /* Connect each pin, the nets are created in batch */
+      net_batch.add_bus_connection(src_cb_module, src_cb_instance,
+                                   src_cb_port_id, src_cb_port.pins(),
+                                   sink_grid_module, sink_grid_instance,
+                                   sink_grid_port_id, sink_grid_port.pins());
     }
   }
 }
@@ -602,7 +584,7 @@ static void add_top_module_nets_connect_grids_and_cb(
  *
  *******************************************************************/
 static void add_top_module_nets_connect_sb_and_cb(
-  ModuleManager& module_manager, const ModuleId& top_module,
+  ModuleNetBatch& net_batch, const ModuleManager& module_manager,
   const RRGraphView& rr_graph, const DeviceRRGSB& device_rr_gsb,
   const RRGSB& rr_gsb, const vtr::Matrix<size_t>& sb_instance_ids,
   const std::map<t_rr_type, vtr::Matrix<size_t>>& cb_instance_ids,
@@ -631,9 +613,8 @@ static void add_top_module_nets_connect_sb_and_cb(
   const RRGSB& module_sb = device_rr_gsb.get_gsb(module_gsb_sb_coordinate);
   vtr::Point<size_t> module_sb_coordinate(module_sb.get_sb_x(),
                                           module_sb.get_sb_y());
-  std::string sb_module_name =
-    generate_switch_block_module_name(module_sb_coordinate);
-  ModuleId sb_module_id = module_manager.find_module(sb_module_name);
+  ModuleId sb_module_id = module_manager.find_module(
+    generate_switch_block_module_name_id(module_sb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module_id));
   size_t sb_instance =
     sb_instance_ids[instance_sb_coordinate.x()][instance_sb_coordinate.y()];
@@ -692,9 +673,8 @@ static void add_top_module_nets_connect_sb_and_cb(
     const RRGSB& module_cb = device_rr_gsb.get_gsb(module_gsb_cb_coordinate);
     vtr::Point<size_t> module_cb_coordinate(module_cb.get_cb_x(cb_type),
                                             module_cb.get_cb_y(cb_type));
-    std::string cb_module_name =
-      generate_connection_block_module_name(cb_type, module_cb_coordinate);
-    ModuleId cb_module_id = module_manager.find_module(cb_module_name);
+    ModuleId cb_module_id = module_manager.find_module(
+      generate_connection_block_module_name_id(cb_type, module_cb_coordinate));
     VTR_ASSERT(true == module_manager.valid_module_id(cb_module_id));
     const RRGSB& instance_cb =
       device_rr_gsb.get_gsb(instance_gsb_cb_coordinate);
@@ -748,19 +728,15 @@ static void add_top_module_nets_connect_sb_and_cb(
        */
       if (OUT_PORT ==
           module_sb.get_chan_node_direction(side_manager.get_side(), itrack)) {
-        ModuleNetId net =
-          create_module_source_pin_net(module_manager, top_module, sb_module_id,
-                                       sb_instance, sb_port_id, itrack / 2);
-        module_manager.add_module_net_sink(top_module, net, cb_module_id,
-                                           cb_instance, cb_port_id, itrack / 2);
+        net_batch.add_connection(sb_module_id, sb_instance, sb_port_id,
+                                 itrack / 2, cb_module_id, cb_instance,
+                                 cb_port_id, itrack / 2);
       } else {
         VTR_ASSERT(IN_PORT == module_sb.get_chan_node_direction(
                                 side_manager.get_side(), itrack));
-        ModuleNetId net =
-          create_module_source_pin_net(module_manager, top_module, cb_module_id,
-                                       cb_instance, cb_port_id, itrack / 2);
-        module_manager.add_module_net_sink(top_module, net, sb_module_id,
-                                           sb_instance, sb_port_id, itrack / 2);
+        net_batch.add_connection(cb_module_id, cb_instance, cb_port_id,
+                                 itrack / 2, sb_module_id, sb_instance,
+                                 sb_port_id, itrack / 2);
       }
     }
   }
@@ -810,6 +786,24 @@ void add_top_module_nets_connect_grids_and_gsbs(
 
   vtr::Point<size_t> gsb_range = device_rr_gsb.get_gsb_range();
 
+  /* Collect the connections of all the GSBs in a batch, whose size is
+   * estimated from the number of nodes, and then create the nets at once */
+  size_t num_connections = 0;
+  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+      for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
+        SideManager side_manager(side);
+        num_connections +=
+          rr_gsb.get_num_opin_nodes(side_manager.get_side()) +
+          rr_gsb.get_num_ipin_nodes(side_manager.get_side()) +
+          rr_gsb.get_chan_width(side_manager.get_side());
+      }
+    }
+  }
+  ModuleNetBatch net_batch;
+  net_batch.reserve(2 * num_connections, num_connections);
+
   for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
     for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
       vtr::Point<size_t> gsb_coordinate(ix, iy);
@@ -818,32 +812,34 @@ void add_top_module_nets_connect_grids_and_gsbs(
       /* Connect the grid pins of the GSB to adjacent grids */
       if (false == duplicate_grid_pin) {
         add_top_module_nets_connect_grids_and_sb(
-          module_manager, top_module, vpr_device_annotation, grids,
+          net_batch, module_manager, vpr_device_annotation, grids,
           grid_instance_ids, rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids,
           compact_routing_hierarchy);
       } else {
         VTR_ASSERT_SAFE(true == duplicate_grid_pin);
         add_top_module_nets_connect_grids_and_sb_with_duplicated_pins(
-          module_manager, top_module, vpr_device_annotation, grids,
+          net_batch, module_manager, vpr_device_annotation, grids,
           grid_instance_ids, rr_graph, device_rr_gsb, rr_gsb, sb_instance_ids,
           compact_routing_hierarchy);
       }
 
       add_top_module_nets_connect_grids_and_cb(
-        module_manager, top_module, vpr_device_annotation, grids,
+        net_batch, module_manager, vpr_device_annotation, grids,
         grid_instance_ids, rr_graph, device_rr_gsb, rr_gsb, CHANX,
         cb_instance_ids.at(CHANX), compact_routing_hierarchy);
 
       add_top_module_nets_connect_grids_and_cb(
-        module_manager, top_module, vpr_device_annotation, grids,
+        net_batch, module_manager, vpr_device_annotation, grids,
         grid_instance_ids, rr_graph, device_rr_gsb, rr_gsb, CHANY,
         cb_instance_ids.at(CHANY), compact_routing_hierarchy);
 
       add_top_module_nets_connect_sb_and_cb(
-        module_manager, top_module, rr_graph, device_rr_gsb, rr_gsb,
+        net_batch, module_manager, rr_graph, device_rr_gsb, rr_gsb,
         sb_instance_ids, cb_instance_ids, compact_routing_hierarchy);
     }
   }
+
+  module_manager.add_module_nets(top_module, net_batch);
 }
 
 /********************************************************************
@@ -1171,7 +1167,7 @@ static int build_top_module_global_net_from_clock_arch_tree(
       const RRGSB& rr_gsb = device_rr_gsb.get_gsb_by_cb_coordinate(
         entry_track_type, vtr::Point<size_t>(entry_point.x(), entry_point.y()));
       ModuleId cb_module =
-        module_manager.find_module(generate_connection_block_module_name(
+        module_manager.find_module(generate_connection_block_module_name_id(
           entry_track_type,
           vtr::Point<size_t>(entry_point.x(), entry_point.y())));
       size_t cb_instance =
@@ -2,7 +2,9 @@
  * This file includes functions that are used to organize memories
  * in the top module of FPGA fabric
  *******************************************************************/
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -563,6 +565,326 @@ void shuffle_top_module_configurable_children(
                                         config_protocol);
 }
 
+/********************************************************************
+ * Find the expected number of programming cycles for a configurable
+ * region with a given number of configuration bits
+ * - A configuration chain takes one cycle per bit
+ * - A memory bank takes one cycle per word line, where the memory
+ *   cells are organized in a square array
+ ********************************************************************/
+static size_t find_config_region_num_prog_cycles(
+  const e_config_protocol_type& config_protocol_type,
+  const size_t& num_config_bits) {
+  if (CONFIG_MEM_MEMORY_BANK == config_protocol_type) {
+    return find_memory_decoder_data_size(num_config_bits);
+  }
+  return num_config_bits;
+}
+
+/********************************************************************
+ * Find the maximum number of configuration bits among the regions
+ * of the top-level module
+ ********************************************************************/
+static size_t find_top_module_max_regional_num_config_bit(
+  const ModuleManager& module_manager, const ModuleId& top_module,
+  const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
+  const e_config_protocol_type& config_protocol_type) {
+  size_t max_num_config_bits = 0;
+  for (const auto& region_num_config_bits :
+       find_top_module_regional_num_config_bit(module_manager, top_module,
+                                               circuit_lib, sram_model,
+                                               config_protocol_type)) {
+    max_num_config_bits =
+      std::max(max_num_config_bits, region_num_config_bits.first);
+  }
+  return max_num_config_bits;
+}
+
+/********************************************************************
+ * Find the capacity (in number of configuration bits) of a region
+ * with a given weight, where the heaviest region has a weight of 1
+ ********************************************************************/
+static size_t find_weighted_config_region_capacity(const size_t& capacity,
+                                                   const float& weight) {
+  return std::max(size_t(1), size_t(weight * capacity));
+}
+
+/********************************************************************
+ * Find the minimum capacity (in number of configuration bits) of a
+ * region, so that a sequence of configurable children can be split
+ * into no more than a given number of regions, each of which
+ * consists of consecutive children in the sequence
+ * The capacity of each region is scaled by its weight, so that a
+ * lighter region holds fewer configuration bits.
+ * The capacity is searched in a binary way between the largest child
+ * and the sum of all the children over the lightest weight
+ ********************************************************************/
+static size_t find_balanced_config_region_capacity(
+  const std::vector<size_t>& child_num_config_bits,
+  const std::vector<float>& region_weights) {
+  size_t lower_bound = *std::max_element(child_num_config_bits.begin(),
+                                         child_num_config_bits.end());
+  size_t upper_bound =
+    std::ceil(std::accumulate(child_num_config_bits.begin(),
+                              child_num_config_bits.end(), size_t(0)) /
+              *std::min_element(region_weights.begin(), region_weights.end()));
+  while (lower_bound < upper_bound) {
+    size_t capacity = lower_bound + (upper_bound - lower_bound) / 2;
+    /* Count the regions required by filling each region to its capacity */
+    size_t num_required_regions = 1;
+    size_t curr_num_config_bits = 0;
+    for (const size_t& num_config_bits : child_num_config_bits) {
+      float curr_weight = num_required_regions <= region_weights.size()
+                            ? region_weights[num_required_regions - 1]
+                            : 1.;
+      if ((0 < curr_num_config_bits) &&
+          (curr_num_config_bits + num_config_bits >
+           find_weighted_config_region_capacity(capacity, curr_weight))) {
+        num_required_regions++;
+        curr_num_config_bits = 0;
+      }
+      curr_num_config_bits += num_config_bits;
+    }
+    if (num_required_regions <= region_weights.size()) {
+      upper_bound = capacity;
+    } else {
+      lower_bound = capacity + 1;
+    }
+  }
+  return lower_bound;
+}
+
+/********************************************************************
+ * Find the weight of each configurable region when balancing the
+ * configuration bits. By default, all the regions have the same weight.
+ * When configuration chains are driven by multiple programming clocks,
+ * each clock should drive the same number of configuration bits, which
+ * are split evenly among the chains it drives. For example, a clock
+ * driving 2 chains has a weight of 0.5 on each chain, when the other
+ * clock drives 1 chain.
+ ********************************************************************/
+static std::vector<float> find_balanced_config_region_weights(
+  const ConfigProtocol& config_protocol) {
+  std::vector<float> region_weights(config_protocol.num_regions(), 1.);
+  if ((CONFIG_MEM_SCAN_CHAIN != config_protocol.type()) ||
+      (1 == config_protocol.num_prog_clocks())) {
+    return region_weights;
+  }
+  size_t min_num_ccff_heads = config_protocol.num_regions();
+  for (const BasicPort& prog_clock_pin : config_protocol.prog_clock_pins()) {
+    min_num_ccff_heads = std::min(
+      min_num_ccff_heads,
+      config_protocol.prog_clock_pin_ccff_head_indices(prog_clock_pin).size());
+  }
+  for (const BasicPort& prog_clock_pin : config_protocol.prog_clock_pins()) {
+    std::vector<size_t> ccff_head_indices =
+      config_protocol.prog_clock_pin_ccff_head_indices(prog_clock_pin);
+    for (const size_t& ccff_head_index : ccff_head_indices) {
+      VTR_ASSERT(ccff_head_index < region_weights.size());
+      region_weights[ccff_head_index] =
+        (float)min_num_ccff_heads / (float)ccff_head_indices.size();
+    }
+  }
+  return region_weights;
+}
+
+/********************************************************************
+ * Rebuild the configurable regions of the top-level module, so that
+ * the configuration bits are balanced across the regions. The
+ * programming time is limited by the largest region, which is often
+ * much larger than others when children are split by their counts.
+ *
+ * The configurable children are first sorted by their coordinates
+ * in a snake-like sequence along the rows of tiles, so that each
+ * region covers a compact area of the fabric:
+ *
+ *   +-----------------------+
+ *   |  ---------------->    |  Row 2
+ *   |  <----------------    |  Row 1
+ *   |  ---------------->    |  Row 0
+ *   +-----------------------+
+ *
+ * The sequence is then split into consecutive regions, where the
+ * largest region has the minimum number of configuration bits.
+ * Children at the same coordinate keep their original order.
+ *
+ * Note:
+ *   - This function will overwrite the configurable children and
+ *     regions of the top module. The resulting organization can be
+ *     output as a fabric key to be reused
+ *   - Only configuration chains and memory banks are balanced,
+ *     whose programming time depends on the sum of the configuration
+ *     bits in a region. Other protocols keep the default regions
+ ********************************************************************/
+void balance_top_module_configurable_regions(
+  ModuleManager& module_manager, const ModuleId& top_module,
+  const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
+  const ConfigProtocol& config_protocol) {
+  vtr::ScopedStartFinishTimer timer(
+    "Balance configurable regions for the top module");
+
+  if ((CONFIG_MEM_SCAN_CHAIN != config_protocol.type()) &&
+      (CONFIG_MEM_MEMORY_BANK != config_protocol.type())) {
+    VTR_LOG_WARN(
+      "Balancing configurable regions is only applicable to configuration "
+      "chains and memory banks! Keep the default regions.\n");
+    return;
+  }
+
+  size_t num_regions = config_protocol.num_regions();
+  size_t num_keys = module_manager.configurable_children(top_module).size();
+  VTR_ASSERT(1 <= num_regions);
+  if (num_keys < num_regions) {
+    VTR_LOG_WARN(
+      "Too few configurable children (=%lu) to be balanced across %lu "
+      "regions! Keep the default regions.\n",
+      num_keys, num_regions);
+    return;
+  }
+
+  size_t orig_max_num_config_bits = find_top_module_max_regional_num_config_bit(
+    module_manager, top_module, circuit_lib, sram_model,
+    config_protocol.type());
+
+  /* Cache the configurable children and their instances */
+  std::vector<ModuleId> orig_configurable_children =
+    module_manager.configurable_children(top_module);
+  std::vector<size_t> orig_configurable_child_instances =
+    module_manager.configurable_child_instances(top_module);
+  std::vector<vtr::Point<int>> orig_configurable_child_coordinates =
+    module_manager.configurable_child_coordinates(top_module);
+
+  /* Sort the children along the snake-like sequence. Note that the
+   * coordinates of configurable children are doubled from the tile
+   * coordinates, in order to accommodate the routing blocks */
+  std::vector<size_t> sorted_keys(num_keys);
+  std::iota(sorted_keys.begin(), sorted_keys.end(), 0);
+  std::stable_sort(
+    sorted_keys.begin(), sorted_keys.end(),
+    [&](const size_t& lhs, const size_t& rhs) {
+      const vtr::Point<int>& lhs_coord =
+        orig_configurable_child_coordinates[lhs];
+      const vtr::Point<int>& rhs_coord =
+        orig_configurable_child_coordinates[rhs];
+      int lhs_row = lhs_coord.y() / 2;
+      int rhs_row = rhs_coord.y() / 2;
+      if (lhs_row != rhs_row) {
+        return lhs_row < rhs_row;
+      }
+      if (0 == lhs_row % 2) {
+        return lhs_coord.x() < rhs_coord.x();
+      }
+      return lhs_coord.x() > rhs_coord.x();
+    });
+
+  /* Find the number of configuration bits of each child; the number is
+   * shared by all the instances of a module */
+  std::map<ModuleId, size_t> module_num_config_bits;
+  std::vector<size_t> child_num_config_bits;
+  child_num_config_bits.reserve(num_keys);
+  for (const size_t& ikey : sorted_keys) {
+    ModuleId child_module = orig_configurable_children[ikey];
+    auto result = module_num_config_bits.find(child_module);
+    if (result == module_num_config_bits.end()) {
+      result =
+        module_num_config_bits
+          .emplace(child_module,
+                   find_module_num_config_bits(module_manager, child_module,
+                                               circuit_lib, sram_model,
+                                               config_protocol.type()))
+          .first;
+    }
+    child_num_config_bits.push_back(result->second);
+  }
+
+  std::vector<float> region_weights =
+    find_balanced_config_region_weights(config_protocol);
+  size_t region_capacity =
+    find_balanced_config_region_capacity(child_num_config_bits, region_weights);
+
+  /* Reorganize the configurable children */
+  module_manager.clear_configurable_children(top_module);
+  module_manager.clear_config_region(top_module);
+
+  ConfigRegionId curr_region = module_manager.add_config_region(top_module);
+  size_t curr_num_config_bits = 0;
+  size_t curr_num_children = 0;
+  for (size_t ichild = 0; ichild < num_keys; ++ichild) {
+    size_t ikey = sorted_keys[ichild];
+    /* Start a new region when the current one is full, or when each of
+     * the remaining children has to be given a region to avoid any
+     * empty region. The last region takes all the remaining children */
+    size_t num_remaining_regions = num_regions - 1 - size_t(curr_region);
+    size_t curr_region_capacity = find_weighted_config_region_capacity(
+      region_capacity, region_weights[size_t(curr_region)]);
+    if ((0 < curr_num_children) && (0 < num_remaining_regions) &&
+        ((curr_num_config_bits + child_num_config_bits[ichild] >
+          curr_region_capacity) ||
+         (num_keys - ichild <= num_remaining_regions))) {
+      curr_region = module_manager.add_config_region(top_module);
+      curr_num_config_bits = 0;
+      curr_num_children = 0;
+    }
+
+    module_manager.add_configurable_child(
+      top_module, orig_configurable_children[ikey],
+      orig_configurable_child_instances[ikey],
+      orig_configurable_child_coordinates[ikey]);
+    module_manager.add_configurable_child_to_region(
+      top_module, curr_region, orig_configurable_children[ikey],
+      orig_configurable_child_instances[ikey], ichild);
+    curr_num_config_bits += child_num_config_bits[ichild];
+    curr_num_children++;
+  }
+
+  /* Ensure that the number of configurable regions created matches the
+   * definition */
+  VTR_ASSERT(num_regions == module_manager.regions(top_module).size());
+
+  /* Report the expected reduction on programming time */
+  size_t new_max_num_config_bits = find_top_module_max_regional_num_config_bit(
+    module_manager, top_module, circuit_lib, sram_model,
+    config_protocol.type());
+  size_t orig_num_prog_cycles = find_config_region_num_prog_cycles(
+    config_protocol.type(), orig_max_num_config_bits);
+  size_t new_num_prog_cycles = find_config_region_num_prog_cycles(
+    config_protocol.type(), new_max_num_config_bits);
+  VTR_LOG(
+    "Largest configurable region: %lu -> %lu configuration bits among %lu "
+    "regions\n",
+    orig_max_num_config_bits, new_max_num_config_bits, num_regions);
+  /* Report the configuration bits driven by each programming clock */
+  if ((CONFIG_MEM_SCAN_CHAIN == config_protocol.type()) &&
+      (1 < config_protocol.num_prog_clocks())) {
+    TopModuleNumConfigBits regional_num_config_bits =
+      find_top_module_regional_num_config_bit(module_manager, top_module,
+                                              circuit_lib, sram_model,
+                                              config_protocol.type());
+    for (const BasicPort& prog_clock_pin : config_protocol.prog_clock_pins()) {
+      size_t prog_clock_num_config_bits = 0;
+      size_t prog_clock_max_num_config_bits = 0;
+      for (const size_t& ccff_head_index :
+           config_protocol.prog_clock_pin_ccff_head_indices(prog_clock_pin)) {
+        size_t curr_num_config_bits =
+          regional_num_config_bits[ConfigRegionId(ccff_head_index)].first;
+        prog_clock_num_config_bits += curr_num_config_bits;
+        prog_clock_max_num_config_bits =
+          std::max(prog_clock_max_num_config_bits, curr_num_config_bits);
+      }
+      VTR_LOG(
+        "Programming clock '%s' drives %lu configuration bits (longest "
+        "chain=%lu)\n",
+        prog_clock_pin.to_verilog_string().c_str(), prog_clock_num_config_bits,
+        prog_clock_max_num_config_bits);
+    }
+  }
+  VTR_LOG(
+    "Expected programming cycles: %lu -> %lu (reduction=%.2f%)\n",
+    orig_num_prog_cycles, new_num_prog_cycles,
+    100. * (1. - (float)new_num_prog_cycles /
+                   (float)std::max(orig_num_prog_cycles, size_t(1))));
+}
+
 /********************************************************************
  * Load configurable children from a fabric key to top-level module
  *
@@ -679,6 +1001,22 @@ TopModuleNumConfigBits find_top_module_regional_num_config_bit(
   TopModuleNumConfigBits num_config_bits(
     module_manager.regions(top_module).size(), std::pair<size_t, size_t>(0, 0));
 
+  /* The number of configuration bits is shared by all the instances of a
+   * module, which is found only once */
+  std::map<ModuleId, size_t> module_num_config_bits;
+  auto find_child_num_config_bits = [&](const ModuleId& child_module) {
+    auto result = module_num_config_bits.find(child_module);
+    if (result == module_num_config_bits.end()) {
+      result = module_num_config_bits
+                 .emplace(child_module, find_module_num_config_bits(
+                                          module_manager, child_module,
+                                          circuit_lib, sram_model,
+                                          config_protocol_type))
+                 .first;
+    }
+    return result->second;
+  };
+
   switch (config_protocol_type) {
     case CONFIG_MEM_STANDALONE:
     case CONFIG_MEM_SCAN_CHAIN:
@@ -692,9 +1030,8 @@ TopModuleNumConfigBits find_top_module_regional_num_config_bit(
         for (const ModuleId& child_module :
              module_manager.region_configurable_children(top_module,
                                                          config_region)) {
-          num_config_bits[config_region].first += find_module_num_config_bits(
-            module_manager, child_module, circuit_lib, sram_model,
-            config_protocol_type);
+          num_config_bits[config_region].first +=
+            find_child_num_config_bits(child_module);
         }
       }
       break;
@@ -740,9 +1077,8 @@ TopModuleNumConfigBits find_top_module_regional_num_config_bit(
         for (const ModuleId& child_module :
              module_manager.region_configurable_children(top_module,
                                                          config_region)) {
-          size_t temp_num_config_bits = find_module_num_config_bits(
-            module_manager, child_module, circuit_lib, sram_model,
-            config_protocol_type);
+          size_t temp_num_config_bits =
+            find_child_num_config_bits(child_module);
           num_config_bits[config_region].first = std::max(
             temp_num_config_bits, num_config_bits[config_region].first);
         }
@@ -927,6 +1263,25 @@ void add_top_module_sram_ports(
         }
         port_counter++;
       }
+      /* For run-length encoding, the head of each region carries the value of
+       * tokens, while the run length and the handshake signals are dedicated
+       * ports. The run length of region i is at pins [i*K, i*K + K - 1] of the
+       * count port, where K is the size of a run length */
+      if (0 < config_protocol.rle_count_size()) {
+        BasicPort load_port(std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME),
+                            sram_port_size);
+        module_manager.add_port(module_id, load_port,
+                                ModuleManager::MODULE_INPUT_PORT);
+        BasicPort count_port(
+          std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME),
+          sram_port_size * config_protocol.rle_count_size());
+        module_manager.add_port(module_id, count_port,
+                                ModuleManager::MODULE_INPUT_PORT);
+        BasicPort ready_port(std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME),
+                             sram_port_size);
+        module_manager.add_port(module_id, ready_port,
+                                ModuleManager::MODULE_OUTPUT_PORT);
+      }
       break;
     }
     case CONFIG_MEM_FRAME_BASED: {
@@ -945,6 +1300,34 @@ void add_top_module_sram_ports(
       module_manager.add_port(module_id, addr_port,
                               ModuleManager::MODULE_INPUT_PORT);
 
+      /* For broadcast, the address mask covers the MSBs of address port,
+       * which are used by the decoder of each region. The size is the
+       * largest decoder address among the regions */
+      if (true == config_protocol.frame_broadcast()) {
+        size_t addr_mask_size = 0;
+        for (const ConfigRegionId& config_region :
+             module_manager.regions(module_id)) {
+          size_t num_children =
+            module_manager.region_configurable_children(module_id,
+                                                        config_region)
+              .size();
+          /* Bypass the regions which are short-wired without decoders */
+          if ((0 == num_children) ||
+              ((1 == num_children) &&
+               (num_config_bits[config_region].first == max_num_config_bits))) {
+            continue;
+          }
+          addr_mask_size = std::max(
+            addr_mask_size, find_mux_local_decoder_addr_size(num_children));
+        }
+        if (0 < addr_mask_size) {
+          BasicPort addr_mask_port(std::string(DECODER_ADDRESS_MASK_PORT_NAME),
+                                   addr_mask_size);
+          module_manager.add_port(module_id, addr_mask_port,
+                                  ModuleManager::MODULE_INPUT_PORT);
+        }
+      }
+
       BasicPort din_port(std::string(DECODER_DATA_IN_PORT_NAME),
                          sram_port_size);
       module_manager.add_port(module_id, din_port,
@@ -1343,6 +1726,105 @@ static void add_top_module_nets_cmos_memory_bank_config_bus(
   }
 }
 
+/********************************************************************
+ * Add a run-length decompressor to the head of the configuration chain
+ * in each region, and connect its token ports to the top-level ports
+ *
+ *   ccff_head[i] ccff_rle_load[i] ccff_rle_count[i*K:i*K+K-1]
+ *        |            |                |
+ *        v            v                v
+ *   +-----------------------------------------+
+ *   |         RLE decompressor [i]            |
+ *   +-----------------------------------------+
+ *        |                             |
+ *        v                             v
+ *   1st memory module of region i   ccff_rle_ready[i]
+ *
+ * Note:
+ *  - The decompressors are not configurable children, so that they do not
+ *    affect the configuration bits of the fabric
+ *  - The instance id of a decompressor is the same as the region id
+ *********************************************************************/
+static int add_top_module_cmos_memory_chain_rle_decompressors(
+  ModuleManager& module_manager, const ModuleId& parent_module,
+  const CircuitLibrary& circuit_lib, const ConfigProtocol& config_protocol) {
+  size_t count_size = config_protocol.rle_count_size();
+  ModuleId rle_module = module_manager.find_module(
+    std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
+  if (false == module_manager.valid_module_id(rle_module)) {
+    rle_module = build_config_chain_rle_decompressor_module(
+      module_manager, circuit_lib, config_protocol.memory_model(), count_size);
+    if (false == module_manager.valid_module_id(rle_module)) {
+      return CMD_EXEC_FATAL_ERROR;
+    }
+  }
+
+  ModulePortId head_port = module_manager.find_module_port(
+    parent_module, std::string(CONFIGURABLE_MEMORY_CHAIN_IN_NAME));
+  ModulePortId load_port = module_manager.find_module_port(
+    parent_module, std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME));
+  ModulePortId count_port = module_manager.find_module_port(
+    parent_module, std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME));
+  ModulePortId ready_port = module_manager.find_module_port(
+    parent_module, std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME));
+
+  ModulePortId rle_head_port = module_manager.find_module_port(
+    rle_module, std::string(CONFIGURABLE_MEMORY_CHAIN_IN_NAME));
+  ModulePortId rle_load_port = module_manager.find_module_port(
+    rle_module, std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME));
+  ModulePortId rle_count_port = module_manager.find_module_port(
+    rle_module, std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME));
+  ModulePortId rle_ready_port = module_manager.find_module_port(
+    rle_module, std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME));
+
+  for (const ConfigRegionId& config_region :
+       module_manager.regions(parent_module)) {
+    size_t rle_instance =
+      module_manager.num_instance(parent_module, rle_module);
+    VTR_ASSERT(size_t(config_region) == rle_instance);
+    module_manager.add_child_module(parent_module, rle_module, false);
+    module_manager.set_child_instance_name(
+      parent_module, rle_module, rle_instance,
+      std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_INSTANCE_PREFIX) +
+        std::to_string(rle_instance));
+
+    /* Token value and load signal: one pin per region */
+    for (const auto& port_pair :
+         {std::make_pair(head_port, rle_head_port),
+          std::make_pair(load_port, rle_load_port)}) {
+      ModuleNetId net = create_module_source_pin_net(
+        module_manager, parent_module, parent_module, 0, port_pair.first,
+        module_manager.module_port(parent_module, port_pair.first)
+          .pins()[size_t(config_region)]);
+      module_manager.add_module_net_sink(
+        parent_module, net, rle_module, rle_instance, port_pair.second,
+        module_manager.module_port(rle_module, port_pair.second).pins()[0]);
+    }
+
+    /* Run length: K pins per region */
+    for (size_t ipin = 0; ipin < count_size; ++ipin) {
+      ModuleNetId net = create_module_source_pin_net(
+        module_manager, parent_module, parent_module, 0, count_port,
+        module_manager.module_port(parent_module, count_port)
+          .pins()[size_t(config_region) * count_size + ipin]);
+      module_manager.add_module_net_sink(
+        parent_module, net, rle_module, rle_instance, rle_count_port,
+        module_manager.module_port(rle_module, rle_count_port).pins()[ipin]);
+    }
+
+    /* Ready signal goes to the top-level port */
+    ModuleNetId net = create_module_source_pin_net(
+      module_manager, parent_module, rle_module, rle_instance, rle_ready_port,
+      module_manager.module_port(rle_module, rle_ready_port).pins()[0]);
+    module_manager.add_module_net_sink(
+      parent_module, net, parent_module, 0, ready_port,
+      module_manager.module_port(parent_module, ready_port)
+        .pins()[size_t(config_region)]);
+  }
+
+  return CMD_EXEC_SUCCESS;
+}
+
 /********************************************************************
  * Connect all the memory modules under the parent module in a chain
  *
@@ -1388,7 +1870,28 @@ static void add_top_module_nets_cmos_memory_chain_config_bus(
       ModulePortId net_sink_port_id;
       size_t net_sink_pin_id;
 
-      if (0 == mem_index) {
+      if ((0 == mem_index) && (0 < config_protocol.rle_count_size())) {
+        /* The chain is driven by the run-length decompressor of the region,
+         * whose instance id is the same as the region id */
+        net_src_module_id = module_manager.find_module(
+          std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
+        VTR_ASSERT(true == module_manager.valid_module_id(net_src_module_id));
+        net_src_instance_id = size_t(config_region);
+        net_src_port_id = module_manager.find_module_port(
+          net_src_module_id, std::string(CONFIGURABLE_MEMORY_CHAIN_OUT_NAME));
+        net_src_pin_id = 0;
+
+        /* Find the port name of next memory module */
+        std::string sink_port_name = generate_configuration_chain_head_name();
+        net_sink_module_id = module_manager.region_configurable_children(
+          parent_module, config_region)[mem_index];
+        net_sink_instance_id =
+          module_manager.region_configurable_child_instances(
+            parent_module, config_region)[mem_index];
+        net_sink_port_id =
+          module_manager.find_module_port(net_sink_module_id, sink_port_name);
+        net_sink_pin_id = 0;
+      } else if (0 == mem_index) {
         /* Find the port name of configuration chain head */
         std::string src_port_name = generate_sram_port_name(
           config_protocol.type(), CIRCUIT_MODEL_PORT_INPUT);
@@ -1599,6 +2102,11 @@ static void add_top_module_nets_cmos_memory_frame_short_config_bus(
  *     to other configuration regions
  *     The address lines will be aligned from the MSB of top-level address
  *lines!!!
+ *   - When the parent module has an address mask port (broadcast is
+ *     enabled), use a decoder with address mask and connect the mask lines
+ *     aligned from the MSB in the same way as the address lines.
+ *     The masked bits are ignored by the decoder so that the same frame
+ *     can be written to several memory modules in one cycle
  *   - Connect the enable (EN) port of memory modules under the parent module
  *     to the frame decoder outputs
  *   - Connect the data_in (Din) of parent module to the data_in of the all
@@ -1658,6 +2166,12 @@ static void add_top_module_nets_cmos_memory_frame_decoder_config_bus(
   BasicPort parent_addr_port_info =
     module_manager.module_port(parent_module, parent_addr_port);
 
+  /* The decoder requires an address mask when broadcast is enabled */
+  ModulePortId parent_addr_mask_port = module_manager.find_module_port(
+    parent_module, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+  bool use_addr_mask = module_manager.valid_module_port_id(
+    parent_module, parent_addr_mask_port);
+
   /* Find the decoder specification */
   size_t addr_size =
     find_mux_local_decoder_addr_size(configurable_children.size());
@@ -1667,17 +2181,21 @@ static void add_top_module_nets_cmos_memory_frame_decoder_config_bus(
   /* Search the decoder library and try to find one
    * If not found, create a new module and add it to the module manager
    */
-  DecoderId decoder_id =
-    decoder_lib.find_decoder(addr_size, data_size, true, false, false, false);
+  DecoderId decoder_id = decoder_lib.find_decoder(
+    addr_size, data_size, true, false, false, false, use_addr_mask);
   if (DecoderId::INVALID() == decoder_id) {
-    decoder_id =
-      decoder_lib.add_decoder(addr_size, data_size, true, false, false, false);
+    decoder_id = decoder_lib.add_decoder(addr_size, data_size, true, false,
+                                         false, false, use_addr_mask);
   }
   VTR_ASSERT(DecoderId::INVALID() != decoder_id);
 
   /* Create a module if not existed yet */
   std::string decoder_module_name =
     generate_memory_decoder_subckt_name(addr_size, data_size);
+  if (true == use_addr_mask) {
+    decoder_module_name =
+      generate_memory_decoder_with_addr_mask_subckt_name(addr_size, data_size);
+  }
   ModuleId decoder_module = module_manager.find_module(decoder_module_name);
   if (ModuleId::INVALID() == decoder_module) {
     decoder_module = build_frame_memory_decoder_module(module_manager,
@@ -1724,6 +2242,35 @@ static void add_top_module_nets_cmos_memory_frame_decoder_config_bus(
         .pins()[decoder_addr_port_info.get_width() - 1 - ipin]);
   }
 
+  /* Connect the address mask port of the parent module to the frame decoder
+   * address mask port, which are aligned from the MSB in the same way as the
+   * address port
+   */
+  if (true == use_addr_mask) {
+    BasicPort parent_addr_mask_port_info =
+      module_manager.module_port(parent_module, parent_addr_mask_port);
+    ModulePortId decoder_addr_mask_port = module_manager.find_module_port(
+      decoder_module, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+    BasicPort decoder_addr_mask_port_info =
+      module_manager.module_port(decoder_module, decoder_addr_mask_port);
+    VTR_ASSERT(decoder_addr_mask_port_info.get_width() <=
+               parent_addr_mask_port_info.get_width());
+    for (size_t ipin = 0; ipin < decoder_addr_mask_port_info.get_width();
+         ++ipin) {
+      ModuleNetId addr_mask_net = create_module_source_pin_net(
+        module_manager, parent_module, parent_module, 0, parent_addr_mask_port,
+        parent_addr_mask_port_info
+          .pins()[parent_addr_mask_port_info.get_width() - 1 - ipin]);
+      VTR_ASSERT(ModuleNetId::INVALID() != addr_mask_net);
+
+      module_manager.add_module_net_sink(
+        parent_module, addr_mask_net, decoder_module, decoder_instance,
+        decoder_addr_mask_port,
+        decoder_addr_mask_port_info
+          .pins()[decoder_addr_mask_port_info.get_width() - 1 - ipin]);
+    }
+  }
+
   /* Connect the address port of the parent module to the address port of
    * configurable children Note that we only connect to the last few bits of
    * address port
@@ -1933,6 +2480,13 @@ static void add_top_module_nets_cmos_memory_config_bus(
         CIRCUIT_MODEL_PORT_WL);
       break;
     case CONFIG_MEM_SCAN_CHAIN: {
+      if (0 < config_protocol.rle_count_size()) {
+        int status = add_top_module_cmos_memory_chain_rle_decompressors(
+          module_manager, parent_module, circuit_lib, config_protocol);
+        if (CMD_EXEC_SUCCESS != status) {
+          exit(1);
+        }
+      }
       add_top_module_nets_cmos_memory_chain_config_bus(
         module_manager, parent_module, config_protocol);
       break;
@@ -41,6 +41,11 @@ void shuffle_top_module_configurable_children(
   ModuleManager& module_manager, const ModuleId& top_module,
   const ConfigProtocol& config_protocol);
 
+void balance_top_module_configurable_regions(
+  ModuleManager& module_manager, const ModuleId& top_module,
+  const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
+  const ConfigProtocol& config_protocol);
+
 int load_top_module_memory_modules_from_fabric_key(
   ModuleManager& module_manager, const ModuleId& top_module,
   const CircuitLibrary& circuit_lib, const ConfigProtocol& config_protocol,
@@ -225,10 +225,11 @@ size_t ModuleManager::num_nets(const ModuleId& module) const {
 }
 
 /* Find the name of a module */
-std::string ModuleManager::module_name(const ModuleId& module_id) const {
+const std::string& ModuleManager::module_name(
+  const ModuleId& module_id) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_id(module_id));
-  return names_[module_id];
+  return global_name_pool().name(names_[module_id]);
 }
 
 ModuleManager::e_module_usage_type ModuleManager::module_usage(
@@ -310,14 +311,49 @@ BasicPort ModuleManager::module_port(const ModuleId& module_id,
 
 /* Find the module id by a given name, return invalid if not found */
 ModuleId ModuleManager::find_module(const std::string& name) const {
-  if (name_id_map_.find(name) != name_id_map_.end()) {
+  return find_module(global_name_pool().find(name));
+}
+
+/* Find the module id by a given interned name, return invalid if not found */
+ModuleId ModuleManager::find_module(const NameId& name) const {
+  auto result = name_id_map_.find(name);
+  if (result != name_id_map_.end()) {
     /* Find it, return the id */
-    return name_id_map_.at(name);
+    return result->second;
   }
   /* Not found, return an invalid id */
   return ModuleId::INVALID();
 }
 
+size_t ModuleManager::num_configurable_children(
+  const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  return configurable_children_[module].size();
+}
+
+size_t ModuleManager::num_configurable_block_children(
+  const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  build_config_counts();
+  return num_config_block_children_[module];
+}
+
+size_t ModuleManager::num_configurable_blocks(const ModuleId& module) const {
+  VTR_ASSERT(valid_module_id(module));
+  build_config_counts();
+  return num_config_blocks_[module];
+}
+
+size_t ModuleManager::num_configurable_leaves(
+  const ModuleId& module, const bool& exclude_frame_decoders) const {
+  VTR_ASSERT(valid_module_id(module));
+  build_config_counts();
+  if (true == exclude_frame_decoders) {
+    return num_config_leaves_wo_decoders_[module];
+  }
+  return num_config_leaves_[module];
+}
+
 /* Find the number of instances of a child module in the parent module */
 size_t ModuleManager::num_instance(const ModuleId& parent_module,
                                    const ModuleId& child_module) const {
@@ -332,9 +368,9 @@ size_t ModuleManager::num_instance(const ModuleId& parent_module,
 }
 
 /* Find the instance name of a child module */
-std::string ModuleManager::instance_name(const ModuleId& parent_module,
-                                         const ModuleId& child_module,
-                                         const size_t& instance_id) const {
+const std::string& ModuleManager::instance_name(
+  const ModuleId& parent_module, const ModuleId& child_module,
+  const size_t& instance_id) const {
   /* Validate the id of both parent and child modules */
   VTR_ASSERT(valid_module_id(parent_module));
   VTR_ASSERT(valid_module_id(child_module));
@@ -345,7 +381,8 @@ std::string ModuleManager::instance_name(const ModuleId& parent_module,
   VTR_ASSERT(child_index < children_[parent_module].size());
   /* Ensure that instance id is valid */
   VTR_ASSERT(instance_id < num_instance(parent_module, child_module));
-  return child_instance_names_[parent_module][child_index][instance_id];
+  return global_name_pool().name(
+    child_instance_names_[parent_module][child_index][instance_id]);
 }
 
 /* Find the instance id of a given instance name */
@@ -361,13 +398,18 @@ size_t ModuleManager::instance_id(const ModuleId& parent_module,
     find_child_module_index_in_parent_module(parent_module, child_module);
   VTR_ASSERT(child_index < children_[parent_module].size());
 
+  /* A name which is not interned cannot be used by any instance */
+  NameId instance_name_id = global_name_pool().find(instance_name);
+  if ((NameId::INVALID() == instance_name_id) && (!instance_name.empty())) {
+    return size_t(-1);
+  }
+
   /* Search the instance name list and try to find a match */
   for (size_t name_id = 0;
        name_id < child_instance_names_[parent_module][child_index].size();
        ++name_id) {
-    const std::string& name =
-      child_instance_names_[parent_module][child_index][name_id];
-    if (0 == name.compare(instance_name)) {
+    if (instance_name_id ==
+        child_instance_names_[parent_module][child_index][name_id]) {
       return name_id;
     }
   }
@@ -445,12 +487,12 @@ ModuleNetId ModuleManager::module_instance_port_net(
 }
 
 /* Find the name of net */
-std::string ModuleManager::net_name(const ModuleId& module,
-                                    const ModuleNetId& net) const {
+const std::string& ModuleManager::net_name(const ModuleId& module,
+                                           const ModuleNetId& net) const {
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_names_[module][net];
+  return global_name_pool().name(net_names_[module][net]);
 }
 
 /* Find the source modules of a net */
@@ -612,6 +654,91 @@ bool ModuleManager::net_sink_exist(const ModuleId& module,
   return false;
 }
 
+MemoryUsage ModuleManager::memory_usage() const {
+  MemoryUsage usage("ModuleManager", 0, ids_.size());
+
+  MemoryUsage& hierarchy = usage.add_child(MemoryUsage("hierarchy"));
+  hierarchy.add_child(container_memory_usage("names", names_));
+  hierarchy.add_child(container_memory_usage("usages", usages_));
+  hierarchy.add_child(container_memory_usage("parents", parents_));
+  hierarchy.add_child(container_memory_usage("children", children_));
+  hierarchy.add_child(
+    container_memory_usage("num_child_instances", num_child_instances_));
+  hierarchy.add_child(
+    container_memory_usage("child_instance_names", child_instance_names_));
+  hierarchy.add_child(MemoryUsage(
+    "configurable_children",
+    heap_memory_usage(configurable_children_) +
+      heap_memory_usage(configurable_child_instances_) +
+      heap_memory_usage(configurable_child_regions_) +
+      heap_memory_usage(configurable_child_coordinates_) +
+      heap_memory_usage(config_region_ids_) +
+      heap_memory_usage(config_region_children_)));
+  hierarchy.add_child(MemoryUsage("io_children",
+                                  heap_memory_usage(io_children_) +
+                                    heap_memory_usage(io_child_instances_) +
+                                    heap_memory_usage(io_child_coordinates_)));
+
+  size_t num_ports = 0;
+  for (const auto& module_ports : port_ids_) {
+    num_ports += module_ports.size();
+  }
+  usage.add_child(MemoryUsage(
+    "ports",
+    heap_memory_usage(port_ids_) + heap_memory_usage(ports_) +
+      heap_memory_usage(port_types_) + heap_memory_usage(port_is_mappable_io_) +
+      heap_memory_usage(port_is_wire_) + heap_memory_usage(port_is_register_) +
+      heap_memory_usage(port_preproc_flags_),
+    num_ports));
+
+  size_t num_nets = std::accumulate(num_nets_.begin(), num_nets_.end(),
+                                    size_t(0));
+  size_t num_net_srcs = 0;
+  for (const auto& module_net_srcs : net_src_ids_) {
+    for (const auto& net_srcs : module_net_srcs) {
+      num_net_srcs += net_srcs.size();
+    }
+  }
+  size_t num_net_sinks = 0;
+  for (const auto& module_net_sinks : net_sink_ids_) {
+    for (const auto& net_sinks : module_net_sinks) {
+      num_net_sinks += net_sinks.size();
+    }
+  }
+  MemoryUsage& nets = usage.add_child(
+    MemoryUsage("nets",
+                heap_memory_usage(num_nets_) +
+                  heap_memory_usage(invalid_net_ids_) +
+                  heap_memory_usage(net_names_),
+                num_nets));
+  nets.add_child(MemoryUsage(
+    "sources",
+    heap_memory_usage(net_src_ids_) + heap_memory_usage(net_src_terminal_ids_) +
+      heap_memory_usage(net_src_instance_ids_) +
+      heap_memory_usage(net_src_pin_ids_),
+    num_net_srcs));
+  nets.add_child(MemoryUsage(
+    "sinks",
+    heap_memory_usage(net_sink_ids_) +
+      heap_memory_usage(net_sink_terminal_ids_) +
+      heap_memory_usage(net_sink_instance_ids_) +
+      heap_memory_usage(net_sink_pin_ids_),
+    num_net_sinks));
+  nets.add_child(
+    container_memory_usage("terminal_storage", net_terminal_storage_));
+
+  MemoryUsage& lookups = usage.add_child(MemoryUsage("lookups"));
+  lookups.add_child(container_memory_usage("names", name_id_map_));
+  lookups.add_child(container_memory_usage("ports", port_lookup_));
+  lookups.add_child(container_memory_usage("nets", net_lookup_));
+  lookups.add_child(MemoryUsage(
+    "config_counts", heap_memory_usage(num_config_block_children_) +
+                       heap_memory_usage(num_config_blocks_) +
+                       heap_memory_usage(num_config_leaves_) +
+                       heap_memory_usage(num_config_leaves_wo_decoders_)));
+  return usage;
+}
+
 /******************************************************************************
  * Private Accessors
  ******************************************************************************/
@@ -631,6 +758,62 @@ size_t ModuleManager::find_child_module_index_in_parent_module(
   return size_t(-1);
 }
 
+/* Count the blocks and leaves in the configuration hierarchy of all the
+ * modules. Each module is visited once, as the counts of a module are
+ * shared by all its instances */
+void ModuleManager::build_config_counts() const {
+  if (true == config_counts_valid_) {
+    return;
+  }
+  num_config_block_children_.clear();
+  num_config_block_children_.resize(ids_.size(), 0);
+  num_config_blocks_.clear();
+  num_config_blocks_.resize(ids_.size(), size_t(-1));
+  num_config_leaves_.clear();
+  num_config_leaves_.resize(ids_.size(), 0);
+  num_config_leaves_wo_decoders_.clear();
+  num_config_leaves_wo_decoders_.resize(ids_.size(), 0);
+  for (const ModuleId& module : ids_) {
+    rec_build_config_counts(module);
+  }
+  config_counts_valid_ = true;
+}
+
+void ModuleManager::rec_build_config_counts(const ModuleId& module) const {
+  /* Skip the modules which have been counted */
+  if (size_t(-1) != num_config_blocks_[module]) {
+    return;
+  }
+
+  /* A module without configurable children is a leaf */
+  const std::vector<ModuleId>& children = configurable_children_[module];
+  if (children.empty()) {
+    num_config_blocks_[module] = 0;
+    num_config_leaves_[module] = 1;
+    num_config_leaves_wo_decoders_[module] = 1;
+    return;
+  }
+
+  /* Add the block at current level */
+  size_t num_blocks = 1;
+  for (size_t ichild = 0; ichild < children.size(); ++ichild) {
+    const ModuleId& child = children[ichild];
+    rec_build_config_counts(child);
+    if (!configurable_children_[child].empty()) {
+      num_config_block_children_[module]++;
+    }
+    num_blocks += num_config_blocks_[child];
+    num_config_leaves_[module] += num_config_leaves_[child];
+    /* The last child is the decoder for frame-based configuration protocol */
+    if ((2 <= children.size()) && (ichild == children.size() - 1)) {
+      continue;
+    }
+    num_config_leaves_wo_decoders_[module] +=
+      num_config_leaves_wo_decoders_[child];
+  }
+  num_config_blocks_[module] = num_blocks;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -638,8 +821,8 @@ size_t ModuleManager::find_child_module_index_in_parent_module(
 ModuleId ModuleManager::add_module(const std::string& name) {
   /* Find if the name has been used. If used, return an invalid Id and report
    * error! */
-  std::map<std::string, ModuleId>::iterator it = name_id_map_.find(name);
-  if (it != name_id_map_.end()) {
+  NameId name_id = global_name_pool().intern(name);
+  if (name_id_map_.find(name_id) != name_id_map_.end()) {
     return ModuleId::INVALID();
   }
 
@@ -648,7 +831,7 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   ids_.push_back(module);
 
   /* Allocate other attributes */
-  names_.push_back(name);
+  names_.push_back(name_id);
   usages_.push_back(NUM_MODULE_USAGE_TYPES);
   parents_.emplace_back();
   children_.emplace_back();
@@ -688,7 +871,9 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   net_sink_pin_ids_.emplace_back();
 
   /* Register in the name-to-id map */
-  name_id_map_[name] = module;
+  name_id_map_[name_id] = module;
+
+  invalidate_config_counts();
 
   /* Build port lookup */
   port_lookup_.emplace_back();
@@ -747,7 +932,7 @@ void ModuleManager::set_module_name(const ModuleId& module,
                                     const std::string& name) {
   /* Validate the id of module */
   VTR_ASSERT(valid_module_id(module));
-  names_[module] = name;
+  names_[module] = global_name_pool().intern(name);
 }
 
 void ModuleManager::set_module_usage(const ModuleId& module,
@@ -870,7 +1055,7 @@ void ModuleManager::set_child_instance_name(const ModuleId& parent_module,
   VTR_ASSERT(size_t(-1) != child_index);
   /* Set the name */
   child_instance_names_[parent_module][child_index][instance_id] =
-    instance_name;
+    global_name_pool().intern(instance_name);
 }
 
 /* Add a configurable child module to module
@@ -893,6 +1078,8 @@ void ModuleManager::add_configurable_child(const ModuleId& parent_module,
   configurable_child_regions_[parent_module].push_back(
     ConfigRegionId::INVALID());
   configurable_child_coordinates_[parent_module].push_back(coord);
+
+  invalidate_config_counts();
 }
 
 void ModuleManager::reserve_configurable_child(const ModuleId& parent_module,
@@ -1048,7 +1235,7 @@ void ModuleManager::set_net_name(const ModuleId& module, const ModuleNetId& net,
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  net_names_[module][net] = name;
+  net_names_[module][net] = global_name_pool().intern(name);
 }
 
 void ModuleManager::reserve_module_net_sources(const ModuleId& module,
@@ -1185,6 +1372,121 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(
   return net_sink;
 }
 
+/* Add a batch of connections as nets to the connection graph */
+std::vector<ModuleNetId> ModuleManager::add_module_nets(
+  const ModuleId& module, const ModuleNetBatch& batch) {
+  /* Validate the module id */
+  VTR_ASSERT(valid_module_id(module));
+
+  /* Validate each terminal only once, find its pair of module and port in the
+   * storage and its entry in the fast look-up for nets
+   * Pairs which are not in the storage yet are added
+   */
+  std::vector<size_t> terminal_storage_ids(batch.num_terminals());
+  std::vector<size_t> terminal_instances(batch.num_terminals());
+  std::vector<size_t> terminal_widths(batch.num_terminals());
+  std::vector<std::vector<ModuleNetId>*> terminal_nets(batch.num_terminals());
+  std::map<std::pair<ModuleId, ModulePortId>, size_t> storage_ids;
+  for (size_t iterm = 0; iterm < batch.num_terminals(); ++iterm) {
+    ModuleId term_module = batch.terminal_module(iterm);
+    ModulePortId term_port = batch.terminal_port(iterm);
+    VTR_ASSERT(valid_module_id(term_module));
+    VTR_ASSERT(valid_module_port_id(term_module, term_port));
+
+    std::pair<ModuleId, ModulePortId> terminal(term_module, term_port);
+    auto storage_result = storage_ids.find(terminal);
+    if (storage_result == storage_ids.end()) {
+      auto it = std::find(net_terminal_storage_.begin(),
+                          net_terminal_storage_.end(), terminal);
+      size_t storage_id = std::distance(net_terminal_storage_.begin(), it);
+      if (it == net_terminal_storage_.end()) {
+        net_terminal_storage_.push_back(terminal);
+      }
+      storage_result = storage_ids.emplace(terminal, storage_id).first;
+    }
+    terminal_storage_ids[iterm] = storage_result->second;
+
+    /* if it has the same id as module, our instance id will be by default 0 */
+    size_t term_instance = batch.terminal_instance(iterm);
+    if (term_module == module) {
+      term_instance = 0;
+    } else {
+      /* Check the instance id of the terminal module */
+      VTR_ASSERT(term_instance < num_instance(module, term_module));
+    }
+    terminal_instances[iterm] = term_instance;
+    terminal_widths[iterm] = ports_[term_module][term_port].get_width();
+    terminal_nets[iterm] =
+      &net_lookup_[module][term_module][term_instance][term_port];
+  }
+
+  /* Find the net of each connection in a single pass. A net is created when
+   * the source pin does not drive any net yet. The fast look-up is updated
+   * in the same pass, so that later connections see the nets of earlier
+   * connections as they would be added one by one
+   */
+  std::vector<ModuleNetId> connection_nets(batch.num_connections());
+  std::vector<bool> connection_new_nets(batch.num_connections(), false);
+  size_t num_new_nets = 0;
+  for (size_t iconn = 0; iconn < batch.num_connections(); ++iconn) {
+    size_t src_term = batch.connection_source_terminal(iconn);
+    size_t src_pin = batch.connection_source_pin(iconn);
+    size_t sink_term = batch.connection_sink_terminal(iconn);
+    size_t sink_pin = batch.connection_sink_pin(iconn);
+    /* Validate the pin ids are in the range of the port widths */
+    VTR_ASSERT(src_pin < terminal_widths[src_term]);
+    VTR_ASSERT(sink_pin < terminal_widths[sink_term]);
+
+    ModuleNetId net = (*terminal_nets[src_term])[src_pin];
+    if (ModuleNetId::INVALID() == net) {
+      net = ModuleNetId(num_nets_[module] + num_new_nets);
+      num_new_nets++;
+      connection_new_nets[iconn] = true;
+      (*terminal_nets[src_term])[src_pin] = net;
+    }
+    (*terminal_nets[sink_term])[sink_pin] = net;
+    connection_nets[iconn] = net;
+  }
+
+  /* Allocate net-related data structures in bulk */
+  num_nets_[module] += num_new_nets;
+  net_names_[module].resize(num_nets_[module]);
+  net_src_ids_[module].resize(num_nets_[module]);
+  net_src_terminal_ids_[module].resize(num_nets_[module]);
+  net_src_instance_ids_[module].resize(num_nets_[module]);
+  net_src_pin_ids_[module].resize(num_nets_[module]);
+  net_sink_ids_[module].resize(num_nets_[module]);
+  net_sink_terminal_ids_[module].resize(num_nets_[module]);
+  net_sink_instance_ids_[module].resize(num_nets_[module]);
+  net_sink_pin_ids_[module].resize(num_nets_[module]);
+
+  /* Add the sources of new nets and the sinks of all the nets */
+  for (size_t iconn = 0; iconn < batch.num_connections(); ++iconn) {
+    ModuleNetId net = connection_nets[iconn];
+    if (true == connection_new_nets[iconn]) {
+      size_t src_term = batch.connection_source_terminal(iconn);
+      net_src_ids_[module][net].push_back(
+        ModuleNetSrcId(net_src_ids_[module][net].size()));
+      net_src_terminal_ids_[module][net].push_back(
+        terminal_storage_ids[src_term]);
+      net_src_instance_ids_[module][net].push_back(
+        terminal_instances[src_term]);
+      net_src_pin_ids_[module][net].push_back(
+        batch.connection_source_pin(iconn));
+    }
+    size_t sink_term = batch.connection_sink_terminal(iconn);
+    net_sink_ids_[module][net].push_back(
+      ModuleNetSinkId(net_sink_ids_[module][net].size()));
+    net_sink_terminal_ids_[module][net].push_back(
+      terminal_storage_ids[sink_term]);
+    net_sink_instance_ids_[module][net].push_back(
+      terminal_instances[sink_term]);
+    net_sink_pin_ids_[module][net].push_back(batch.connection_sink_pin(iconn));
+  }
+
+  return connection_nets;
+}
+
 /******************************************************************************
  * Public Deconstructor
  ******************************************************************************/
@@ -1195,6 +1497,8 @@ void ModuleManager::clear_configurable_children(const ModuleId& parent_module) {
   configurable_child_instances_[parent_module].clear();
   configurable_child_regions_[parent_module].clear();
   configurable_child_coordinates_[parent_module].clear();
+
+  invalidate_config_counts();
 }
 
 void ModuleManager::clear_config_region(const ModuleId& parent_module) {
@@ -1261,4 +1565,8 @@ void ModuleManager::invalidate_port_lookup() { port_lookup_.clear(); }
 
 void ModuleManager::invalidate_net_lookup() { net_lookup_.clear(); }
 
+void ModuleManager::invalidate_config_counts() {
+  config_counts_valid_ = false;
+}
+
 } /* end namespace openfpga */
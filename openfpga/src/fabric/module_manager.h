@@ -6,8 +6,12 @@
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "module_manager_fwd.h"
+#include "module_net_batch.h"
+#include "openfpga_memory_usage.h"
+#include "openfpga_name_pool.h"
 #include "openfpga_port.h"
 #include "vtr_geometry.h"
 #include "vtr_vector.h"
@@ -211,7 +215,7 @@ class ModuleManager {
  public: /* Public accessors */
   size_t num_modules() const;
   size_t num_nets(const ModuleId& module) const;
-  std::string module_name(const ModuleId& module_id) const;
+  const std::string& module_name(const ModuleId& module_id) const;
   e_module_usage_type module_usage(const ModuleId& module_id) const;
   std::string module_port_type_str(
     const enum e_module_port_type& port_type) const;
@@ -227,13 +231,30 @@ class ModuleManager {
                         const ModulePortId& port_id) const;
   /* Find a module by a given name */
   ModuleId find_module(const std::string& name) const;
+  /* Find a module by a given name which is interned in the global name pool */
+  ModuleId find_module(const NameId& name) const;
+  /* Find the number of configurable children of a module */
+  size_t num_configurable_children(const ModuleId& module) const;
+  /* Find the number of configurable children of a module which have
+   * configurable children as well, i.e., which are blocks in bitstream */
+  size_t num_configurable_block_children(const ModuleId& module) const;
+  /* Find the number of blocks in the configuration hierarchy rooted at a
+   * module, including the module itself. Configurable children without any
+   * configurable children, i.e., configuration memories, are not blocks */
+  size_t num_configurable_blocks(const ModuleId& module) const;
+  /* Find the number of leaves in the configuration hierarchy rooted at a
+   * module. When frame decoders are excluded, the last configurable child
+   * of any module with 2+ configurable children is not counted, as it is
+   * the decoder of frame-based configuration protocol */
+  size_t num_configurable_leaves(const ModuleId& module,
+                                 const bool& exclude_frame_decoders) const;
   /* Find the number of instances of a child module in the parent module */
   size_t num_instance(const ModuleId& parent_module,
                       const ModuleId& child_module) const;
   /* Find the instance name of a child module */
-  std::string instance_name(const ModuleId& parent_module,
-                            const ModuleId& child_module,
-                            const size_t& instance_id) const;
+  const std::string& instance_name(const ModuleId& parent_module,
+                                   const ModuleId& child_module,
+                                   const size_t& instance_id) const;
   /* Find the instance id of a given instance name */
   size_t instance_id(const ModuleId& parent_module,
                      const ModuleId& child_module,
@@ -258,7 +279,8 @@ class ModuleManager {
                                        const ModulePortId& child_port,
                                        const size_t& child_pin) const;
   /* Find the name of net */
-  std::string net_name(const ModuleId& module, const ModuleNetId& net) const;
+  const std::string& net_name(const ModuleId& module,
+                              const ModuleNetId& net) const;
   /* Find the source modules of a net */
   vtr::vector<ModuleNetSrcId, ModuleId> net_source_modules(
     const ModuleId& module, const ModuleNetId& net) const;
@@ -294,10 +316,16 @@ class ModuleManager {
   bool net_sink_exist(const ModuleId& module, const ModuleNetId& net,
                       const ModuleId& sink_module, const size_t& instance_id,
                       const ModulePortId& sink_port, const size_t& sink_pin);
+  /* Estimate the heap memory of the module graph, grouped by members */
+  MemoryUsage memory_usage() const;
 
  private: /* Private accessors */
   size_t find_child_module_index_in_parent_module(
     const ModuleId& parent_module, const ModuleId& child_module) const;
+  /* Count the blocks and leaves in the configuration hierarchy of all the
+   * modules, in a bottom-up way */
+  void build_config_counts() const;
+  void rec_build_config_counts(const ModuleId& module) const;
 
  public: /* Public mutators */
   /* Add a module */
@@ -423,6 +451,17 @@ class ModuleManager {
                                       const ModulePortId& sink_port,
                                       const size_t& sink_pin);
 
+  /* Add a batch of connections as nets to the connection graph of the module.
+   * This is equivalent to the following for each connection in order:
+   * - find the net driven by the source pin, create a net and add the source
+   *   pin if there is none
+   * - add the sink pin to the net
+   * but the terminals are validated only once for the batch and the nets are
+   * allocated in bulk. Return the nets of the connections in order
+   */
+  std::vector<ModuleNetId> add_module_nets(const ModuleId& module,
+                                           const ModuleNetBatch& batch);
+
  public: /* Public deconstructors */
   /* This is a strong function which will remove all the configurable children
    * under a given parent module
@@ -461,12 +500,14 @@ class ModuleManager {
   void invalidate_name2id_map();
   void invalidate_port_lookup();
   void invalidate_net_lookup();
+  void invalidate_config_counts();
 
  private: /* Internal data */
   /* Module-level data */
   vtr::vector<ModuleId, ModuleId> ids_; /* Unique identifier for each Module */
-  vtr::vector<ModuleId, std::string>
-    names_; /* Unique identifier for each Module */
+  /* Names of modules, instances and nets are interned in the global name
+   * pool, where many of them are shared, e.g., the default instance names */
+  vtr::vector<ModuleId, NameId> names_; /* Unique identifier for each Module */
   vtr::vector<ModuleId, e_module_usage_type> usages_; /* Usage of each module */
   vtr::vector<ModuleId, std::vector<ModuleId>>
     parents_; /* Parent modules that include the module */
@@ -474,7 +515,7 @@ class ModuleManager {
     children_; /* Child modules that this module contain */
   vtr::vector<ModuleId, std::vector<size_t>>
     num_child_instances_; /* Number of children instance in each child module */
-  vtr::vector<ModuleId, std::vector<std::vector<std::string>>>
+  vtr::vector<ModuleId, std::vector<std::vector<NameId>>>
     child_instance_names_; /* Number of children instance in each child module
                             */
 
@@ -548,7 +589,7 @@ class ModuleManager {
   vtr::vector<ModuleId, size_t> num_nets_; /* List of nets for each Module */
   vtr::vector<ModuleId, std::unordered_set<ModuleNetId>>
     invalid_net_ids_; /* Invalid net ids */
-  vtr::vector<ModuleId, vtr::vector<ModuleNetId, std::string>>
+  vtr::vector<ModuleId, vtr::vector<ModuleNetId, NameId>>
     net_names_; /* Name of net */
 
   vtr::vector<
@@ -580,7 +621,7 @@ class ModuleManager {
     net_sink_pin_ids_; /* Pin ids that drive the net */
 
   /* fast look-up for module */
-  std::map<std::string, ModuleId> name_id_map_;
+  std::unordered_map<NameId, ModuleId> name_id_map_;
   /* fast look-up for ports */
   typedef vtr::vector<ModuleId, std::vector<std::vector<ModulePortId>>>
     PortLookup;
@@ -595,6 +636,15 @@ class ModuleManager {
   mutable NetLookup
     net_lookup_; /* [module_ids][module_ids][instance_ids][port_ids][pin_ids] */
 
+  /* Counts in the configuration hierarchy of each module, which are built
+   * at the first query after any configurable children is modified.
+   * Note that the counts should be queried by a single thread first */
+  mutable bool config_counts_valid_ = false;
+  mutable vtr::vector<ModuleId, size_t> num_config_block_children_;
+  mutable vtr::vector<ModuleId, size_t> num_config_blocks_;
+  mutable vtr::vector<ModuleId, size_t> num_config_leaves_;
+  mutable vtr::vector<ModuleId, size_t> num_config_leaves_wo_decoders_;
+
   /* Store pairs of a module and a port, which are frequently used in net
    * terminals (either source or sink)
    */
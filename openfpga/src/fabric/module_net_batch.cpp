@@ -0,0 +1,140 @@
+/************************************************************************
+ * Member functions for class ModuleNetBatch
+ ***********************************************************************/
+#include "module_net_batch.h"
+
+#include <algorithm>
+
+#include "vtr_assert.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/************************************************************************
+ * Public Accessors
+ ***********************************************************************/
+size_t ModuleNetBatch::num_terminals() const {
+  return terminal_modules_.size();
+}
+
+ModuleId ModuleNetBatch::terminal_module(const size_t& terminal) const {
+  VTR_ASSERT_SAFE(terminal < num_terminals());
+  return terminal_modules_[terminal];
+}
+
+size_t ModuleNetBatch::terminal_instance(const size_t& terminal) const {
+  VTR_ASSERT_SAFE(terminal < num_terminals());
+  return terminal_instances_[terminal];
+}
+
+ModulePortId ModuleNetBatch::terminal_port(const size_t& terminal) const {
+  VTR_ASSERT_SAFE(terminal < num_terminals());
+  return terminal_ports_[terminal];
+}
+
+size_t ModuleNetBatch::num_connections() const {
+  return connection_src_terminals_.size();
+}
+
+size_t ModuleNetBatch::connection_source_terminal(
+  const size_t& connection) const {
+  VTR_ASSERT_SAFE(connection < num_connections());
+  return connection_src_terminals_[connection];
+}
+
+size_t ModuleNetBatch::connection_source_pin(const size_t& connection) const {
+  VTR_ASSERT_SAFE(connection < num_connections());
+  return connection_src_pins_[connection];
+}
+
+size_t ModuleNetBatch::connection_sink_terminal(
+  const size_t& connection) const {
+  VTR_ASSERT_SAFE(connection < num_connections());
+  return connection_sink_terminals_[connection];
+}
+
+size_t ModuleNetBatch::connection_sink_pin(const size_t& connection) const {
+  VTR_ASSERT_SAFE(connection < num_connections());
+  return connection_sink_pins_[connection];
+}
+
+/************************************************************************
+ * Public Mutators
+ ***********************************************************************/
+void ModuleNetBatch::reserve(const size_t& num_terminals,
+                             const size_t& num_connections) {
+  terminal_modules_.reserve(num_terminals);
+  terminal_instances_.reserve(num_terminals);
+  terminal_ports_.reserve(num_terminals);
+
+  connection_src_terminals_.reserve(num_connections);
+  connection_src_pins_.reserve(num_connections);
+  connection_sink_terminals_.reserve(num_connections);
+  connection_sink_pins_.reserve(num_connections);
+}
+
+void ModuleNetBatch::add_bus_connection(
+  const ModuleId& src_module, const size_t& src_instance,
+  const ModulePortId& src_port, const std::vector<size_t>& src_pins,
+  const ModuleId& sink_module, const size_t& sink_instance,
+  const ModulePortId& sink_port, const std::vector<size_t>& sink_pins) {
+  VTR_ASSERT(src_pins.size() == sink_pins.size());
+  size_t src_terminal = add_terminal(src_module, src_instance, src_port);
+  size_t sink_terminal = add_terminal(sink_module, sink_instance, sink_port);
+  for (size_t ipin = 0; ipin < src_pins.size(); ++ipin) {
+    connection_src_terminals_.push_back(src_terminal);
+    connection_src_pins_.push_back(src_pins[ipin]);
+    connection_sink_terminals_.push_back(sink_terminal);
+    connection_sink_pins_.push_back(sink_pins[ipin]);
+  }
+}
+
+void ModuleNetBatch::add_connection(
+  const ModuleId& src_module, const size_t& src_instance,
+  const ModulePortId& src_port, const size_t& src_pin,
+  const ModuleId& sink_module, const size_t& sink_instance,
+  const ModulePortId& sink_port, const size_t& sink_pin) {
+  size_t src_terminal = add_terminal(src_module, src_instance, src_port);
+  size_t sink_terminal = add_terminal(sink_module, sink_instance, sink_port);
+  connection_src_terminals_.push_back(src_terminal);
+  connection_src_pins_.push_back(src_pin);
+  connection_sink_terminals_.push_back(sink_terminal);
+  connection_sink_pins_.push_back(sink_pin);
+}
+
+void ModuleNetBatch::clear() {
+  terminal_modules_.clear();
+  terminal_instances_.clear();
+  terminal_ports_.clear();
+
+  connection_src_terminals_.clear();
+  connection_src_pins_.clear();
+  connection_sink_terminals_.clear();
+  connection_sink_pins_.clear();
+}
+
+/************************************************************************
+ * Internal Mutators
+ ***********************************************************************/
+size_t ModuleNetBatch::add_terminal(const ModuleId& module,
+                                    const size_t& instance,
+                                    const ModulePortId& port) {
+  /* Consecutive connections are usually made between the same ports, e.g.,
+   * the routing tracks of a switch block. Reuse the terminals of the
+   * last connection */
+  size_t num_recent_terminals = std::min(num_terminals(), size_t(2));
+  for (size_t iterm = num_terminals() - num_recent_terminals;
+       iterm < num_terminals(); ++iterm) {
+    if ((module == terminal_modules_[iterm]) &&
+        (instance == terminal_instances_[iterm]) &&
+        (port == terminal_ports_[iterm])) {
+      return iterm;
+    }
+  }
+  terminal_modules_.push_back(module);
+  terminal_instances_.push_back(instance);
+  terminal_ports_.push_back(port);
+  return num_terminals() - 1;
+}
+
+} /* namespace openfpga ends */
@@ -0,0 +1,82 @@
+#ifndef MODULE_NET_BATCH_H
+#define MODULE_NET_BATCH_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <vector>
+
+#include "module_manager_fwd.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A batch of pin-to-pin connections to be added as nets to a module
+ * by ModuleManager::add_module_nets()
+ *
+ * Each connection is between a source pin and a sink pin, where the
+ * pins belong to terminals, i.e., a port of the module itself or
+ * a port of one of its child instances.
+ * Terminals are shared by all the pins of a port, so that they
+ * are validated only once when the batch is added to a module
+ *
+ * The batch does not check any module, instance or port;
+ * validation is done by the ModuleManager
+ *******************************************************************/
+class ModuleNetBatch {
+ public: /* Public accessors */
+  size_t num_terminals() const;
+  ModuleId terminal_module(const size_t& terminal) const;
+  size_t terminal_instance(const size_t& terminal) const;
+  ModulePortId terminal_port(const size_t& terminal) const;
+
+  size_t num_connections() const;
+  size_t connection_source_terminal(const size_t& connection) const;
+  size_t connection_source_pin(const size_t& connection) const;
+  size_t connection_sink_terminal(const size_t& connection) const;
+  size_t connection_sink_pin(const size_t& connection) const;
+
+ public: /* Public mutators */
+  /* Reserve a number of terminals and connections for memory efficiency */
+  void reserve(const size_t& num_terminals, const size_t& num_connections);
+  /* Connect the source pins to the sink pins one by one, i.e., the i-th
+   * source pin drives the i-th sink pin. The numbers of pins should match */
+  void add_bus_connection(const ModuleId& src_module,
+                          const size_t& src_instance,
+                          const ModulePortId& src_port,
+                          const std::vector<size_t>& src_pins,
+                          const ModuleId& sink_module,
+                          const size_t& sink_instance,
+                          const ModulePortId& sink_port,
+                          const std::vector<size_t>& sink_pins);
+  /* Connect a source pin to a sink pin */
+  void add_connection(const ModuleId& src_module, const size_t& src_instance,
+                      const ModulePortId& src_port, const size_t& src_pin,
+                      const ModuleId& sink_module, const size_t& sink_instance,
+                      const ModulePortId& sink_port, const size_t& sink_pin);
+  /* Remove all the terminals and connections */
+  void clear();
+
+ private: /* Internal mutators */
+  /* Add a terminal; the terminals of the last connection are reused when
+   * they are identical */
+  size_t add_terminal(const ModuleId& module, const size_t& instance,
+                      const ModulePortId& port);
+
+ private: /* Internal data */
+  /* Terminals */
+  std::vector<ModuleId> terminal_modules_;
+  std::vector<size_t> terminal_instances_;
+  std::vector<ModulePortId> terminal_ports_;
+
+  /* Connections */
+  std::vector<size_t> connection_src_terminals_;
+  std::vector<size_t> connection_src_pins_;
+  std::vector<size_t> connection_sink_terminals_;
+  std::vector<size_t> connection_sink_pins_;
+};
+
+} /* namespace openfpga ends */
+
+#endif
@@ -0,0 +1,258 @@
+/******************************************************************************
+ * This file includes member functions for the read-only views of bitstreams,
+ * which flatten the bitstream databases into plain arrays for scripting
+ * interfaces
+ ******************************************************************************/
+#include "bitstream_view.h"
+
+#include <algorithm>
+
+#include "bitstream_manager_utils.h"
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Create a window on the whole content of a vector */
+template <typename T>
+static BitstreamArrayView make_bitstream_array_view(const std::vector<T>& vec,
+                                                    const char& format) {
+  BitstreamArrayView view;
+  view.data = vec.data();
+  view.num_elements = vec.size();
+  view.element_size = sizeof(T);
+  view.format = format;
+  return view;
+}
+
+/**************************************************
+ * BitstreamManagerView: Constructors
+ *************************************************/
+BitstreamManagerView::BitstreamManagerView() = default;
+
+BitstreamManagerView::BitstreamManagerView(
+  const BitstreamManager& bitstream_manager) {
+  size_t num_blocks = bitstream_manager.num_blocks();
+
+  /* Bits: the bits of a block are always added in a row, so that the first
+   * bit found for a block is the offset of its bit range */
+  bit_values_.reserve(bitstream_manager.num_bits());
+  bit_blocks_.reserve(bitstream_manager.num_bits());
+  block_bit_offsets_.assign(num_blocks, 0);
+  block_num_bits_.assign(num_blocks, 0);
+  for (const ConfigBitId& bit : bitstream_manager.bits()) {
+    size_t block = size_t(bitstream_manager.bit_parent_block(bit));
+    VTR_ASSERT(block < num_blocks);
+    if (0 == block_num_bits_[block]) {
+      block_bit_offsets_[block] = size_t(bit);
+    }
+    block_num_bits_[block]++;
+    bit_values_.push_back(bitstream_manager.bit_value(bit) ? 1 : 0);
+    bit_blocks_.push_back(block);
+  }
+
+  /* Block tree, where the children are stored in a compressed sparse row */
+  block_parents_.assign(num_blocks, -1);
+  block_names_.resize(num_blocks);
+  block_child_offsets_.reserve(num_blocks + 1);
+  block_child_offsets_.push_back(0);
+  for (size_t iblk = 0; iblk < num_blocks; ++iblk) {
+    ConfigBlockId block(iblk);
+    if (!bitstream_manager.valid_block_id(block)) {
+      block_child_offsets_.push_back(block_children_.size());
+      continue;
+    }
+    ConfigBlockId parent = bitstream_manager.block_parent(block);
+    if (ConfigBlockId::INVALID() != parent) {
+      block_parents_[iblk] = size_t(parent);
+    }
+    block_names_[iblk] = bitstream_manager.block_name(block);
+    for (const ConfigBlockId& child :
+         bitstream_manager.block_children(block)) {
+      block_children_.push_back(size_t(child));
+    }
+    block_child_offsets_.push_back(block_children_.size());
+  }
+
+  /* Depth-first order from the top blocks, using an explicit stack as the
+   * hierarchy of a large fabric can be deep */
+  block_preorder_.reserve(num_blocks);
+  std::vector<uint64_t> stack;
+  std::vector<ConfigBlockId> top_blocks =
+    find_bitstream_manager_top_blocks(bitstream_manager);
+  for (auto it = top_blocks.rbegin(); it != top_blocks.rend(); ++it) {
+    stack.push_back(size_t(*it));
+  }
+  while (!stack.empty()) {
+    uint64_t block = stack.back();
+    stack.pop_back();
+    block_preorder_.push_back(block);
+    /* Push the children in reverse, so that they are visited in order */
+    for (uint64_t ichild = block_child_offsets_[block + 1];
+         ichild > block_child_offsets_[block]; --ichild) {
+      stack.push_back(block_children_[ichild - 1]);
+    }
+  }
+}
+
+/**************************************************
+ * BitstreamManagerView: Public aggregators
+ *************************************************/
+size_t BitstreamManagerView::num_bits() const { return bit_values_.size(); }
+
+size_t BitstreamManagerView::num_blocks() const {
+  return block_parents_.size();
+}
+
+/**************************************************
+ * BitstreamManagerView: Public accessors
+ *************************************************/
+BitstreamArrayView BitstreamManagerView::bit_values() const {
+  return make_bitstream_array_view(bit_values_, 'B');
+}
+
+BitstreamArrayView BitstreamManagerView::bit_blocks() const {
+  return make_bitstream_array_view(bit_blocks_, 'Q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_parents() const {
+  return make_bitstream_array_view(block_parents_, 'q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_bit_offsets() const {
+  return make_bitstream_array_view(block_bit_offsets_, 'Q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_num_bits() const {
+  return make_bitstream_array_view(block_num_bits_, 'Q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_child_offsets() const {
+  return make_bitstream_array_view(block_child_offsets_, 'Q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_children() const {
+  return make_bitstream_array_view(block_children_, 'Q');
+}
+
+BitstreamArrayView BitstreamManagerView::block_preorder() const {
+  return make_bitstream_array_view(block_preorder_, 'Q');
+}
+
+std::string BitstreamManagerView::block_name(const size_t& block) const {
+  VTR_ASSERT(block < block_names_.size());
+  return block_names_[block];
+}
+
+std::string BitstreamManagerView::block_path(const size_t& block) const {
+  VTR_ASSERT(block < block_names_.size());
+  std::vector<size_t> hierarchy;
+  for (int64_t curr = block; -1 != curr; curr = block_parents_[curr]) {
+    hierarchy.push_back(curr);
+  }
+  std::string path;
+  for (auto it = hierarchy.rbegin(); it != hierarchy.rend(); ++it) {
+    if (!path.empty()) {
+      path += std::string(".");
+    }
+    path += block_names_[*it];
+  }
+  return path;
+}
+
+/**************************************************
+ * FabricBitstreamView: Constructors
+ *************************************************/
+FabricBitstreamView::FabricBitstreamView()
+  : address_length_(0), wl_address_length_(0) {}
+
+FabricBitstreamView::FabricBitstreamView(
+  const FabricBitstream& fabric_bitstream)
+  : address_length_(0), wl_address_length_(0) {
+  size_t num_bits = fabric_bitstream.num_bits();
+  config_bits_.reserve(num_bits);
+  for (const FabricBitId& bit : fabric_bitstream.bits()) {
+    config_bits_.push_back(size_t(fabric_bitstream.config_bit(bit)));
+  }
+
+  /* Addresses are decoded to characters, with a fixed length per bit so that
+   * they can be reshaped into a matrix */
+  if (fabric_bitstream.use_address() && (0 < num_bits)) {
+    dins_.reserve(num_bits);
+    for (const FabricBitId& bit : fabric_bitstream.bits()) {
+      std::vector<char> addr = fabric_bitstream.bit_address(bit);
+      if (0 == address_length_) {
+        address_length_ = addr.size();
+        addresses_.reserve(num_bits * address_length_);
+      }
+      VTR_ASSERT(addr.size() == address_length_);
+      addresses_.insert(addresses_.end(), addr.begin(), addr.end());
+      dins_.push_back(fabric_bitstream.bit_din(bit) ? 1 : 0);
+    }
+  }
+  if (fabric_bitstream.use_wl_address() && (0 < num_bits)) {
+    for (const FabricBitId& bit : fabric_bitstream.bits()) {
+      std::vector<char> addr = fabric_bitstream.bit_wl_address(bit);
+      if (0 == wl_address_length_) {
+        wl_address_length_ = addr.size();
+        wl_addresses_.reserve(num_bits * wl_address_length_);
+      }
+      VTR_ASSERT(addr.size() == wl_address_length_);
+      wl_addresses_.insert(wl_addresses_.end(), addr.begin(), addr.end());
+    }
+  }
+
+  /* Regions, stored in a compressed sparse row */
+  region_offsets_.reserve(fabric_bitstream.num_regions() + 1);
+  region_offsets_.push_back(0);
+  for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
+    for (const FabricBitId& bit : fabric_bitstream.region_bits(region)) {
+      region_bits_.push_back(size_t(bit));
+    }
+    region_offsets_.push_back(region_bits_.size());
+  }
+}
+
+/**************************************************
+ * FabricBitstreamView: Public aggregators
+ *************************************************/
+size_t FabricBitstreamView::num_bits() const { return config_bits_.size(); }
+
+size_t FabricBitstreamView::num_regions() const {
+  return region_offsets_.empty() ? 0 : region_offsets_.size() - 1;
+}
+
+size_t FabricBitstreamView::address_length() const { return address_length_; }
+
+size_t FabricBitstreamView::wl_address_length() const {
+  return wl_address_length_;
+}
+
+/**************************************************
+ * FabricBitstreamView: Public accessors
+ *************************************************/
+BitstreamArrayView FabricBitstreamView::config_bits() const {
+  return make_bitstream_array_view(config_bits_, 'Q');
+}
+
+BitstreamArrayView FabricBitstreamView::dins() const {
+  return make_bitstream_array_view(dins_, 'B');
+}
+
+BitstreamArrayView FabricBitstreamView::addresses() const {
+  return make_bitstream_array_view(addresses_, 'B');
+}
+
+BitstreamArrayView FabricBitstreamView::wl_addresses() const {
+  return make_bitstream_array_view(wl_addresses_, 'B');
+}
+
+BitstreamArrayView FabricBitstreamView::region_offsets() const {
+  return make_bitstream_array_view(region_offsets_, 'Q');
+}
+
+BitstreamArrayView FabricBitstreamView::region_bits() const {
+  return make_bitstream_array_view(region_bits_, 'Q');
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,132 @@
+#ifndef BITSTREAM_VIEW_H
+#define BITSTREAM_VIEW_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bitstream_manager.h"
+#include "fabric_bitstream.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * A read-only window on a contiguous array of a bitstream view.
+ * The array is owned by the view which creates it, and is only valid
+ * as long as the view is alive.
+ * Scripting interfaces export it without copying the elements, e.g., as a
+ * memoryview in Python, which can be mapped by numpy.frombuffer()
+ *******************************************************************/
+struct BitstreamArrayView {
+  const void* data;
+  size_t num_elements;
+  size_t element_size;
+  /* Type of the elements, following the format characters of the Python
+   * struct module, e.g., 'B' for uint8_t, 'Q' for uint64_t */
+  char format;
+};
+
+/********************************************************************
+ * A read-only snapshot of an architecture bitstream (BitstreamManager),
+ * where the bits and the block tree are flattened into plain arrays,
+ * indexed by the ids of the bits and blocks:
+ * - bit_values[bit] is the value (0|1) of a bit
+ * - bit_blocks[bit] is the parent block of a bit
+ * - block_parents[block] is the parent block of a block, or -1 for a top
+ *   block
+ * - the bits of a block are in the range of
+ *   [block_bit_offsets[block], block_bit_offsets[block] +
+ *   block_num_bits[block])
+ * - the children of a block are
+ *   block_children[block_child_offsets[block] ..
+ *   block_child_offsets[block + 1] - 1]
+ * - block_preorder lists all the blocks in a depth-first order from the top
+ *   blocks, where a parent always comes before its children
+ *
+ * The snapshot does not refer to the bitstream manager after construction,
+ * so that it stays valid when the bitstream is rebuilt by other commands
+ *******************************************************************/
+class BitstreamManagerView {
+ public: /* Constructors */
+  BitstreamManagerView();
+  explicit BitstreamManagerView(const BitstreamManager& bitstream_manager);
+
+ public: /* Public aggregators */
+  size_t num_bits() const;
+  size_t num_blocks() const;
+
+ public: /* Public accessors: arrays */
+  BitstreamArrayView bit_values() const;
+  BitstreamArrayView bit_blocks() const;
+  BitstreamArrayView block_parents() const;
+  BitstreamArrayView block_bit_offsets() const;
+  BitstreamArrayView block_num_bits() const;
+  BitstreamArrayView block_child_offsets() const;
+  BitstreamArrayView block_children() const;
+  BitstreamArrayView block_preorder() const;
+
+ public: /* Public accessors: hierarchy */
+  std::string block_name(const size_t& block) const;
+  /* Full hierarchical path of a block, e.g., fpga_top.grid_clb_1__1_ */
+  std::string block_path(const size_t& block) const;
+
+ private: /* Internal data */
+  std::vector<uint8_t> bit_values_;
+  std::vector<uint64_t> bit_blocks_;
+  std::vector<int64_t> block_parents_;
+  std::vector<uint64_t> block_bit_offsets_;
+  std::vector<uint64_t> block_num_bits_;
+  std::vector<uint64_t> block_child_offsets_;
+  std::vector<uint64_t> block_children_;
+  std::vector<uint64_t> block_preorder_;
+  std::vector<std::string> block_names_;
+};
+
+/********************************************************************
+ * A read-only snapshot of a fabric bitstream (FabricBitstream), flattened
+ * into plain arrays indexed by the ids of the fabric bits:
+ * - config_bits[bit] is the bit in the architecture bitstream
+ * - dins[bit] is the data input (0|1) of a bit, when addresses are used
+ * - addresses[bit * address_length() + i] is the i-th character ('0', '1'
+ *   or 'x') of the (BL) address of a bit. Same for the WL addresses
+ * - the bits of a region are
+ *   region_bits[region_offsets[region] .. region_offsets[region + 1] - 1]
+ *******************************************************************/
+class FabricBitstreamView {
+ public: /* Constructors */
+  FabricBitstreamView();
+  explicit FabricBitstreamView(const FabricBitstream& fabric_bitstream);
+
+ public: /* Public aggregators */
+  size_t num_bits() const;
+  size_t num_regions() const;
+  /* Zero when the addresses are not used by the configuration protocol */
+  size_t address_length() const;
+  size_t wl_address_length() const;
+
+ public: /* Public accessors: arrays */
+  BitstreamArrayView config_bits() const;
+  BitstreamArrayView dins() const;
+  BitstreamArrayView addresses() const;
+  BitstreamArrayView wl_addresses() const;
+  BitstreamArrayView region_offsets() const;
+  BitstreamArrayView region_bits() const;
+
+ private: /* Internal data */
+  size_t address_length_;
+  size_t wl_address_length_;
+  std::vector<uint64_t> config_bits_;
+  std::vector<uint8_t> dins_;
+  std::vector<uint8_t> addresses_;
+  std::vector<uint8_t> wl_addresses_;
+  std::vector<uint64_t> region_offsets_;
+  std::vector<uint64_t> region_bits_;
+};
+
+} /* end namespace openfpga */
+
+#endif
@@ -21,105 +21,41 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-/********************************************************************
- * Estimate the number of blocks to be added to the whole device bitstream
- * This function will recursively walk through the module graph
- * from the specified top module and count the number of configurable children
- * which are the blocks that will be added to the bitstream manager
- *******************************************************************/
-static size_t rec_estimate_device_bitstream_num_blocks(
-  const ModuleManager& module_manager, const ModuleId& top_module) {
-  size_t num_blocks = 0;
-
-  /* Those child modules which have no children are
-   * actually configurable memory elements
-   * We skip them in couting
-   */
-  if (0 == module_manager.configurable_children(top_module).size()) {
-    return 0;
-  }
-
-  size_t num_configurable_children =
-    module_manager.configurable_children(top_module).size();
-  for (size_t ichild = 0; ichild < num_configurable_children; ++ichild) {
-    ModuleId child_module =
-      module_manager.configurable_children(top_module)[ichild];
-    num_blocks +=
-      rec_estimate_device_bitstream_num_blocks(module_manager, child_module);
-  }
-
-  /* Add the number of blocks at current level */
-  num_blocks++;
-
-  return num_blocks;
-}
-
 /********************************************************************
  * Estimate the number of configuration bits to be added to the whole device
- *bitstream This function will recursively walk through the module graph from
- *the specified top module and count the number of leaf configurable children
- * which are the bits that will be added to the bitstream manager
+ * bitstream, which is the number of leaf configurable children under the
+ * specified top module. The counts of other modules are memoized in the
+ * module manager, while the top module is special:
+ * Iterate over the multiple regions and visit each configuration child
+ * under any region. In each region, frame-based configuration protocol or
+ * memory bank protocol will contain decoders. We should bypass them when
+ * count the bitstream size
  *******************************************************************/
-static size_t rec_estimate_device_bitstream_num_bits(
+static size_t estimate_device_bitstream_num_bits(
   const ModuleManager& module_manager, const ModuleId& top_module,
-  const ModuleId& parent_module, const ConfigProtocol& config_protocol) {
+  const ConfigProtocol& config_protocol) {
   size_t num_bits = 0;
 
-  /* If a child module has no configurable children, this is a leaf node
-   * We can count it in. Otherwise, we should go recursively.
-   */
-  if (0 == module_manager.configurable_children(parent_module).size()) {
+  /* If a module has no configurable children, this is a leaf node */
+  if (0 == module_manager.num_configurable_children(top_module)) {
     return 1;
   }
 
-  /* Two cases to walk through configurable children:
-   * - For top-level module:
-   *   Iterate over the multiple regions and visit each configuration child
-   * under any region In each region, frame-based configuration protocol or
-   * memory bank protocol will contain decoders. We should bypass them when
-   * count the bitstream size
-   * - For other modules:
-   *   Iterate over the configurable children regardless of regions
-   */
-  if (parent_module == top_module) {
-    for (const ConfigRegionId& config_region :
-         module_manager.regions(parent_module)) {
-      size_t curr_region_num_config_child =
-        module_manager
-          .region_configurable_children(parent_module, config_region)
-          .size();
-      size_t num_child_to_skip =
-        estimate_num_configurable_children_to_skip_by_config_protocol(
-          config_protocol, curr_region_num_config_child);
-      curr_region_num_config_child -= num_child_to_skip;
-
-      /* Visit all the children in a recursively way */
-      for (size_t ichild = 0; ichild < curr_region_num_config_child; ++ichild) {
-        ModuleId child_module = module_manager.region_configurable_children(
-          parent_module, config_region)[ichild];
-        num_bits += rec_estimate_device_bitstream_num_bits(
-          module_manager, top_module, child_module, config_protocol);
-      }
-    }
-  } else {
-    VTR_ASSERT_SAFE(parent_module != top_module);
-
-    size_t num_configurable_children =
-      module_manager.configurable_children(parent_module).size();
-
-    /* Frame-based configuration protocol will have 1 decoder
-     * if there are more than 1 configurable children
-     */
-    if ((CONFIG_MEM_FRAME_BASED == config_protocol.type()) &&
-        (2 <= num_configurable_children)) {
-      num_configurable_children--;
-    }
-
-    for (size_t ichild = 0; ichild < num_configurable_children; ++ichild) {
-      ModuleId child_module =
-        module_manager.configurable_children(parent_module)[ichild];
-      num_bits += rec_estimate_device_bitstream_num_bits(
-        module_manager, top_module, child_module, config_protocol);
+  bool exclude_frame_decoders =
+    (CONFIG_MEM_FRAME_BASED == config_protocol.type());
+  for (const ConfigRegionId& config_region :
+       module_manager.regions(top_module)) {
+    std::vector<ModuleId> region_children =
+      module_manager.region_configurable_children(top_module, config_region);
+    size_t curr_region_num_config_child = region_children.size();
+    size_t num_child_to_skip =
+      estimate_num_configurable_children_to_skip_by_config_protocol(
+        config_protocol, curr_region_num_config_child);
+    curr_region_num_config_child -= num_child_to_skip;
+
+    for (size_t ichild = 0; ichild < curr_region_num_config_child; ++ichild) {
+      num_bits += module_manager.num_configurable_leaves(
+        region_children[ichild], exclude_frame_decoders);
     }
   }
 
@@ -160,23 +96,23 @@ BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
   VTR_ASSERT(true == openfpga_ctx.module_graph().valid_module_id(top_module));
 
   /* Estimate the number of blocks to be added to the database */
-  size_t num_blocks_to_reserve = rec_estimate_device_bitstream_num_blocks(
-    openfpga_ctx.module_graph(), top_module);
+  size_t num_blocks_to_reserve =
+    openfpga_ctx.module_graph().num_configurable_blocks(top_module);
   bitstream_manager.reserve_blocks(num_blocks_to_reserve);
   VTR_LOGV(verbose, "Reserved %lu configurable blocks\n",
            num_blocks_to_reserve);
 
   /* Estimate the number of bits to be added to the database */
-  size_t num_bits_to_reserve = rec_estimate_device_bitstream_num_bits(
-    openfpga_ctx.module_graph(), top_module, top_module,
+  size_t num_bits_to_reserve = estimate_device_bitstream_num_bits(
+    openfpga_ctx.module_graph(), top_module,
     openfpga_ctx.arch().config_protocol);
   bitstream_manager.reserve_bits(num_bits_to_reserve);
   VTR_LOGV(verbose, "Reserved %lu configuration bits\n", num_bits_to_reserve);
 
   /* Reserve child blocks for the top level block */
   bitstream_manager.reserve_child_blocks(
-    top_block, count_module_manager_module_configurable_children(
-                 openfpga_ctx.module_graph(), top_module));
+    top_block,
+    openfpga_ctx.module_graph().num_configurable_block_children(top_module));
 
   /* Create bitstream from grids */
   VTR_LOGV(verbose, "Building grid bitstream...\n");
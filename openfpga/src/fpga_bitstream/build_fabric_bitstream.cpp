@@ -641,6 +641,15 @@ static void build_module_fabric_dependent_bitstream(
       fabric_bitstream.reserve_bits(bitstream_manager.num_bits());
       fabric_bitstream.set_address_length(addr_port_info.get_width());
 
+      /* Find address mask port size, which is only available when the
+       * configuration protocol enables broadcast */
+      ModulePortId addr_mask_port = module_manager.find_module_port(
+        top_module, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+      if (module_manager.valid_module_port_id(top_module, addr_mask_port)) {
+        fabric_bitstream.set_address_mask_length(
+          module_manager.module_port(top_module, addr_mask_port).get_width());
+      }
+
       /* Avoid use don't care if there is only a region */
       char bitstream_dont_care_char = DONT_CARE_CHAR;
       if (1 == module_manager.regions(top_module).size()) {
@@ -701,6 +710,14 @@ static void build_module_fabric_dependent_bitstream(
 
         FabricBitRegionId fabric_bitstream_region =
           fabric_bitstream.add_region();
+        /* With address mask, the decoder of this region takes the MSBs of
+         * the address mask. A region with a single child is short-wired
+         * without any decoder, so none of the mask bits reach it */
+        if ((0 < fabric_bitstream.address_mask_length()) &&
+            (1 < configurable_children.size())) {
+          fabric_bitstream.set_region_address_mask_length(
+            fabric_bitstream_region, decoder_addr_port.get_width());
+        }
         rec_build_module_fabric_dependent_frame_bitstream(
           bitstream_manager, std::vector<ConfigBlockId>(1, top_block),
           module_manager, top_module, config_region,
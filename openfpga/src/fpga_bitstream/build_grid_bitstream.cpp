@@ -652,8 +652,7 @@ static void rec_build_physical_block_bitstream(
   /* Reserve child blocks for new created block */
   bitstream_manager.reserve_child_blocks(
     parent_configurable_block,
-    count_module_manager_module_configurable_children(module_manager,
-                                                      pb_module));
+    module_manager.num_configurable_block_children(pb_module));
 
   /* Recursively finish all the child pb_types*/
   if (false == is_primitive_pb_type(physical_pb_type)) {
@@ -760,8 +759,8 @@ static void build_physical_block_bitstream(
 
   /* Reserve child blocks for new created block */
   bitstream_manager.reserve_child_blocks(
-    grid_configurable_block, count_module_manager_module_configurable_children(
-                               module_manager, grid_module));
+    grid_configurable_block,
+    module_manager.num_configurable_block_children(grid_module));
 
   /* Iterate over the capacity of the grid
    * Now each physical tile may have a number of logical blocks
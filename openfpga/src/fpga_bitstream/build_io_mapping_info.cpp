@@ -12,6 +12,7 @@
 
 /* Headers from archopenfpga library */
 #include "build_io_mapping_info.h"
+#include "fabric_io_index.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
 
@@ -39,21 +40,9 @@ IoMap build_fpga_io_mapping_info(
   const std::vector<std::string>& output_port_prefix_to_remove) {
   IoMap io_map;
 
-  /* Only mappable i/o ports can be considered */
-  std::vector<ModulePortId> module_io_ports;
-  for (const ModuleManager::e_module_port_type& module_io_port_type :
-       MODULE_IO_PORT_TYPES) {
-    for (const ModulePortId& gpio_port_id :
-         module_manager.module_port_ids_by_type(top_module,
-                                                module_io_port_type)) {
-      /* Only care mappable I/O */
-      if (false ==
-          module_manager.port_is_mappable_io(top_module, gpio_port_id)) {
-        continue;
-      }
-      module_io_ports.push_back(gpio_port_id);
-    }
-  }
+  /* Find the mappable I/O port and pin of each I/O location once, rather
+   * than searching all the mappable I/O ports for each I/O block */
+  FabricIoIndex fabric_io_index(module_manager, top_module, io_location_map);
 
   /* Type mapping between VPR block and Module port */
   std::map<AtomBlockType, ModuleManager::e_module_port_type>
@@ -82,41 +71,13 @@ IoMap build_fpga_io_mapping_info(
      * Otherwise, should find a GPIN for INPAD
      *         or should find a GPOUT for OUTPAD
      */
+    const t_pl_loc& atom_loc =
+      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
     std::pair<ModulePortId, size_t> mapped_module_io_info =
-      std::make_pair(ModulePortId::INVALID(), -1);
-    for (const ModulePortId& module_io_port_id : module_io_ports) {
-      const BasicPort& module_io_port =
-        module_manager.module_port(top_module, module_io_port_id);
-
-      /* Find the index of the mapped GPIO in top-level FPGA fabric */
-      size_t temp_io_index = io_location_map.io_index(
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.sub_tile,
-        module_io_port.get_name());
-
-      /* Bypass invalid index (not mapped to this GPIO port) */
-      if (size_t(-1) == temp_io_index) {
-        continue;
-      }
-
-      /* If the port is an GPIO port, just use it */
-      if (ModuleManager::MODULE_GPIO_PORT ==
-          module_manager.port_type(top_module, module_io_port_id)) {
-        mapped_module_io_info =
-          std::make_pair(module_io_port_id, temp_io_index);
-        break;
-      }
-
-      /* If this is an INPAD, we can use an GPIN port (if available) */
-      if (atom_block_type_to_module_port_type[atom_ctx.nlist.block_type(
-            atom_blk)] ==
-          module_manager.port_type(top_module, module_io_port_id)) {
-        mapped_module_io_info =
-          std::make_pair(module_io_port_id, temp_io_index);
-        break;
-      }
-    }
+      fabric_io_index.find_io_pin(
+        atom_loc.x, atom_loc.y, atom_loc.sub_tile,
+        atom_block_type_to_module_port_type[atom_ctx.nlist.block_type(
+          atom_blk)]);
 
     /* We must find a valid one */
     VTR_ASSERT(true == module_manager.valid_module_port_id(
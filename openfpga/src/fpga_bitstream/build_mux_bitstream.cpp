@@ -52,7 +52,8 @@ size_t find_mux_default_path_id(const CircuitLibrary& circuit_lib,
  * Thanks to MuxGraph object has already describe the internal multiplexing
  * structure, bitstream generation is simply done by routing the signal
  * to from a given input to the output
- * All the memory bits can be generated by an API of MuxGraph
+ * All the memory bits are precomputed in the decode tables of the compiled
+ * MuxGraph, so that a look-up is sufficient for each multiplexer
  *
  * To be generic, this function only returns a vector bit values
  * without touching an bitstream-relate data structure
@@ -71,7 +72,7 @@ static std::vector<bool> build_cmos_mux_bitstream(
   if (!mux_lib.valid_mux_id(mux_graph_id)) {
     VTR_ASSERT(mux_lib.valid_mux_id(mux_graph_id));
   }
-  const MuxGraph mux_graph = mux_lib.mux_graph(mux_graph_id);
+  const CompiledMuxGraph& mux_graph = mux_lib.compiled_mux_graph(mux_graph_id);
 
   size_t datapath_id = path_id;
 
@@ -83,51 +84,45 @@ static std::vector<bool> build_cmos_mux_bitstream(
     VTR_ASSERT(datapath_id < mux_size);
   }
   /* Path id should makes sense */
-  VTR_ASSERT(datapath_id < mux_graph.inputs().size());
+  VTR_ASSERT(datapath_id < mux_graph.num_inputs());
   /* We should have only one output for this MUX! */
-  VTR_ASSERT(1 == mux_graph.outputs().size());
+  VTR_ASSERT(1 == mux_graph.num_outputs());
 
   /* Generate the memory bits */
-  vtr::vector<MuxMemId, bool> raw_bitstream = mux_graph.decode_memory_bits(
-    MuxInputId(datapath_id), mux_graph.output_id(mux_graph.outputs()[0]));
-
-  std::vector<bool> mux_bitstream;
-  for (const bool& bit : raw_bitstream) {
-    mux_bitstream.push_back(bit);
-  }
+  const std::vector<bool>& raw_bitstream =
+    mux_graph.decode_memory_bits(MuxInputId(datapath_id), MuxOutputId(0));
 
   /* Consider local encoder support, we need further encode the bitstream */
   if (false == circuit_lib.mux_use_local_encoder(mux_model)) {
-    return mux_bitstream;
+    return raw_bitstream;
   }
 
-  /* Clear the mux_bitstream, we need to apply encoding */
-  mux_bitstream.clear();
+  std::vector<bool> mux_bitstream;
 
   /* Encode the memory bits level by level,
    * One local encoder is used for each level of multiplexers
    */
-  for (const size_t& level : mux_graph.levels()) {
+  for (size_t level = 0; level < mux_graph.num_levels(); ++level) {
     /* The encoder will convert the path_id to a binary number
      * For example: when path_id=3 (use the 4th input), using a 2-input encoder
      * the sram_bits will be the 2-digit binary number of 3: 10
      */
     std::vector<size_t> encoder_data;
+    size_t num_mems_at_level = mux_graph.num_memory_bits_at_level(level);
 
     /* Exception: there is only 1 memory at this level, bitstream will not be
      * changed!!! */
-    if (1 == mux_graph.memories_at_level(level).size()) {
+    if (1 == num_mems_at_level) {
       mux_bitstream.push_back(
-        raw_bitstream[mux_graph.memories_at_level(level)[0]]);
+        raw_bitstream[size_t(mux_graph.memory_at_level(level, 0))]);
       continue;
     }
 
     /* Otherwise: we follow a regular recipe */
-    for (size_t mem_index = 0;
-         mem_index < mux_graph.memories_at_level(level).size(); ++mem_index) {
+    for (size_t mem_index = 0; mem_index < num_mems_at_level; ++mem_index) {
       /* Conversion rule: true = 1, false = 0 */
       if (true ==
-          raw_bitstream[mux_graph.memories_at_level(level)[mem_index]]) {
+          raw_bitstream[size_t(mux_graph.memory_at_level(level, mem_index))]) {
         encoder_data.push_back(mem_index);
       }
     }
@@ -137,13 +132,12 @@ static std::vector<bool> build_cmos_mux_bitstream(
     std::vector<size_t> encoder_addr;
     if (0 == encoder_data.size()) {
       encoder_addr =
-        itobin_vec(0, find_mux_local_decoder_addr_size(
-                        mux_graph.memories_at_level(level).size()));
+        itobin_vec(0, find_mux_local_decoder_addr_size(num_mems_at_level));
     } else {
       VTR_ASSERT(1 == encoder_data.size());
-      encoder_addr = itobin_vec(encoder_data[0],
-                                find_mux_local_decoder_addr_size(
-                                  mux_graph.memories_at_level(level).size()));
+      encoder_addr =
+        itobin_vec(encoder_data[0],
+                   find_mux_local_decoder_addr_size(num_mems_at_level));
     }
     /* Build final mux bitstream */
     for (const size_t& bit : encoder_addr) {
@@ -486,8 +486,7 @@ static void build_connection_block_bitstreams(
       VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
 
       /* Bypass empty blocks which have none configurable children */
-      if (0 == count_module_manager_module_configurable_children(module_manager,
-                                                                 cb_module)) {
+      if (0 == module_manager.num_configurable_block_children(cb_module)) {
         continue;
       }
 
@@ -502,8 +501,7 @@ static void build_connection_block_bitstreams(
       /* Reserve child blocks for new created block */
       bitstream_manager.reserve_child_blocks(
         cb_configurable_block,
-        count_module_manager_module_configurable_children(module_manager,
-                                                          cb_module));
+        module_manager.num_configurable_block_children(cb_module));
 
       build_connection_block_bitstream(
         bitstream_manager, cb_configurable_block, module_manager, circuit_lib,
@@ -568,8 +566,7 @@ void build_routing_bitstream(
       VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
       /* Bypass empty blocks which have none configurable children */
-      if (0 == count_module_manager_module_configurable_children(module_manager,
-                                                                 sb_module)) {
+      if (0 == module_manager.num_configurable_block_children(sb_module)) {
         continue;
       }
 
@@ -584,8 +581,7 @@ void build_routing_bitstream(
       /* Reserve child blocks for new created block */
       bitstream_manager.reserve_child_blocks(
         sb_configurable_block,
-        count_module_manager_module_configurable_children(module_manager,
-                                                          sb_module));
+        module_manager.num_configurable_block_children(sb_module));
 
       build_switch_block_bitstream(bitstream_manager, sb_configurable_block,
                                    module_manager, circuit_lib, mux_lib,
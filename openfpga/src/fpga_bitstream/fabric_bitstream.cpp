@@ -19,6 +19,7 @@ FabricBitstream::FabricBitstream() {
   invalid_bit_ids_.clear();
   address_length_ = 0;
   wl_address_length_ = 0;
+  address_mask_length_ = 0;
 
   num_regions_ = 0;
   invalid_region_ids_.clear();
@@ -129,6 +130,36 @@ bool FabricBitstream::use_address() const { return use_address_; }
 
 bool FabricBitstream::use_wl_address() const { return use_wl_address_; }
 
+size_t FabricBitstream::address_mask_length() const {
+  return address_mask_length_;
+}
+
+size_t FabricBitstream::region_address_mask_length(
+  const FabricBitRegionId& region_id) const {
+  VTR_ASSERT(true == valid_region_id(region_id));
+  return region_address_mask_lengths_[region_id];
+}
+
+MemoryUsage FabricBitstream::memory_usage() const {
+  MemoryUsage usage("FabricBitstream");
+  usage.add_child(MemoryUsage("regions",
+                              heap_memory_usage(invalid_region_ids_) +
+                                heap_memory_usage(region_bit_ids_) +
+                                heap_memory_usage(region_address_mask_lengths_),
+                              num_regions_));
+  MemoryUsage& bits = usage.add_child(MemoryUsage(
+    "bits",
+    heap_memory_usage(invalid_bit_ids_) + heap_memory_usage(config_bit_ids_),
+    num_bits_));
+  bits.add_child(MemoryUsage("addresses",
+                             heap_memory_usage(bit_address_1bits_) +
+                               heap_memory_usage(bit_address_xbits_) +
+                               heap_memory_usage(bit_wl_address_1bits_) +
+                               heap_memory_usage(bit_wl_address_xbits_)));
+  bits.add_child(container_memory_usage("dins", bit_dins_));
+  return usage;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
@@ -256,8 +287,23 @@ void FabricBitstream::set_wl_address_length(const size_t& length) {
   }
 }
 
+void FabricBitstream::set_address_mask_length(const size_t& length) {
+  if (true == use_address_) {
+    VTR_ASSERT(length <= address_length_);
+    address_mask_length_ = length;
+  }
+}
+
+void FabricBitstream::set_region_address_mask_length(
+  const FabricBitRegionId& region_id, const size_t& length) {
+  VTR_ASSERT(true == valid_region_id(region_id));
+  VTR_ASSERT(length <= address_mask_length_);
+  region_address_mask_lengths_[region_id] = length;
+}
+
 void FabricBitstream::reserve_regions(const size_t& num_regions) {
   region_bit_ids_.reserve(num_regions);
+  region_address_mask_lengths_.reserve(num_regions);
 }
 
 FabricBitRegionId FabricBitstream::add_region() {
@@ -265,6 +311,7 @@ FabricBitRegionId FabricBitstream::add_region() {
   /* Add a new bit, and allocate associated data structures */
   num_regions_++;
   region_bit_ids_.emplace_back();
+  region_address_mask_lengths_.push_back(0);
 
   return region;
 }
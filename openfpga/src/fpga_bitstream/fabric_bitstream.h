@@ -36,6 +36,7 @@
 
 #include "bitstream_manager_fwd.h"
 #include "fabric_bitstream_fwd.h"
+#include "openfpga_memory_usage.h"
 #include "vtr_vector.h"
 
 /* begin namespace openfpga */
@@ -144,6 +145,16 @@ class FabricBitstream {
   bool use_address() const;
   bool use_wl_address() const;
 
+  /* Find the size of address mask, which is used to broadcast a frame to
+   * multiple addresses. Zero means that the address mask is not available */
+  size_t address_mask_length() const;
+  /* Find the number of address mask bits which reach the top-level decoder of
+   * a region. These are the MSBs of the address mask. Zero means that the
+   * region has no top-level decoder, e.g., it is short-wired */
+  size_t region_address_mask_length(const FabricBitRegionId& region_id) const;
+  /* Estimate the heap memory of the bitstream, grouped by members */
+  MemoryUsage memory_usage() const;
+
  public: /* Public Mutators */
   /* Reserve config bits */
   void reserve_bits(const size_t& num_bits);
@@ -199,6 +210,12 @@ class FabricBitstream {
   void set_use_wl_address(const bool& enable);
   void set_wl_address_length(const size_t& length);
 
+  /* Set the size of address mask. Only applicable when address is used */
+  void set_address_mask_length(const size_t& length);
+  /* Set the number of address mask bits used by the decoder of a region */
+  void set_region_address_mask_length(const FabricBitRegionId& region_id,
+                                      const size_t& length);
+
  public: /* Public Validators */
   bool valid_bit_id(const FabricBitId& bit_id) const;
   bool valid_region_id(const FabricBitRegionId& bit_id) const;
@@ -214,6 +231,7 @@ class FabricBitstream {
   size_t num_regions_;
   std::unordered_set<FabricBitRegionId> invalid_region_ids_;
   vtr::vector<FabricBitRegionId, std::vector<FabricBitId>> region_bit_ids_;
+  vtr::vector<FabricBitRegionId, size_t> region_address_mask_lengths_;
 
   /* Unique id of a bit in the Bitstream */
   size_t num_bits_;
@@ -226,6 +244,7 @@ class FabricBitstream {
 
   size_t address_length_;
   size_t wl_address_length_;
+  size_t address_mask_length_;
 
   /* Address bits: this is designed for memory decoders
    * Here we store the encoded format of the address, and decoded to binary
@@ -2,6 +2,7 @@
  * This file includes functions that output a fabric-dependent
  * bitstream database to files in plain text
  *******************************************************************/
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <fstream>
@@ -78,7 +79,8 @@ static int write_flatten_fabric_bitstream_to_text_file(
 static int write_config_chain_fabric_bitstream_to_text_file(
   std::fstream& fp, const bool& fast_configuration,
   const bool& bit_value_to_skip, const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream) {
+  const FabricBitstream& fabric_bitstream,
+  const ConfigProtocol& config_protocol) {
   int status = 0;
 
   size_t regional_bitstream_max_size =
@@ -106,6 +108,20 @@ static int write_config_chain_fabric_bitstream_to_text_file(
      << regional_bitstream_max_size - num_bits_to_skip << std::endl;
   fp << "// Bitstream width (LSB -> MSB): " << fabric_bitstream.num_regions()
      << std::endl;
+  /* Each programming clock only shifts the last bits of the bitstream, which
+   * are required by the longest chain it drives */
+  if (1 < config_protocol.num_prog_clocks()) {
+    std::vector<size_t> prog_clock_bitstream_sizes =
+      find_configuration_chain_prog_clock_bitstream_sizes(
+        fabric_bitstream, bitstream_manager, config_protocol,
+        fast_configuration, bit_value_to_skip);
+    std::vector<BasicPort> prog_clock_pins = config_protocol.prog_clock_pins();
+    for (size_t iclk = 0; iclk < prog_clock_pins.size(); ++iclk) {
+      fp << "// Bitstream length of programming clock "
+         << prog_clock_pins[iclk].to_verilog_string() << ": "
+         << prog_clock_bitstream_sizes[iclk] << std::endl;
+    }
+  }
 
   /* Output bitstream data */
   for (size_t ibit = num_bits_to_skip; ibit < regional_bitstream_max_size;
@@ -121,6 +137,93 @@ static int write_config_chain_fabric_bitstream_to_text_file(
   return status;
 }
 
+/********************************************************************
+ * Write the fabric bitstream fitting a configuration chain protocol
+ * with run-length decompressors to a plain text file
+ * Each line contains a token for each region, i.e.,
+ *   <value of region 0><count of region 0>...<value of region N-1><count of
+ *region N-1> where the count is written from LSB to MSB
+ * As the number of tokens may be different between regions, the shorter
+ * regions are padded with zero tokens, which should be ignored. The number of
+ * valid tokens of each region is reported in the header.
+ *
+ * Return:
+ *  - 0 if succeed
+ *  - 1 if critical errors occured
+ *******************************************************************/
+static int write_config_chain_rle_fabric_bitstream_to_text_file(
+  std::fstream& fp, const bool& fast_configuration,
+  const bool& bit_value_to_skip, const size_t& count_size,
+  const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream) {
+  int status = 0;
+
+  size_t regional_bitstream_max_size =
+    find_fabric_regional_bitstream_max_size(fabric_bitstream);
+
+  /* Fast configuration is not supported yet, as the testbench does not check
+   * the configuration bits which are skipped */
+  if (true == fast_configuration) {
+    VTR_LOG_ERROR(
+      "Fast configuration is not supported by configuration chains with "
+      "run-length decompressors!\n");
+    return 1;
+  }
+  (void)bit_value_to_skip;
+  size_t num_bits_to_skip = 0;
+
+  ConfigChainRleFabricBitstream regional_tokens =
+    build_config_chain_rle_fabric_bitstream_by_region(
+      bitstream_manager, fabric_bitstream, count_size, num_bits_to_skip);
+
+  size_t max_num_tokens = 0;
+  for (const auto& region_tokens : regional_tokens) {
+    max_num_tokens = std::max(max_num_tokens, region_tokens.size());
+  }
+
+  /* Report the compression ratio */
+  size_t num_plain_bits =
+    (regional_bitstream_max_size - num_bits_to_skip) * regional_tokens.size();
+  size_t num_encoded_bits =
+    max_num_tokens * (1 + count_size) * regional_tokens.size();
+  VTR_LOG(
+    "Run-length encoding converts %lu bits into %lu tokens (%lu bits, %g% of "
+    "plain bitstream).\n",
+    num_plain_bits, max_num_tokens, num_encoded_bits,
+    0 == num_plain_bits
+      ? 0.
+      : 100. * (float)num_encoded_bits / (float)num_plain_bits);
+
+  /* Output bitstream size information */
+  fp << "// Bitstream length: " << max_num_tokens << std::endl;
+  fp << "// Bitstream width (LSB -> MSB): " << regional_tokens.size()
+     << " x <value 1 bit><run length " << count_size << " bits>" << std::endl;
+  fp << "// Number of tokens per region (LSB -> MSB):";
+  for (const auto& region_tokens : regional_tokens) {
+    fp << " " << region_tokens.size();
+  }
+  fp << std::endl;
+
+  /* Output bitstream data */
+  for (size_t itoken = 0; itoken < max_num_tokens; ++itoken) {
+    for (const auto& region_tokens : regional_tokens) {
+      ConfigChainRleToken token = {false, 0};
+      if (itoken < region_tokens.size()) {
+        token = region_tokens[itoken];
+      }
+      fp << token.value;
+      for (const size_t& count_bit : itobin_vec(token.count, count_size)) {
+        fp << count_bit;
+      }
+    }
+    if (itoken < max_num_tokens - 1) {
+      fp << std::endl;
+    }
+  }
+
+  return status;
+}
+
 /********************************************************************
  * Write the fabric bitstream fitting a memory bank protocol
  * to a plain text file
@@ -374,6 +477,71 @@ static int write_frame_based_fabric_bitstream_to_text_file(
   return status;
 }
 
+/********************************************************************
+ * Write the fabric bitstream fitting a frame-based protocol with address mask
+ * to a plain text file
+ * Identical frames are merged and broadcast through the address mask
+ *
+ * Return:
+ *  - 0 if succeed
+ *  - 1 if critical errors occured
+ *******************************************************************/
+static int write_frame_based_multicast_fabric_bitstream_to_text_file(
+  std::fstream& fp, const bool& fast_configuration,
+  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream) {
+  int status = 0;
+
+  FrameMulticastFabricBitstream fabric_words =
+    build_frame_based_multicast_fabric_bitstream(
+      fabric_bitstream, fast_configuration, bit_value_to_skip);
+
+  /* Report the number of writes saved by broadcast */
+  size_t num_frames =
+    build_frame_based_fabric_bitstream_by_address(fabric_bitstream).size();
+  if (true == fast_configuration) {
+    num_frames = find_frame_based_fast_configuration_fabric_bitstream_size(
+      fabric_bitstream, bit_value_to_skip);
+  }
+  VTR_LOG(
+    "Broadcast merges %lu frames into %lu writes (reduced by %g%).\n",
+    num_frames, fabric_words.size(),
+    0 == num_frames
+      ? 0.
+      : 100. * (float)(num_frames - fabric_words.size()) / (float)num_frames);
+
+  /* The address sizes and data input sizes are the same across any element,
+   * just get it from the 1st element to save runtime
+   */
+  size_t addr_size = 0;
+  size_t din_size = 0;
+  if (!fabric_words.empty()) {
+    addr_size = fabric_words.front().address.size();
+    din_size = fabric_words.front().din.size();
+  }
+
+  /* Output information about how to intepret the bitstream */
+  fp << "// Bitstream length: " << fabric_words.size() << std::endl;
+  fp << "// Bitstream width (LSB -> MSB): <address " << addr_size
+     << " bits><address mask " << fabric_bitstream.address_mask_length()
+     << " bits><data input " << din_size << " bits>" << std::endl;
+
+  for (const FrameMulticastFabricWord& word : fabric_words) {
+    /* Write address code */
+    fp << word.address;
+
+    /* Write address mask */
+    fp << word.address_mask;
+
+    /* Write data input */
+    for (const bool& din_value : word.din) {
+      fp << din_value;
+    }
+    fp << std::endl;
+  }
+
+  return status;
+}
+
 /********************************************************************
  * Write the fabric bitstream to a plain text file
  * Notes:
@@ -437,9 +605,16 @@ int write_fabric_bitstream_to_text_file(
         fp, bitstream_manager, fabric_bitstream);
       break;
     case CONFIG_MEM_SCAN_CHAIN:
-      status = write_config_chain_fabric_bitstream_to_text_file(
-        fp, apply_fast_configuration, bit_value_to_skip, bitstream_manager,
-        fabric_bitstream);
+      if (0 < config_protocol.rle_count_size()) {
+        status = write_config_chain_rle_fabric_bitstream_to_text_file(
+          fp, apply_fast_configuration, bit_value_to_skip,
+          config_protocol.rle_count_size(), bitstream_manager,
+          fabric_bitstream);
+      } else {
+        status = write_config_chain_fabric_bitstream_to_text_file(
+          fp, apply_fast_configuration, bit_value_to_skip, bitstream_manager,
+          fabric_bitstream, config_protocol);
+      }
       break;
     case CONFIG_MEM_QL_MEMORY_BANK: {
       /* Bitstream organization depends on the BL/WL protocols
@@ -473,8 +648,13 @@ int write_fabric_bitstream_to_text_file(
         fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
       break;
     case CONFIG_MEM_FRAME_BASED:
-      status = write_frame_based_fabric_bitstream_to_text_file(
-        fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
+      if (0 < fabric_bitstream.address_mask_length()) {
+        status = write_frame_based_multicast_fabric_bitstream_to_text_file(
+          fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
+      } else {
+        status = write_frame_based_fabric_bitstream_to_text_file(
+          fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
+      }
       break;
     default:
       VTR_LOGF_ERROR(__FILE__, __LINE__,
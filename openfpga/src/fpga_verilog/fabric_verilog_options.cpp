@@ -21,6 +21,7 @@ FabricVerilogOption::FabricVerilogOption() {
   default_net_type_ = VERILOG_DEFAULT_NET_TYPE_NONE;
   time_stamp_ = true;
   use_relative_path_ = false;
+  incremental_ = false;
   verbose_output_ = false;
 }
 
@@ -49,6 +50,8 @@ bool FabricVerilogOption::print_user_defined_template() const {
   return print_user_defined_template_;
 }
 
+bool FabricVerilogOption::incremental() const { return incremental_; }
+
 e_verilog_default_net_type FabricVerilogOption::default_net_type() const {
   return default_net_type_;
 }
@@ -106,6 +109,10 @@ void FabricVerilogOption::set_default_net_type(
   }
 }
 
+void FabricVerilogOption::set_incremental(const bool& enabled) {
+  incremental_ = enabled;
+}
+
 void FabricVerilogOption::set_verbose_output(const bool& enabled) {
   verbose_output_ = enabled;
 }
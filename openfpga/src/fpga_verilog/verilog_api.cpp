@@ -11,9 +11,12 @@
 
 /* Headers from openfpgautil library */
 #include "device_rr_gsb.h"
+#include "netlist_manifest.h"
+#include "openfpga_hash.h"
 #include "openfpga_digest.h"
 #include "openfpga_reserved_words.h"
 #include "verilog_auxiliary_netlists.h"
+#include "verilog_configured_fabric.h"
 #include "verilog_constants.h"
 #include "verilog_formal_random_top_testbench.h"
 #include "verilog_grid.h"
@@ -81,6 +84,23 @@ void fpga_fabric_verilog(
   std::string rr_dir_path = src_dir_path + std::string(DEFAULT_RR_DIR_NAME);
   create_directory(rr_dir_path);
 
+  /* The netlists of the decoders, routing blocks, grids and top-level module
+   * are skipped in incremental mode when their modules are the same as in the
+   * last run. Any change in the options which affect the content of these
+   * netlists invalidates all of them */
+  StableHash options_hash;
+  options_hash.add_integer(options.explicit_port_mapping());
+  options_hash.add_integer(options.default_net_type());
+  options_hash.add_integer(options.time_stamp());
+  NetlistManifest netlist_manifest(options_hash.to_string());
+  std::string manifest_fname =
+    src_dir_path + std::string(FABRIC_VERILOG_NETLIST_MANIFEST_FILE_NAME);
+  if (true == options.incremental()) {
+    read_netlist_manifest(netlist_manifest, manifest_fname);
+  }
+  /* The manifest is only valid after all the netlists are written */
+  remove_netlist_manifest(manifest_fname);
+
   /* Print Verilog files containing preprocessing flags */
   print_verilog_preprocessing_flags_netlist(std::string(src_dir_path), options);
 
@@ -91,30 +111,34 @@ void fpga_fabric_verilog(
    * to the module manager. Without the modules in the module manager, core
    * logic generation is not possible!!!
    */
-  print_verilog_submodule(module_manager, netlist_manager, blwl_sr_banks,
-                          mux_lib, decoder_lib, circuit_lib, submodule_dir_path,
+  print_verilog_submodule(module_manager, netlist_manager, netlist_manifest,
+                          blwl_sr_banks, mux_lib, decoder_lib, circuit_lib,
+                          submodule_dir_path,
                           std::string(DEFAULT_SUBMODULE_DIR_NAME), options);
 
   /* Generate routing blocks */
   if (true == options.compress_routing()) {
     print_verilog_unique_routing_modules(
-      netlist_manager, const_cast<const ModuleManager &>(module_manager),
-      device_rr_gsb, rr_dir_path, std::string(DEFAULT_RR_DIR_NAME), options);
+      netlist_manager, netlist_manifest,
+      const_cast<const ModuleManager &>(module_manager), device_rr_gsb,
+      rr_dir_path, std::string(DEFAULT_RR_DIR_NAME), options);
   } else {
     VTR_ASSERT(false == options.compress_routing());
     print_verilog_flatten_routing_modules(
-      netlist_manager, const_cast<const ModuleManager &>(module_manager),
-      device_rr_gsb, rr_dir_path, std::string(DEFAULT_RR_DIR_NAME), options);
+      netlist_manager, netlist_manifest,
+      const_cast<const ModuleManager &>(module_manager), device_rr_gsb,
+      rr_dir_path, std::string(DEFAULT_RR_DIR_NAME), options);
   }
 
   /* Generate grids */
   print_verilog_grids(
-    netlist_manager, const_cast<const ModuleManager &>(module_manager),
-    device_ctx, device_annotation, lb_dir_path,
-    std::string(DEFAULT_LB_DIR_NAME), options, options.verbose_output());
+    netlist_manager, netlist_manifest,
+    const_cast<const ModuleManager &>(module_manager), device_ctx,
+    device_annotation, lb_dir_path, std::string(DEFAULT_LB_DIR_NAME), options,
+    options.verbose_output());
 
   /* Generate FPGA fabric */
-  print_verilog_top_module(netlist_manager,
+  print_verilog_top_module(netlist_manager, netlist_manifest,
                            const_cast<const ModuleManager &>(module_manager),
                            src_dir_path, options);
 
@@ -123,6 +147,14 @@ void fpga_fabric_verilog(
     const_cast<const NetlistManager &>(netlist_manager), src_dir_path,
     circuit_lib, options.use_relative_path(), options.time_stamp());
 
+  /* Always record the netlists, so that the next run can be incremental */
+  write_netlist_manifest(netlist_manifest, manifest_fname);
+  if (true == options.incremental()) {
+    VTR_LOG("Reused %lu out of %lu netlists of routing blocks, grids and top\n",
+            netlist_manifest.num_reused_netlists(),
+            netlist_manifest.netlist_hashes().size());
+  }
+
   /* Given a brief stats on how many Verilog modules have been written to files
    */
   VTR_LOGV(options.verbose_output(), "Written %lu Verilog modules in total\n",
@@ -302,4 +334,25 @@ int fpga_verilog_simulation_task_info(
   return status;
 }
 
+/********************************************************************
+ * A top-level function of FPGA-Verilog which writes a flattened netlist
+ * of the FPGA fabric configured by the architecture bitstream.
+ * The netlist replaces the fabric netlists in fast gate-level simulation,
+ * while the primitive modules are still from the fabric netlists
+ ********************************************************************/
+int fpga_verilog_configured_fabric_netlist(
+  const ModuleManager &module_manager,
+  const BitstreamManager &bitstream_manager, const CircuitLibrary &circuit_lib,
+  const MuxLibrary &mux_lib, const std::string &file_path,
+  const bool &include_time_stamp, const bool &verbose) {
+  std::string dir_path = format_dir_path(find_path_dir_name(file_path));
+
+  /* Create directories */
+  create_directory(dir_path);
+
+  return print_verilog_configured_fabric_netlist(
+    module_manager, bitstream_manager, circuit_lib, mux_lib, file_path,
+    include_time_stamp, verbose);
+}
+
 } /* end namespace openfpga */
@@ -83,6 +83,12 @@ int fpga_verilog_simulation_task_info(
   const SimulationSetting& simulation_setting,
   const ConfigProtocol& config_protocol, const VerilogTestbenchOption& options);
 
+int fpga_verilog_configured_fabric_netlist(
+  const ModuleManager& module_manager,
+  const BitstreamManager& bitstream_manager, const CircuitLibrary& circuit_lib,
+  const MuxLibrary& mux_lib, const std::string& file_path,
+  const bool& include_time_stamp, const bool& verbose);
+
 } /* end namespace openfpga */
 
 #endif
@@ -0,0 +1,880 @@
+/********************************************************************
+ * This file includes functions to write a flattened Verilog netlist of
+ * a configured FPGA fabric, which is made for fast simulation:
+ * - configuration memories are replaced by the constants of a bitstream
+ * - configured routing multiplexers are collapsed into direct connections
+ * - LUT multiplexers are collapsed into truth tables
+ * - resources which cannot reach any I/O of the fabric are removed
+ * The other primitive modules are kept as instances, whose netlists are
+ * outputted by the fabric Verilog writer
+ *******************************************************************/
+#include <fstream>
+#include <map>
+#include <sstream>
+
+/* Headers from vtrutil library */
+#include "command_exit_codes.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "bitstream_manager_utils.h"
+#include "circuit_library_utils.h"
+#include "mux_utils.h"
+#include "openfpga_digest.h"
+#include "openfpga_naming.h"
+#include "verilog_configured_fabric.h"
+#include "verilog_writer_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* An instance of the module graph in the flattened netlist */
+struct ConfiguredFabricInstance {
+  ModuleId module;
+  /* Index of the node for the first pin of the first port */
+  size_t base_node;
+  /* Hierarchical name of the instance */
+  std::string name;
+};
+
+/* The elements driving the nets of the flattened netlist */
+enum e_configured_fabric_element_type {
+  CONFIGURED_FABRIC_INSTANCE, /* A primitive instance to be kept */
+  CONFIGURED_FABRIC_ASSIGN,   /* A configured routing multiplexer */
+  CONFIGURED_FABRIC_TABLE,    /* A configured LUT, or a constant */
+  NUM_CONFIGURED_FABRIC_ELEMENT_TYPES
+};
+
+struct ConfiguredFabricElement {
+  e_configured_fabric_element_type type;
+  /* The instance of a kept primitive */
+  size_t instance;
+  std::vector<size_t> inputs;
+  std::vector<size_t> outputs;
+  /* An assign inverts its input when the buffers of the multiplexer do */
+  bool inverted;
+  /* Output values of a truth table, indexed by the value of the inputs,
+   * where the first input is the LSB */
+  std::vector<bool> truth_table;
+  /* Elements with inout ports are always kept */
+  bool always_live;
+};
+
+/* Information about a multiplexer module required to collapse it */
+struct ConfiguredFabricMuxInfo {
+  MuxId mux;
+  /* Multiplexers which cannot be collapsed are kept as instances */
+  bool collapsible;
+  ModulePortId input_port;
+  ModulePortId sram_port;
+  /* Output pins, indexed by the output id of the multiplexer graph */
+  std::vector<std::pair<ModulePortId, size_t>> output_pins;
+  size_t const_input_value;
+  /* The constant input bypasses the input buffers, so the inversions of
+   * input and output buffers are kept apart */
+  bool input_inverted;
+  bool output_inverted;
+};
+
+/* The flattened netlist: each pin of each instance is a node, and the nodes
+ * connected by module nets are merged into a flat net */
+struct ConfiguredFabricNetlist {
+  std::vector<ConfiguredFabricInstance> instances;
+  /* Offset of each port in the nodes of an instance */
+  std::map<ModuleId, std::vector<size_t>> port_offsets;
+  /* Union-find forest on nodes */
+  std::vector<size_t> node_parents;
+  /* Constant value of each node, -1 means not constant */
+  std::vector<int> node_constants;
+  std::vector<ConfiguredFabricElement> elements;
+  /* Multiplexer instances to be collapsed when constants are known */
+  std::vector<size_t> mux_instances;
+  size_t num_memories = 0;
+};
+
+/********************************************************************
+ * Find the root node of a flat net, with path halving
+ *******************************************************************/
+static size_t find_configured_fabric_net(ConfiguredFabricNetlist& netlist,
+                                         size_t node) {
+  while (netlist.node_parents[node] != node) {
+    netlist.node_parents[node] =
+      netlist.node_parents[netlist.node_parents[node]];
+    node = netlist.node_parents[node];
+  }
+  return node;
+}
+
+static void merge_configured_fabric_nets(ConfiguredFabricNetlist& netlist,
+                                         const size_t& node_a,
+                                         const size_t& node_b) {
+  size_t net_a = find_configured_fabric_net(netlist, node_a);
+  size_t net_b = find_configured_fabric_net(netlist, node_b);
+  if (net_a != net_b) {
+    netlist.node_parents[std::max(net_a, net_b)] = std::min(net_a, net_b);
+  }
+}
+
+/********************************************************************
+ * Find the node of a pin of an instance
+ *******************************************************************/
+static size_t find_configured_fabric_node(
+  const ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const size_t& instance, const ModulePortId& port, const size_t& pin) {
+  const ConfiguredFabricInstance& inst = netlist.instances[instance];
+  BasicPort port_info = module_manager.module_port(inst.module, port);
+  VTR_ASSERT((pin >= port_info.get_lsb()) && (pin <= port_info.get_msb()));
+  return inst.base_node + netlist.port_offsets.at(inst.module)[size_t(port)] +
+         pin - port_info.get_lsb();
+}
+
+/********************************************************************
+ * Add an instance to the flattened netlist, and allocate nodes for
+ * all its pins
+ *******************************************************************/
+static size_t add_configured_fabric_instance(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const ModuleId& module, const std::string& name) {
+  auto result = netlist.port_offsets.find(module);
+  if (result == netlist.port_offsets.end()) {
+    std::vector<size_t> offsets;
+    size_t offset = 0;
+    for (const ModulePortId& port : module_manager.module_ports(module)) {
+      offsets.push_back(offset);
+      offset += module_manager.module_port(module, port).get_width();
+    }
+    offsets.push_back(offset);
+    result = netlist.port_offsets.emplace(module, offsets).first;
+  }
+
+  size_t instance = netlist.instances.size();
+  netlist.instances.push_back({module, netlist.node_parents.size(), name});
+  for (size_t inode = 0; inode < result->second.back(); ++inode) {
+    netlist.node_parents.push_back(netlist.node_parents.size());
+    netlist.node_constants.push_back(-1);
+  }
+  return instance;
+}
+
+/********************************************************************
+ * Fix the nodes of a port to constant values
+ *******************************************************************/
+static void set_configured_fabric_port_constants(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const size_t& instance, const ModulePortId& port,
+  const std::vector<bool>& values) {
+  BasicPort port_info =
+    module_manager.module_port(netlist.instances[instance].module, port);
+  VTR_ASSERT(values.size() == port_info.get_width());
+  for (size_t ipin = 0; ipin < values.size(); ++ipin) {
+    size_t node = find_configured_fabric_node(
+      netlist, module_manager, instance, port, port_info.pins()[ipin]);
+    netlist.node_constants[node] = values[ipin] ? 1 : 0;
+  }
+}
+
+/********************************************************************
+ * Keep an instance of a primitive module in the flattened netlist
+ *******************************************************************/
+static void add_configured_fabric_kept_instance(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const size_t& instance) {
+  ConfiguredFabricElement element;
+  element.type = CONFIGURED_FABRIC_INSTANCE;
+  element.instance = instance;
+  element.inverted = false;
+  element.always_live = false;
+
+  ModuleId module = netlist.instances[instance].module;
+  for (const ModulePortId& port : module_manager.module_ports(module)) {
+    ModuleManager::e_module_port_type port_type =
+      module_manager.port_type(module, port);
+    bool is_input = (ModuleManager::MODULE_OUTPUT_PORT != port_type) &&
+                    (ModuleManager::MODULE_GPOUT_PORT != port_type);
+    bool is_output = (ModuleManager::MODULE_OUTPUT_PORT == port_type) ||
+                     (ModuleManager::MODULE_GPOUT_PORT == port_type) ||
+                     (ModuleManager::MODULE_GPIO_PORT == port_type) ||
+                     (ModuleManager::MODULE_INOUT_PORT == port_type);
+    if (is_input && is_output) {
+      element.always_live = true;
+    }
+    for (const size_t& pin :
+         module_manager.module_port(module, port).pins()) {
+      size_t node = find_configured_fabric_node(netlist, module_manager,
+                                                instance, port, pin);
+      if (is_input) {
+        element.inputs.push_back(node);
+      }
+      if (is_output) {
+        element.outputs.push_back(node);
+      }
+    }
+  }
+  netlist.elements.push_back(element);
+}
+
+/********************************************************************
+ * Find the multiplexer modules and those which can be collapsed, i.e.,
+ * CMOS multiplexers without local encoders and inverting intermediate
+ * buffers
+ *******************************************************************/
+static std::map<ModuleId, ConfiguredFabricMuxInfo>
+build_configured_fabric_mux_info(const ModuleManager& module_manager,
+                                 const CircuitLibrary& circuit_lib,
+                                 const MuxLibrary& mux_lib) {
+  std::map<ModuleId, ConfiguredFabricMuxInfo> mux_info;
+  for (const MuxId& mux : mux_lib.muxes()) {
+    const MuxGraph& mux_graph = mux_lib.mux_graph(mux);
+    CircuitModelId mux_model = mux_lib.mux_circuit_model(mux);
+    ModuleId mux_module = module_manager.find_module(generate_mux_subckt_name(
+      circuit_lib, mux_model,
+      find_mux_num_datapath_inputs(circuit_lib, mux_model,
+                                   mux_graph.num_inputs()),
+      std::string("")));
+    if (false == module_manager.valid_module_id(mux_module)) {
+      continue;
+    }
+
+    ConfiguredFabricMuxInfo info;
+    info.mux = mux;
+    info.collapsible = true;
+    if ((CIRCUIT_MODEL_DESIGN_CMOS !=
+         circuit_lib.design_tech_type(mux_model)) ||
+        (true == circuit_lib.mux_use_local_encoder(mux_model))) {
+      info.collapsible = false;
+    }
+    if ((CIRCUIT_MODEL_LUT == circuit_lib.model_type(mux_model)) &&
+        (true == circuit_lib.is_lut_intermediate_buffered(mux_model)) &&
+        (CIRCUIT_MODEL_BUF_INV ==
+         circuit_lib.buffer_type(
+           circuit_lib.lut_intermediate_buffer_model(mux_model)))) {
+      info.collapsible = false;
+    }
+    if (false == info.collapsible) {
+      mux_info[mux_module] = info;
+      continue;
+    }
+
+    /* Find the ports in the same way as the multiplexer modules are built */
+    std::vector<CircuitPortId> mux_input_ports;
+    std::vector<CircuitPortId> mux_output_ports;
+    if (CIRCUIT_MODEL_LUT == circuit_lib.model_type(mux_model)) {
+      mux_input_ports =
+        find_lut_circuit_model_input_port(circuit_lib, mux_model, false, false);
+      mux_output_ports =
+        find_lut_circuit_model_output_port(circuit_lib, mux_model, false, true);
+    } else {
+      mux_input_ports = circuit_lib.model_ports_by_type(
+        mux_model, CIRCUIT_MODEL_PORT_INPUT, true);
+      mux_output_ports = circuit_lib.model_ports_by_type(
+        mux_model, CIRCUIT_MODEL_PORT_OUTPUT, false);
+    }
+    std::vector<CircuitPortId> mux_sram_ports =
+      find_circuit_regular_sram_ports(circuit_lib, mux_model);
+    VTR_ASSERT(1 == mux_input_ports.size());
+    VTR_ASSERT(1 == mux_sram_ports.size());
+
+    info.input_port = module_manager.find_module_port(
+      mux_module, circuit_lib.port_prefix(mux_input_ports[0]));
+    info.sram_port = module_manager.find_module_port(
+      mux_module, circuit_lib.port_prefix(mux_sram_ports[0]));
+    info.output_pins.resize(mux_graph.num_outputs(),
+                            std::make_pair(ModulePortId::INVALID(), 0));
+    for (const CircuitPortId& output_port : mux_output_ports) {
+      ModulePortId module_output_port = module_manager.find_module_port(
+        mux_module, circuit_lib.port_prefix(output_port));
+      for (const size_t& pin : circuit_lib.pins(output_port)) {
+        size_t output_node_level = mux_graph.num_node_levels() - 1;
+        if (size_t(-1) != circuit_lib.port_lut_frac_level(output_port)) {
+          output_node_level = circuit_lib.port_lut_frac_level(output_port);
+        }
+        size_t output_node_index_at_level = 0;
+        if (!circuit_lib.port_lut_output_mask(output_port).empty()) {
+          output_node_index_at_level =
+            circuit_lib.port_lut_output_mask(output_port).at(pin);
+        }
+        MuxNodeId node =
+          mux_graph.node_id(output_node_level, output_node_index_at_level);
+        VTR_ASSERT(MuxNodeId::INVALID() != node);
+        info.output_pins[size_t(mux_graph.output_id(node))] =
+          std::make_pair(module_output_port, pin);
+      }
+    }
+    info.const_input_value = 0;
+    if (true == circuit_lib.mux_add_const_input(mux_model)) {
+      info.const_input_value = circuit_lib.mux_const_input_value(mux_model);
+    }
+    /* Buffers at inputs and outputs may be inverters */
+    info.input_inverted =
+      (true == circuit_lib.is_input_buffered(mux_model)) &&
+      (CIRCUIT_MODEL_BUF_INV ==
+       circuit_lib.buffer_type(circuit_lib.input_buffer_model(mux_model)));
+    info.output_inverted =
+      (true == circuit_lib.is_output_buffered(mux_model)) &&
+      (CIRCUIT_MODEL_BUF_INV ==
+       circuit_lib.buffer_type(circuit_lib.output_buffer_model(mux_model)));
+    mux_info[mux_module] = info;
+  }
+  return mux_info;
+}
+
+/********************************************************************
+ * Find the input of a multiplexer which is routed to an output under
+ * given memory bits, by walking backward from the output node.
+ * Return an invalid id when no path is enabled by the memory bits
+ *******************************************************************/
+static MuxInputId find_configured_mux_input(const MuxGraph& mux_graph,
+                                            const std::vector<bool>& mem_bits,
+                                            const MuxOutputId& output) {
+  MuxNodeId node = mux_graph.node_id(output);
+  while (false == mux_graph.is_node_input(node)) {
+    MuxNodeId next_node = MuxNodeId::INVALID();
+    for (const MuxEdgeId& edge : mux_graph.node_in_edges(node)) {
+      MuxMemId mem = mux_graph.find_edge_mem(edge);
+      if (mux_graph.is_edge_use_inv_mem(edge) != mem_bits[size_t(mem)]) {
+        next_node = mux_graph.edge_src_nodes(edge)[0];
+        break;
+      }
+    }
+    if (MuxNodeId::INVALID() == next_node) {
+      return MuxInputId::INVALID();
+    }
+    node = next_node;
+  }
+  return mux_graph.input_id(node);
+}
+
+/********************************************************************
+ * Flatten a module in the module graph recursively.
+ * Configuration memories, whose instances are blocks with bits in the
+ * bitstream, are not flattened but replaced by constants.
+ * Multiplexers are not flattened, but collapsed later or kept as
+ * instances.
+ *******************************************************************/
+static void rec_flatten_configured_fabric_module(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const BitstreamManager& bitstream_manager,
+  const std::map<ModuleId, ConfiguredFabricMuxInfo>& mux_info,
+  const size_t& instance, const ConfigBlockId& block) {
+  ModuleId module = netlist.instances[instance].module;
+
+  /* Index the child blocks by their names */
+  std::map<std::string, ConfigBlockId> child_blocks;
+  if (ConfigBlockId::INVALID() != block) {
+    for (const ConfigBlockId& child_block :
+         bitstream_manager.block_children(block)) {
+      child_blocks[bitstream_manager.block_name(child_block)] = child_block;
+    }
+  }
+
+  std::map<std::pair<ModuleId, size_t>, size_t> child_instances;
+  for (const ModuleId& child_module : module_manager.child_modules(module)) {
+    for (const size_t& child_instance :
+         module_manager.child_module_instances(module, child_module)) {
+      std::string instance_name = module_manager.instance_name(
+        module, child_module, child_instance);
+      if (instance_name.empty()) {
+        instance_name = generate_instance_name(
+          module_manager.module_name(child_module), child_instance);
+      }
+      size_t child = add_configured_fabric_instance(
+        netlist, module_manager, child_module,
+        netlist.instances[instance].name + std::string(".") + instance_name);
+      child_instances[std::make_pair(child_module, child_instance)] = child;
+
+      /* A configuration memory: fix its outputs to the bitstream */
+      ConfigBlockId child_block = ConfigBlockId::INVALID();
+      auto block_result = child_blocks.find(instance_name);
+      if (block_result != child_blocks.end()) {
+        child_block = block_result->second;
+      }
+      if ((ConfigBlockId::INVALID() != child_block) &&
+          (0 < bitstream_manager.block_bits(child_block).size())) {
+        std::vector<bool> bit_values;
+        for (const ConfigBitId& bit :
+             bitstream_manager.block_bits(child_block)) {
+          bit_values.push_back(bitstream_manager.bit_value(bit));
+        }
+        ModulePortId data_port = module_manager.find_module_port(
+          child_module, generate_configurable_memory_data_out_name());
+        ModulePortId datab_port = module_manager.find_module_port(
+          child_module, generate_configurable_memory_inverted_data_out_name());
+        if ((true ==
+             module_manager.valid_module_port_id(child_module, data_port)) &&
+            (bit_values.size() ==
+             module_manager.module_port(child_module, data_port).get_width())) {
+          set_configured_fabric_port_constants(netlist, module_manager, child,
+                                               data_port, bit_values);
+          if (true ==
+              module_manager.valid_module_port_id(child_module, datab_port)) {
+            for (size_t ibit = 0; ibit < bit_values.size(); ++ibit) {
+              bit_values[ibit] = !bit_values[ibit];
+            }
+            set_configured_fabric_port_constants(netlist, module_manager, child,
+                                                 datab_port, bit_values);
+          }
+          netlist.num_memories++;
+          continue;
+        }
+      }
+
+      /* A constant generator */
+      if ((ModuleManager::MODULE_VDD ==
+           module_manager.module_usage(child_module)) ||
+          (ModuleManager::MODULE_VSS ==
+           module_manager.module_usage(child_module))) {
+        bool const_value = (ModuleManager::MODULE_VDD ==
+                            module_manager.module_usage(child_module));
+        for (const ModulePortId& port :
+             module_manager.module_ports(child_module)) {
+          set_configured_fabric_port_constants(
+            netlist, module_manager, child, port,
+            std::vector<bool>(
+              module_manager.module_port(child_module, port).get_width(),
+              const_value));
+        }
+        continue;
+      }
+
+      auto mux_result = mux_info.find(child_module);
+      if ((mux_info.end() != mux_result) &&
+          (true == mux_result->second.collapsible)) {
+        netlist.mux_instances.push_back(child);
+        continue;
+      }
+
+      if ((mux_info.end() != mux_result) ||
+          (module_manager.child_modules(child_module).empty())) {
+        add_configured_fabric_kept_instance(netlist, module_manager, child);
+        continue;
+      }
+
+      rec_flatten_configured_fabric_module(netlist, module_manager,
+                                           bitstream_manager, mux_info, child,
+                                           child_block);
+    }
+  }
+
+  /* Merge the nodes connected by each net */
+  for (const ModuleNetId& net : module_manager.module_nets(module)) {
+    std::vector<size_t> net_nodes;
+    auto add_terminal = [&](const ModuleId& term_module,
+                            const size_t& term_instance,
+                            const ModulePortId& term_port,
+                            const size_t& term_pin) {
+      size_t term_flat_instance = instance;
+      if ((term_module != module) || (0 != term_instance)) {
+        term_flat_instance =
+          child_instances.at(std::make_pair(term_module, term_instance));
+      }
+      net_nodes.push_back(find_configured_fabric_node(
+        netlist, module_manager, term_flat_instance, term_port, term_pin));
+    };
+    auto src_modules = module_manager.net_source_modules(module, net);
+    auto src_instances = module_manager.net_source_instances(module, net);
+    auto src_ports = module_manager.net_source_ports(module, net);
+    auto src_pins = module_manager.net_source_pins(module, net);
+    for (const ModuleNetSrcId& src :
+         module_manager.module_net_sources(module, net)) {
+      add_terminal(src_modules[src], src_instances[src], src_ports[src],
+                   src_pins[src]);
+    }
+    auto sink_modules = module_manager.net_sink_modules(module, net);
+    auto sink_instances = module_manager.net_sink_instances(module, net);
+    auto sink_ports = module_manager.net_sink_ports(module, net);
+    auto sink_pins = module_manager.net_sink_pins(module, net);
+    for (const ModuleNetSinkId& sink :
+         module_manager.module_net_sinks(module, net)) {
+      add_terminal(sink_modules[sink], sink_instances[sink], sink_ports[sink],
+                   sink_pins[sink]);
+    }
+    for (size_t inode = 1; inode < net_nodes.size(); ++inode) {
+      merge_configured_fabric_nets(netlist, net_nodes[0], net_nodes[inode]);
+    }
+  }
+}
+
+/********************************************************************
+ * Find the constant value of each flat net
+ *******************************************************************/
+static std::vector<int> find_configured_fabric_net_constants(
+  ConfiguredFabricNetlist& netlist) {
+  std::vector<int> net_constants(netlist.node_parents.size(), -1);
+  for (size_t node = 0; node < netlist.node_parents.size(); ++node) {
+    if (-1 != netlist.node_constants[node]) {
+      net_constants[find_configured_fabric_net(netlist, node)] =
+        netlist.node_constants[node];
+    }
+  }
+  return net_constants;
+}
+
+/********************************************************************
+ * Collapse the multiplexer instances:
+ * - when all the memory bits are constant, each output is connected to
+ *   the selected input
+ * - when all the data inputs are constant, e.g., LUTs, each output is a
+ *   truth table of the memory bits
+ * - otherwise, the multiplexer is kept as an instance
+ * Return the number of multiplexers collapsed
+ *******************************************************************/
+static size_t collapse_configured_fabric_muxes(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager,
+  const MuxLibrary& mux_lib,
+  const std::map<ModuleId, ConfiguredFabricMuxInfo>& mux_info,
+  const std::vector<int>& net_constants) {
+  /* Limit the size of truth tables */
+  constexpr size_t MAX_TRUTH_TABLE_NUM_INPUTS = 10;
+
+  size_t num_collapsed_muxes = 0;
+  for (const size_t& instance : netlist.mux_instances) {
+    const ConfiguredFabricMuxInfo& info =
+      mux_info.at(netlist.instances[instance].module);
+    const MuxGraph& mux_graph = mux_lib.mux_graph(info.mux);
+    ModuleId module = netlist.instances[instance].module;
+    BasicPort input_port = module_manager.module_port(module, info.input_port);
+    BasicPort sram_port = module_manager.module_port(module, info.sram_port);
+
+    std::vector<size_t> data_nodes;
+    bool const_data = true;
+    for (const size_t& pin : input_port.pins()) {
+      data_nodes.push_back(find_configured_fabric_node(
+        netlist, module_manager, instance, info.input_port, pin));
+      const_data &=
+        (-1 != net_constants[find_configured_fabric_net(netlist,
+                                                        data_nodes.back())]);
+    }
+    std::vector<size_t> mem_nodes;
+    std::vector<bool> mem_bits;
+    bool const_mem = true;
+    for (const size_t& pin : sram_port.pins()) {
+      mem_nodes.push_back(find_configured_fabric_node(
+        netlist, module_manager, instance, info.sram_port, pin));
+      int mem_constant =
+        net_constants[find_configured_fabric_net(netlist, mem_nodes.back())];
+      const_mem &= (-1 != mem_constant);
+      mem_bits.push_back(1 == mem_constant);
+    }
+
+    if ((false == const_mem) &&
+        ((false == const_data) ||
+         (MAX_TRUTH_TABLE_NUM_INPUTS < mem_nodes.size()))) {
+      add_configured_fabric_kept_instance(netlist, module_manager, instance);
+      continue;
+    }
+
+    /* Find the output value when a data input is routed, which may be the
+     * constant input. Only the data inputs are driven through the input
+     * buffers */
+    bool data_inverted = (info.input_inverted != info.output_inverted);
+    auto data_value = [&](const MuxInputId& input) {
+      if (size_t(input) < data_nodes.size()) {
+        return (1 == net_constants[find_configured_fabric_net(
+                       netlist, data_nodes[size_t(input)])]) != data_inverted;
+      }
+      return (1 == info.const_input_value) != info.output_inverted;
+    };
+
+    for (size_t ioutput = 0; ioutput < info.output_pins.size(); ++ioutput) {
+      if (ModulePortId::INVALID() == info.output_pins[ioutput].first) {
+        continue;
+      }
+      ConfiguredFabricElement element;
+      element.instance = instance;
+      element.inverted = data_inverted;
+      element.always_live = false;
+      element.outputs.push_back(find_configured_fabric_node(
+        netlist, module_manager, instance, info.output_pins[ioutput].first,
+        info.output_pins[ioutput].second));
+
+      if (true == const_mem) {
+        MuxInputId input =
+          find_configured_mux_input(mux_graph, mem_bits, MuxOutputId(ioutput));
+        /* No path is enabled, leave the output floating */
+        if (MuxInputId::INVALID() == input) {
+          continue;
+        }
+        if (size_t(input) < data_nodes.size()) {
+          element.type = CONFIGURED_FABRIC_ASSIGN;
+          element.inputs.push_back(data_nodes[size_t(input)]);
+        } else {
+          element.type = CONFIGURED_FABRIC_TABLE;
+          element.truth_table.push_back(data_value(input));
+        }
+      } else {
+        element.type = CONFIGURED_FABRIC_TABLE;
+        element.inputs = mem_nodes;
+        for (size_t pattern = 0; pattern < (size_t(1) << mem_nodes.size());
+             ++pattern) {
+          std::vector<bool> pattern_bits(mem_nodes.size());
+          for (size_t imem = 0; imem < mem_nodes.size(); ++imem) {
+            pattern_bits[imem] = (1 == ((pattern >> imem) & 1));
+          }
+          MuxInputId input = find_configured_mux_input(
+            mux_graph, pattern_bits, MuxOutputId(ioutput));
+          element.truth_table.push_back(
+            (MuxInputId::INVALID() != input) && data_value(input));
+        }
+      }
+      netlist.elements.push_back(element);
+    }
+    num_collapsed_muxes++;
+  }
+  return num_collapsed_muxes;
+}
+
+/********************************************************************
+ * Find the elements which drive any output of the top module,
+ * by walking backward from the outputs
+ *******************************************************************/
+static std::vector<bool> find_configured_fabric_live_elements(
+  ConfiguredFabricNetlist& netlist, const ModuleManager& module_manager) {
+  std::vector<bool> live_nets(netlist.node_parents.size(), false);
+  std::vector<std::vector<size_t>> net_drivers(netlist.node_parents.size());
+  for (size_t ielement = 0; ielement < netlist.elements.size(); ++ielement) {
+    for (const size_t& node : netlist.elements[ielement].outputs) {
+      net_drivers[find_configured_fabric_net(netlist, node)].push_back(
+        ielement);
+    }
+  }
+
+  std::vector<size_t> net_queue;
+  auto visit_net = [&](const size_t& node) {
+    size_t net = find_configured_fabric_net(netlist, node);
+    if (false == live_nets[net]) {
+      live_nets[net] = true;
+      net_queue.push_back(net);
+    }
+  };
+
+  ModuleId top_module = netlist.instances[0].module;
+  for (const ModulePortId& port : module_manager.module_ports(top_module)) {
+    ModuleManager::e_module_port_type port_type =
+      module_manager.port_type(top_module, port);
+    if ((ModuleManager::MODULE_OUTPUT_PORT != port_type) &&
+        (ModuleManager::MODULE_GPOUT_PORT != port_type) &&
+        (ModuleManager::MODULE_GPIO_PORT != port_type) &&
+        (ModuleManager::MODULE_INOUT_PORT != port_type)) {
+      continue;
+    }
+    for (const size_t& pin :
+         module_manager.module_port(top_module, port).pins()) {
+      visit_net(
+        find_configured_fabric_node(netlist, module_manager, 0, port, pin));
+    }
+  }
+
+  std::vector<bool> live_elements(netlist.elements.size(), false);
+  auto visit_element = [&](const size_t& ielement) {
+    if (true == live_elements[ielement]) {
+      return;
+    }
+    live_elements[ielement] = true;
+    for (const size_t& node : netlist.elements[ielement].inputs) {
+      visit_net(node);
+    }
+  };
+  for (size_t ielement = 0; ielement < netlist.elements.size(); ++ielement) {
+    if (true == netlist.elements[ielement].always_live) {
+      visit_element(ielement);
+    }
+  }
+  while (!net_queue.empty()) {
+    size_t net = net_queue.back();
+    net_queue.pop_back();
+    for (const size_t& ielement : net_drivers[net]) {
+      visit_element(ielement);
+    }
+  }
+  return live_elements;
+}
+
+/********************************************************************
+ * Top-level function to write a flattened Verilog netlist of the
+ * configured FPGA fabric. The module keeps the name and ports of the
+ * top-level module, so that it can replace the fabric netlists in
+ * simulations which do not exercise the configuration ports.
+ *******************************************************************/
+int print_verilog_configured_fabric_netlist(
+  const ModuleManager& module_manager,
+  const BitstreamManager& bitstream_manager, const CircuitLibrary& circuit_lib,
+  const MuxLibrary& mux_lib, const std::string& verilog_fname,
+  const bool& include_time_stamp, const bool& verbose) {
+  std::string timer_message =
+    std::string("Write configured fabric netlist '") + verilog_fname +
+    std::string("'");
+  vtr::ScopedStartFinishTimer timer(timer_message);
+
+  std::string top_module_name = generate_fpga_top_module_name();
+  ModuleId top_module = module_manager.find_module(top_module_name);
+  if (false == module_manager.valid_module_id(top_module)) {
+    VTR_LOG_ERROR("Unable to find the top-level module '%s'!\n",
+                  top_module_name.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  ConfigBlockId top_block = ConfigBlockId::INVALID();
+  for (const ConfigBlockId& block :
+       find_bitstream_manager_top_blocks(bitstream_manager)) {
+    if (top_module_name == bitstream_manager.block_name(block)) {
+      top_block = block;
+    }
+  }
+  if (ConfigBlockId::INVALID() == top_block) {
+    VTR_LOG_ERROR("Unable to find the top-level block '%s' in bitstream!\n",
+                  top_module_name.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Flatten the fabric and impose the bitstream */
+  std::map<ModuleId, ConfiguredFabricMuxInfo> mux_info =
+    build_configured_fabric_mux_info(module_manager, circuit_lib, mux_lib);
+  ConfiguredFabricNetlist netlist;
+  add_configured_fabric_instance(netlist, module_manager, top_module,
+                                 std::string());
+  rec_flatten_configured_fabric_module(netlist, module_manager,
+                                       bitstream_manager, mux_info, 0,
+                                       top_block);
+  std::vector<int> net_constants =
+    find_configured_fabric_net_constants(netlist);
+  size_t num_collapsed_muxes = collapse_configured_fabric_muxes(
+    netlist, module_manager, mux_lib, mux_info, net_constants);
+  std::vector<bool> live_elements =
+    find_configured_fabric_live_elements(netlist, module_manager);
+
+  /* Name the flat nets: the constants, the ports of the top module, and
+   * local wires for the others */
+  std::vector<std::string> net_names(netlist.node_parents.size());
+  std::vector<std::pair<std::string, size_t>> top_output_assigns;
+  for (const ModulePortId& port : module_manager.module_ports(top_module)) {
+    BasicPort port_info = module_manager.module_port(top_module, port);
+    ModuleManager::e_module_port_type port_type =
+      module_manager.port_type(top_module, port);
+    for (const size_t& pin : port_info.pins()) {
+      std::string pin_name =
+        port_info.get_name() + "[" + std::to_string(pin) + "]";
+      size_t net = find_configured_fabric_net(
+        netlist, find_configured_fabric_node(netlist, module_manager, 0, port,
+                                             pin));
+      if ((-1 == net_constants[net]) && (net_names[net].empty())) {
+        net_names[net] = pin_name;
+        continue;
+      }
+      /* Outputs which share a net with other ports or constants */
+      if ((ModuleManager::MODULE_OUTPUT_PORT == port_type) ||
+          (ModuleManager::MODULE_GPOUT_PORT == port_type)) {
+        top_output_assigns.push_back(std::make_pair(pin_name, net));
+      }
+    }
+  }
+  std::vector<size_t> wires;
+  auto net_name = [&](const size_t& node) {
+    size_t net = find_configured_fabric_net(netlist, node);
+    if (-1 != net_constants[net]) {
+      return std::string("1'b") + std::to_string(net_constants[net]);
+    }
+    if (net_names[net].empty()) {
+      net_names[net] = std::string("n") + std::to_string(net);
+      wires.push_back(net);
+    }
+    return net_names[net];
+  };
+
+  /* Print the elements to a buffer first, so that the wires are known */
+  std::stringstream body;
+  size_t num_kept_instances = 0;
+  size_t num_removed_elements = 0;
+  for (size_t ielement = 0; ielement < netlist.elements.size(); ++ielement) {
+    if (false == live_elements[ielement]) {
+      num_removed_elements++;
+      continue;
+    }
+    const ConfiguredFabricElement& element = netlist.elements[ielement];
+    if (CONFIGURED_FABRIC_ASSIGN == element.type) {
+      body << "assign " << net_name(element.outputs[0]) << " = "
+           << (element.inverted ? "~" : "") << net_name(element.inputs[0])
+           << ";" << std::endl;
+      continue;
+    }
+    if (CONFIGURED_FABRIC_TABLE == element.type) {
+      body << "assign " << net_name(element.outputs[0]) << " = ";
+      if (element.inputs.empty()) {
+        body << "1'b" << element.truth_table[0] << ";" << std::endl;
+        continue;
+      }
+      body << element.truth_table.size() << "'b";
+      for (size_t ibit = element.truth_table.size(); ibit > 0; --ibit) {
+        body << element.truth_table[ibit - 1];
+      }
+      body << " >> {";
+      for (size_t iinput = element.inputs.size(); iinput > 0; --iinput) {
+        body << net_name(element.inputs[iinput - 1]);
+        if (1 < iinput) {
+          body << ", ";
+        }
+      }
+      body << "};" << std::endl;
+      continue;
+    }
+    VTR_ASSERT(CONFIGURED_FABRIC_INSTANCE == element.type);
+    const ConfiguredFabricInstance& inst =
+      netlist.instances[element.instance];
+    body << module_manager.module_name(inst.module) << " \\" << inst.name
+         << " (";
+    size_t port_cnt = 0;
+    for (const ModulePortId& port : module_manager.module_ports(inst.module)) {
+      BasicPort port_info = module_manager.module_port(inst.module, port);
+      body << (0 == port_cnt ? "" : ",") << std::endl;
+      body << "\t." << port_info.get_name() << "({";
+      size_t pin_cnt = 0;
+      for (const size_t& pin : port_info.pins()) {
+        body << (0 == pin_cnt ? "" : ", ")
+             << net_name(find_configured_fabric_node(
+                  netlist, module_manager, element.instance, port, pin));
+        pin_cnt++;
+      }
+      body << "})";
+      port_cnt++;
+    }
+    body << ");" << std::endl;
+    num_kept_instances++;
+  }
+
+  /* Create the file stream */
+  std::fstream fp;
+  fp.open(verilog_fname, std::fstream::out | std::fstream::trunc);
+  check_file_stream(verilog_fname.c_str(), fp);
+
+  print_verilog_file_header(
+    fp, std::string("Flattened netlist of the configured FPGA fabric"),
+    include_time_stamp);
+  print_verilog_module_declaration(fp, module_manager, top_module,
+                                   VERILOG_DEFAULT_NET_TYPE_WIRE);
+  for (const size_t& wire : wires) {
+    fp << "wire " << net_names[wire] << ";" << std::endl;
+  }
+  fp << body.rdbuf();
+  for (const auto& output_assign : top_output_assigns) {
+    size_t net = output_assign.second;
+    fp << "assign " << output_assign.first << " = ";
+    if (-1 != net_constants[net]) {
+      fp << "1'b" << net_constants[net] << ";" << std::endl;
+    } else {
+      fp << net_names[net] << ";" << std::endl;
+    }
+  }
+  print_verilog_module_end(fp, top_module_name);
+  fp.close();
+
+  VTR_LOGV(verbose, "Replaced %lu configuration memories by constants\n",
+           netlist.num_memories);
+  VTR_LOGV(verbose, "Collapsed %lu of %lu multiplexers\n", num_collapsed_muxes,
+           netlist.mux_instances.size());
+  VTR_LOGV(verbose, "Kept %lu primitive instances, removed %lu unused ones\n",
+           num_kept_instances, num_removed_elements);
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
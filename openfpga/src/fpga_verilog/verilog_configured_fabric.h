@@ -0,0 +1,29 @@
+#ifndef VERILOG_CONFIGURED_FABRIC_H
+#define VERILOG_CONFIGURED_FABRIC_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "bitstream_manager.h"
+#include "circuit_library.h"
+#include "module_manager.h"
+#include "mux_library.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+int print_verilog_configured_fabric_netlist(
+  const ModuleManager& module_manager,
+  const BitstreamManager& bitstream_manager, const CircuitLibrary& circuit_lib,
+  const MuxLibrary& mux_lib, const std::string& verilog_fname,
+  const bool& include_time_stamp, const bool& verbose);
+
+} /* end namespace openfpga */
+
+#endif
@@ -13,6 +13,8 @@ constexpr const char* MODELSIM_SIMULATION_TIME_UNIT = "ms";
 
 constexpr const char* FABRIC_INCLUDE_VERILOG_NETLIST_FILE_NAME =
   "fabric_netlists.v";
+constexpr const char* FABRIC_VERILOG_NETLIST_MANIFEST_FILE_NAME =
+  "fabric_netlists.manifest";
 constexpr const char* TOP_VERILOG_TESTBENCH_INCLUDE_NETLIST_FILE_NAME_POSTFIX =
   "_include_netlists.v";
 constexpr const char* VERILOG_TOP_POSTFIX = "_top.v";
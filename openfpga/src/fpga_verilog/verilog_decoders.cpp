@@ -9,9 +9,11 @@
 
 /* Headers from openfpgautil library */
 #include "decoder_library_utils.h"
+#include "module_content_hash.h"
 #include "module_manager.h"
 #include "openfpga_decode.h"
 #include "openfpga_digest.h"
+#include "openfpga_hash.h"
 #include "openfpga_naming.h"
 #include "openfpga_reserved_words.h"
 #include "verilog_constants.h"
@@ -21,6 +23,28 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/***************************************************************************************
+ * Add a decoder to the content hash of a decoder netlist. The Verilog code of
+ * a decoder is fully determined by its specification in the decoder library
+ * and by the ports of its module
+ ***************************************************************************************/
+static void add_decoder_to_content_hash(StableHash& hash,
+                                        const ModuleManager& module_manager,
+                                        const DecoderLibrary& decoder_lib,
+                                        const DecoderId& decoder,
+                                        const std::string& module_name) {
+  hash.add_integer(decoder_lib.addr_size(decoder));
+  hash.add_integer(decoder_lib.data_size(decoder));
+  hash.add_integer(decoder_lib.use_enable(decoder));
+  hash.add_integer(decoder_lib.use_data_in(decoder));
+  hash.add_integer(decoder_lib.use_data_inv_port(decoder));
+  hash.add_integer(decoder_lib.use_readback(decoder));
+  hash.add_integer(decoder_lib.use_addr_mask(decoder));
+  ModuleId module_id = module_manager.find_module(module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(module_id));
+  hash.add_string(compute_module_content_hash(module_manager, module_id));
+}
+
 /***************************************************************************************
  * Create a Verilog module for a decoder with a given output size
  *
@@ -179,26 +203,12 @@ static void print_verilog_mux_local_decoder_module(
  ***************************************************************************************/
 void print_verilog_submodule_mux_local_decoders(
   const ModuleManager& module_manager, NetlistManager& netlist_manager,
-  const MuxLibrary& mux_lib, const CircuitLibrary& circuit_lib,
-  const std::string& submodule_dir, const std::string& submodule_dir_name,
-  const FabricVerilogOption& options) {
+  NetlistManifest& netlist_manifest, const MuxLibrary& mux_lib,
+  const CircuitLibrary& circuit_lib, const std::string& submodule_dir,
+  const std::string& submodule_dir_name, const FabricVerilogOption& options) {
   std::string verilog_fname(LOCAL_ENCODER_VERILOG_FILE_NAME);
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  /* Print out debugging information for if the file is not opened/created
-   * properly */
-  VTR_LOG("Writing Verilog netlist for local decoders for multiplexers '%s'...",
-          verilog_fpath.c_str());
-
-  print_verilog_file_header(fp, "Local Decoders for Multiplexers",
-                            options.time_stamp());
-
   /* Create a library for local encoders with different sizes */
   DecoderLibrary decoder_lib;
 
@@ -232,14 +242,50 @@ void print_verilog_submodule_mux_local_decoders(
     }
   }
 
-  /* Generate Verilog modules for the found unique local encoders */
+  /* Skip the netlist if the decoders are the same as in the last run */
+  StableHash content_hash;
+  content_hash.add_integer(decoder_lib.decoders().size());
   for (const auto& decoder : decoder_lib.decoders()) {
-    print_verilog_mux_local_decoder_module(fp, module_manager, decoder_lib,
-                                           decoder, options.default_net_type());
+    add_decoder_to_content_hash(
+      content_hash, module_manager, decoder_lib, decoder,
+      generate_mux_local_decoder_subckt_name(decoder_lib.addr_size(decoder),
+                                             decoder_lib.data_size(decoder)));
   }
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    submodule_dir_name + verilog_fname, verilog_fpath,
+    content_hash.to_string());
+  netlist_manifest.add_netlist(submodule_dir_name + verilog_fname,
+                               content_hash.to_string(), reused);
+
+  if (reused) {
+    VTR_LOG(
+      "Reuse Verilog netlist for local decoders for multiplexers '%s'...",
+      verilog_fpath.c_str());
+  } else {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    /* Print out debugging information for if the file is not opened/created
+     * properly */
+    VTR_LOG(
+      "Writing Verilog netlist for local decoders for multiplexers '%s'...",
+      verilog_fpath.c_str());
+
+    print_verilog_file_header(fp, "Local Decoders for Multiplexers",
+                              options.time_stamp());
+
+    /* Generate Verilog modules for the found unique local encoders */
+    for (const auto& decoder : decoder_lib.decoders()) {
+      print_verilog_mux_local_decoder_module(
+        fp, module_manager, decoder_lib, decoder, options.default_net_type());
+    }
 
-  /* Close the file stream */
-  fp.close();
+    /* Close the file stream */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -578,6 +624,130 @@ static void print_verilog_arch_decoder_module(
   print_verilog_module_end(fp, module_name);
 }
 
+/***************************************************************************************
+ * Create a Verilog module for a decoder with address mask used as a
+ *configuration protocol in FPGA architecture
+ *
+ *                  Address  Address mask
+ *                   | | ... |  | | ... |
+ *                   v v     v  v v     v
+ *                 +---------------------+
+ *        Enable->/                       \
+ *               /         Decoder         \
+ *              +---------------------------+
+ *                | | | ... | | |
+ *                v v v     v v v
+ *                    Data output
+ *
+ *  A data output is activated when its code matches the address on all the
+ *bits which are not masked. When no bit is masked, the decoder behaves the
+ *same as a regular decoder, i.e., the outputs are one-hot codes. Otherwise,
+ *multiple outputs can be activated, so that a frame can be broadcast.
+ *
+ *  The decoder has an enable signal which is active at logic '1'.
+ *  When activated, the decoder will output decoding results to the data output
+ *port Otherwise, the data output port will be always all-zero
+ ***************************************************************************************/
+static void print_verilog_arch_decoder_with_addr_mask_module(
+  std::fstream& fp, const ModuleManager& module_manager,
+  const DecoderLibrary& decoder_lib, const DecoderId& decoder,
+  const e_verilog_default_net_type& default_net_type) {
+  /* Get the number of inputs */
+  size_t addr_size = decoder_lib.addr_size(decoder);
+  size_t data_size = decoder_lib.data_size(decoder);
+
+  /* Validate the FILE handler */
+  VTR_ASSERT(true == valid_file_stream(fp));
+
+  /* Create a name for the decoder */
+  std::string module_name =
+    generate_memory_decoder_with_addr_mask_subckt_name(addr_size, data_size);
+
+  ModuleId module_id = module_manager.find_module(module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(module_id));
+  /* Find module ports */
+  /* Enable port */
+  ModulePortId enable_port_id = module_manager.find_module_port(
+    module_id, std::string(DECODER_ENABLE_PORT_NAME));
+  BasicPort enable_port = module_manager.module_port(module_id, enable_port_id);
+  /* Address port */
+  ModulePortId addr_port_id = module_manager.find_module_port(
+    module_id, std::string(DECODER_ADDRESS_PORT_NAME));
+  BasicPort addr_port = module_manager.module_port(module_id, addr_port_id);
+  /* Address mask port */
+  ModulePortId addr_mask_port_id = module_manager.find_module_port(
+    module_id, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+  BasicPort addr_mask_port =
+    module_manager.module_port(module_id, addr_mask_port_id);
+  /* Find each output port */
+  ModulePortId data_port_id = module_manager.find_module_port(
+    module_id, std::string(DECODER_DATA_OUT_PORT_NAME));
+  BasicPort data_port = module_manager.module_port(module_id, data_port_id);
+  BasicPort data_inv_port(std::string(DECODER_DATA_OUT_INV_PORT_NAME),
+                          data_size);
+  if (true == decoder_lib.use_data_inv_port(decoder)) {
+    ModulePortId data_inv_port_id = module_manager.find_module_port(
+      module_id, std::string(DECODER_DATA_OUT_INV_PORT_NAME));
+    data_inv_port = module_manager.module_port(module_id, data_inv_port_id);
+  }
+
+  /* dump module definition + ports */
+  print_verilog_module_declaration(fp, module_manager, module_id,
+                                   default_net_type);
+  /* Finish dumping ports */
+
+  print_verilog_comment(
+    fp, std::string("----- BEGIN Verilog codes for Decoder convert " +
+                    std::to_string(addr_size) + "-bit addr with mask to " +
+                    std::to_string(data_size) + "-bit data -----"));
+
+  /* Output logics for data output */
+  fp << "always@(" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port);
+  fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, addr_mask_port);
+  fp << " or " << generate_verilog_port(VERILOG_PORT_CONKT, enable_port);
+  fp << ") begin" << std::endl;
+  /* By default, all the outputs are zero */
+  fp << "\t"
+     << generate_verilog_port_constant_values(
+          data_port, ito1hot_vec(data_size, data_size));
+  fp << ";" << std::endl;
+  fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, enable_port)
+     << " == 1'b1) begin" << std::endl;
+  /* Compare the code of each data output with the address on the bits which
+   * are not masked */
+  for (size_t i = 0; i < data_size; ++i) {
+    BasicPort data_pin(data_port.get_name(), data_port.pins()[i],
+                       data_port.pins()[i]);
+    fp << "\t\tif (((" << generate_verilog_port(VERILOG_PORT_CONKT, addr_port)
+       << " ^ " << generate_verilog_constant_values(itobin_vec(i, addr_size))
+       << ") & ~" << generate_verilog_port(VERILOG_PORT_CONKT, addr_mask_port)
+       << ") == "
+       << generate_verilog_constant_values(std::vector<size_t>(addr_size, 0))
+       << ") begin" << std::endl;
+    fp << "\t\t\t"
+       << generate_verilog_port_constant_values(data_pin,
+                                                std::vector<size_t>(1, 1))
+       << ";" << std::endl;
+    fp << "\t\t"
+       << "end" << std::endl;
+  }
+  fp << "\t"
+     << "end" << std::endl;
+  fp << "end" << std::endl;
+
+  if (true == decoder_lib.use_data_inv_port(decoder)) {
+    print_verilog_wire_connection(fp, data_inv_port, data_port, true);
+  }
+
+  print_verilog_comment(
+    fp, std::string("----- END Verilog codes for Decoder convert " +
+                    std::to_string(addr_size) + "-bit addr with mask to " +
+                    std::to_string(data_size) + "-bit data -----"));
+
+  /* Put an end to the Verilog module */
+  print_verilog_module_end(fp, module_name);
+}
+
 /***************************************************************************************
  * Create a Verilog module for a decoder with data_in used as a configuration
  *protocol in FPGA architecture
@@ -766,6 +936,120 @@ static void print_verilog_arch_decoder_with_data_in_module(
   print_verilog_module_end(fp, module_name);
 }
 
+/***************************************************************************************
+ * Create a Verilog module for the run-length decompressor which drives the
+ *head of a configuration chain
+ *
+ *          ccff_head  ccff_rle_load  ccff_rle_count
+ *              |           |           | | ... |
+ *              v           v           v v     v
+ *            +---------------------------------+
+ *  prog_clk->|       RLE decompressor          |
+ *            +---------------------------------+
+ *                 |                     |
+ *                 v                     v
+ *             ccff_tail           ccff_rle_ready
+ *
+ *  A token <value, run length> is latched when the load signal is '1'.
+ *  The value is outputted for (run length + 1) cycles, starting from the cycle
+ *when it is loaded, so that the chain never shifts in an uninitialized value.
+ *The ready signal is raised in the last cycle. Note that the LSB of the run
+ *length is the pin 0 of the count port
+ ***************************************************************************************/
+static void print_verilog_config_chain_rle_decompressor_module(
+  std::fstream& fp, const ModuleManager& module_manager,
+  const ModuleId& module_id,
+  const e_verilog_default_net_type& default_net_type) {
+  /* Validate the FILE handler */
+  VTR_ASSERT(true == valid_file_stream(fp));
+  VTR_ASSERT(true == module_manager.valid_module_id(module_id));
+
+  /* Find module ports */
+  std::vector<BasicPort> clock_ports =
+    module_manager.module_ports_by_type(module_id,
+                                        ModuleManager::MODULE_GLOBAL_PORT);
+  VTR_ASSERT(1 == clock_ports.size());
+  BasicPort clock_pin(clock_ports[0].get_name(), clock_ports[0].get_lsb(),
+                      clock_ports[0].get_lsb());
+  BasicPort head_port = module_manager.module_port(
+    module_id, module_manager.find_module_port(
+                 module_id, std::string(CONFIGURABLE_MEMORY_CHAIN_IN_NAME)));
+  BasicPort load_port = module_manager.module_port(
+    module_id, module_manager.find_module_port(
+                 module_id, std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME)));
+  BasicPort count_port = module_manager.module_port(
+    module_id, module_manager.find_module_port(
+                 module_id, std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME)));
+  BasicPort tail_port = module_manager.module_port(
+    module_id, module_manager.find_module_port(
+                 module_id, std::string(CONFIGURABLE_MEMORY_CHAIN_OUT_NAME)));
+  BasicPort ready_port = module_manager.module_port(
+    module_id, module_manager.find_module_port(
+                 module_id, std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME)));
+  size_t count_size = count_port.get_width();
+
+  /* dump module definition + ports */
+  print_verilog_module_declaration(fp, module_manager, module_id,
+                                   default_net_type);
+  /* Finish dumping ports */
+
+  print_verilog_comment(
+    fp, std::string("----- BEGIN Verilog codes for run-length decompressor "
+                    "with " +
+                    std::to_string(count_size) + "-bit run length -----"));
+
+  /* Internal registers: the value of current token and its remaining run
+   * length, whose LSB is the rightmost bit */
+  fp << "reg rle_value;" << std::endl;
+  fp << "reg [" << count_size - 1 << ":0] rle_remaining;" << std::endl;
+
+  /* Reorder the run length so that pin 0 of count port is the LSB */
+  std::string count_str("{");
+  for (size_t ipin = count_size; ipin > 0; --ipin) {
+    BasicPort count_pin(count_port.get_name(), count_port.pins()[ipin - 1],
+                        count_port.pins()[ipin - 1]);
+    if (ipin != count_size) {
+      count_str += ", ";
+    }
+    count_str += generate_verilog_port(VERILOG_PORT_CONKT, count_pin);
+  }
+  count_str += "}";
+
+  fp << "always @(posedge "
+     << generate_verilog_port(VERILOG_PORT_CONKT, clock_pin) << ") begin"
+     << std::endl;
+  fp << "\tif (" << generate_verilog_port(VERILOG_PORT_CONKT, load_port)
+     << " == 1'b1) begin" << std::endl;
+  fp << "\t\trle_value <= "
+     << generate_verilog_port(VERILOG_PORT_CONKT, head_port) << ";"
+     << std::endl;
+  fp << "\t\trle_remaining <= " << count_str << ";" << std::endl;
+  fp << "\tend else if (rle_remaining != " << count_size << "'d0) begin"
+     << std::endl;
+  fp << "\t\trle_remaining <= rle_remaining - " << count_size << "'d1;"
+     << std::endl;
+  fp << "\t"
+     << "end" << std::endl;
+  fp << "end" << std::endl;
+
+  /* Bypass the value of a token in the cycle when it is loaded */
+  fp << "assign " << generate_verilog_port(VERILOG_PORT_CONKT, tail_port)
+     << " = " << generate_verilog_port(VERILOG_PORT_CONKT, load_port) << " ? "
+     << generate_verilog_port(VERILOG_PORT_CONKT, head_port)
+     << " : rle_value;" << std::endl;
+  fp << "assign " << generate_verilog_port(VERILOG_PORT_CONKT, ready_port)
+     << " = (rle_remaining == " << count_size << "'d0);" << std::endl;
+
+  print_verilog_comment(
+    fp, std::string("----- END Verilog codes for run-length decompressor "
+                    "with " +
+                    std::to_string(count_size) + "-bit run length -----"));
+
+  /* Put an end to the Verilog module */
+  print_verilog_module_end(
+    fp, std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
+}
+
 /***************************************************************************************
  * This function will generate all the unique Verilog modules of decoders for
  * configuration protocols in a FPGA fabric
@@ -778,38 +1062,87 @@ static void print_verilog_arch_decoder_with_data_in_module(
  ***************************************************************************************/
 void print_verilog_submodule_arch_decoders(
   const ModuleManager& module_manager, NetlistManager& netlist_manager,
-  const DecoderLibrary& decoder_lib, const std::string& submodule_dir,
-  const std::string& submodule_dir_name, const FabricVerilogOption& options) {
+  NetlistManifest& netlist_manifest, const DecoderLibrary& decoder_lib,
+  const std::string& submodule_dir, const std::string& submodule_dir_name,
+  const FabricVerilogOption& options) {
   std::string verilog_fname(ARCH_ENCODER_VERILOG_FILE_NAME);
   std::string verilog_fpath(submodule_dir + verilog_fname);
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
+  ModuleId rle_module = module_manager.find_module(
+    std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
 
-  /* Print out debugging information for if the file is not opened/created
-   * properly */
-  VTR_LOG("Writing Verilog netlist for configuration decoders '%s'...",
-          verilog_fpath.c_str());
-
-  print_verilog_file_header(fp, "Decoders for fabric configuration protocol",
-                            options.time_stamp());
-
-  /* Generate Verilog modules for the found unique local encoders */
+  /* Skip the netlist if the decoders are the same as in the last run */
+  StableHash content_hash;
+  content_hash.add_integer(decoder_lib.decoders().size());
   for (const auto& decoder : decoder_lib.decoders()) {
+    size_t addr_size = decoder_lib.addr_size(decoder);
+    size_t data_size = decoder_lib.data_size(decoder);
+    std::string module_name;
     if (true == decoder_lib.use_data_in(decoder)) {
-      print_verilog_arch_decoder_with_data_in_module(
-        fp, module_manager, decoder_lib, decoder, options.default_net_type());
+      module_name =
+        generate_memory_decoder_with_data_in_subckt_name(addr_size, data_size);
+    } else if (true == decoder_lib.use_addr_mask(decoder)) {
+      module_name = generate_memory_decoder_with_addr_mask_subckt_name(
+        addr_size, data_size);
     } else {
-      print_verilog_arch_decoder_module(fp, module_manager, decoder_lib,
-                                        decoder, options.default_net_type());
+      module_name = generate_memory_decoder_subckt_name(addr_size, data_size);
     }
+    add_decoder_to_content_hash(content_hash, module_manager, decoder_lib,
+                                decoder, module_name);
   }
+  content_hash.add_integer(module_manager.valid_module_id(rle_module));
+  if (true == module_manager.valid_module_id(rle_module)) {
+    content_hash.add_string(
+      compute_module_content_hash(module_manager, rle_module));
+  }
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    submodule_dir_name + verilog_fname, verilog_fpath,
+    content_hash.to_string());
+  netlist_manifest.add_netlist(submodule_dir_name + verilog_fname,
+                               content_hash.to_string(), reused);
+
+  if (reused) {
+    VTR_LOG("Reuse Verilog netlist for configuration decoders '%s'...",
+            verilog_fpath.c_str());
+  } else {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    /* Print out debugging information for if the file is not opened/created
+     * properly */
+    VTR_LOG("Writing Verilog netlist for configuration decoders '%s'...",
+            verilog_fpath.c_str());
+
+    print_verilog_file_header(fp, "Decoders for fabric configuration protocol",
+                              options.time_stamp());
+
+    /* Generate Verilog modules for the found unique local encoders */
+    for (const auto& decoder : decoder_lib.decoders()) {
+      if (true == decoder_lib.use_data_in(decoder)) {
+        print_verilog_arch_decoder_with_data_in_module(
+          fp, module_manager, decoder_lib, decoder, options.default_net_type());
+      } else if (true == decoder_lib.use_addr_mask(decoder)) {
+        print_verilog_arch_decoder_with_addr_mask_module(
+          fp, module_manager, decoder_lib, decoder, options.default_net_type());
+      } else {
+        print_verilog_arch_decoder_module(fp, module_manager, decoder_lib,
+                                          decoder, options.default_net_type());
+      }
+    }
 
-  /* Close the file stream */
-  fp.close();
+    /* Generate the run-length decompressor for configuration chains if used
+     */
+    if (true == module_manager.valid_module_id(rle_module)) {
+      print_verilog_config_chain_rle_decompressor_module(
+        fp, module_manager, rle_module, options.default_net_type());
+    }
+
+    /* Close the file stream */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -15,6 +15,7 @@
 #include "mux_graph.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
+#include "netlist_manifest.h"
 #include "verilog_port_types.h"
 
 /********************************************************************
@@ -26,14 +27,15 @@ namespace openfpga {
 
 void print_verilog_submodule_mux_local_decoders(
   const ModuleManager& module_manager, NetlistManager& netlist_manager,
-  const MuxLibrary& mux_lib, const CircuitLibrary& circuit_lib,
-  const std::string& submodule_dir, const std::string& submodule_dir_name,
-  const FabricVerilogOption& options);
+  NetlistManifest& netlist_manifest, const MuxLibrary& mux_lib,
+  const CircuitLibrary& circuit_lib, const std::string& submodule_dir,
+  const std::string& submodule_dir_name, const FabricVerilogOption& options);
 
 void print_verilog_submodule_arch_decoders(
   const ModuleManager& module_manager, NetlistManager& netlist_manager,
-  const DecoderLibrary& decoder_lib, const std::string& submodule_dir,
-  const std::string& submodule_dir_name, const FabricVerilogOption& options);
+  NetlistManifest& netlist_manifest, const DecoderLibrary& decoder_lib,
+  const std::string& submodule_dir, const std::string& submodule_dir_name,
+  const FabricVerilogOption& options);
 
 } /* end namespace openfpga */
 
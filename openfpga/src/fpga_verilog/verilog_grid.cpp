@@ -20,6 +20,7 @@
 
 /* Headers from vpr library */
 #include "circuit_library_utils.h"
+#include "module_content_hash.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
 #include "openfpga_physical_tile_utils.h"
@@ -65,10 +66,10 @@ namespace openfpga {
  *
  *******************************************************************/
 static void print_verilog_primitive_block(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  t_pb_graph_node* primitive_pb_graph_node, const FabricVerilogOption& options,
-  const bool& verbose) {
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, t_pb_graph_node* primitive_pb_graph_node,
+  const FabricVerilogOption& options, const bool& verbose) {
   /* Ensure a valid pb_graph_node */
   if (nullptr == primitive_pb_graph_node) {
     VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid primitive_pb_graph_node!\n");
@@ -86,18 +87,6 @@ static void print_verilog_primitive_block(
           verilog_fpath.c_str(), primitive_pb_graph_node->pb_type->name);
   VTR_LOGV(verbose, "\n");
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  print_verilog_file_header(
-    fp,
-    std::string("Verilog modules for primitive pb_type: " +
-                std::string(primitive_pb_graph_node->pb_type->name)),
-    options.time_stamp());
-
   /* Generate the module name for this primitive pb_graph_node*/
   std::string primitive_module_name =
     generate_physical_block_module_name(primitive_pb_graph_node->pb_type);
@@ -107,16 +96,38 @@ static void print_verilog_primitive_block(
   /* Ensure that the module has been created and thus unique! */
   VTR_ASSERT(true == module_manager.valid_module_id(primitive_module));
 
-  VTR_LOGV(verbose,
-           "Writing Verilog codes of logical tile primitive block '%s'...",
-           module_manager.module_name(primitive_module).c_str());
-
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, primitive_module, true,
-                               options.default_net_type());
-
-  /* Close file handler */
-  fp.close();
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, primitive_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    subckt_dir_name + verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(subckt_dir_name + verilog_fname, content_hash,
+                               reused);
+
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    print_verilog_file_header(
+      fp,
+      std::string("Verilog modules for primitive pb_type: " +
+                  std::string(primitive_pb_graph_node->pb_type->name)),
+      options.time_stamp());
+
+    VTR_LOGV(verbose,
+             "Writing Verilog codes of logical tile primitive block '%s'...",
+             module_manager.module_name(primitive_module).c_str());
+
+    /* Write the verilog module */
+    write_verilog_module_to_file(fp, module_manager, primitive_module, true,
+                                 options.default_net_type());
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -149,7 +160,8 @@ static void print_verilog_primitive_block(
  * to its parent in module manager
  *******************************************************************/
 static void rec_print_verilog_logical_tile(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
   const std::string& subckt_dir_name, t_pb_graph_node* physical_pb_graph_node,
   const FabricVerilogOption& options, const bool& verbose) {
@@ -172,8 +184,8 @@ static void rec_print_verilog_logical_tile(
     for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
       /* Go recursive to visit the children */
       rec_print_verilog_logical_tile(
-        netlist_manager, module_manager, device_annotation, subckt_dir,
-        subckt_dir_name,
+        netlist_manager, netlist_manifest, module_manager, device_annotation,
+        subckt_dir, subckt_dir_name,
         &(physical_pb_graph_node
             ->child_pb_graph_nodes[physical_mode->index][ipb][0]),
         options, verbose);
@@ -182,9 +194,9 @@ static void rec_print_verilog_logical_tile(
 
   /* For leaf node, a primitive Verilog module will be generated. */
   if (true == is_primitive_pb_type(physical_pb_type)) {
-    print_verilog_primitive_block(netlist_manager, module_manager, subckt_dir,
-                                  subckt_dir_name, physical_pb_graph_node,
-                                  options, verbose);
+    print_verilog_primitive_block(
+      netlist_manager, netlist_manifest, module_manager, subckt_dir,
+      subckt_dir_name, physical_pb_graph_node, options, verbose);
     /* Finish for primitive node, return */
     return;
   }
@@ -200,17 +212,6 @@ static void rec_print_verilog_logical_tile(
           verilog_fpath.c_str(), physical_pb_type->name);
   VTR_LOGV(verbose, "\n");
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  print_verilog_file_header(fp,
-                            std::string("Verilog modules for pb_type: " +
-                                        std::string(physical_pb_type->name)),
-                            options.time_stamp());
-
   /* Generate the name of the Verilog module for this pb_type */
   std::string pb_module_name =
     generate_physical_block_module_name(physical_pb_type);
@@ -219,27 +220,48 @@ static void rec_print_verilog_logical_tile(
   ModuleId pb_module = module_manager.find_module(pb_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
 
-  VTR_LOGV(verbose, "Writing Verilog codes of pb_type '%s'...",
-           module_manager.module_name(pb_module).c_str());
-
-  /* Comment lines */
-  print_verilog_comment(
-    fp, std::string(
-          "----- BEGIN Physical programmable logic block Verilog module: " +
-          std::string(physical_pb_type->name) + " -----"));
-
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, pb_module,
-                               options.explicit_port_mapping(),
-                               options.default_net_type());
-
-  print_verilog_comment(
-    fp,
-    std::string("----- END Physical programmable logic block Verilog module: " +
-                std::string(physical_pb_type->name) + " -----"));
-
-  /* Close file handler */
-  fp.close();
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, pb_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    subckt_dir_name + verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(subckt_dir_name + verilog_fname, content_hash,
+                               reused);
+
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    print_verilog_file_header(fp,
+                              std::string("Verilog modules for pb_type: " +
+                                          std::string(physical_pb_type->name)),
+                              options.time_stamp());
+
+    VTR_LOGV(verbose, "Writing Verilog codes of pb_type '%s'...",
+             module_manager.module_name(pb_module).c_str());
+
+    /* Comment lines */
+    print_verilog_comment(
+      fp, std::string(
+            "----- BEGIN Physical programmable logic block Verilog module: " +
+            std::string(physical_pb_type->name) + " -----"));
+
+    /* Write the verilog module */
+    write_verilog_module_to_file(fp, module_manager, pb_module,
+                                 options.explicit_port_mapping(),
+                                 options.default_net_type());
+
+    print_verilog_comment(
+      fp, std::string(
+            "----- END Physical programmable logic block Verilog module: " +
+            std::string(physical_pb_type->name) + " -----"));
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -260,7 +282,8 @@ static void rec_print_verilog_logical_tile(
  * for the logical tile (pb_graph/pb_type)
  *****************************************************************************/
 static void print_verilog_logical_tile_netlist(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
   const std::string& subckt_dir_name, t_pb_graph_node* pb_graph_head,
   const FabricVerilogOption& options, const bool& verbose) {
@@ -276,9 +299,10 @@ static void print_verilog_logical_tile_netlist(
    */
   /* Print Verilog modules starting from the top-level pb_type/pb_graph_node,
    * and traverse the graph in a recursive way */
-  rec_print_verilog_logical_tile(netlist_manager, module_manager,
-                                 device_annotation, subckt_dir, subckt_dir_name,
-                                 pb_graph_head, options, verbose);
+  rec_print_verilog_logical_tile(netlist_manager, netlist_manifest,
+                                 module_manager, device_annotation, subckt_dir,
+                                 subckt_dir_name, pb_graph_head, options,
+                                 verbose);
 
   VTR_LOG("Done\n");
   VTR_LOG("\n");
@@ -293,9 +317,10 @@ static void print_verilog_logical_tile_netlist(
  * the I/O block locates at.
  *****************************************************************************/
 static void print_verilog_physical_tile_netlist(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  t_physical_tile_type_ptr phy_block_type, const e_side& border_side,
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, t_physical_tile_type_ptr phy_block_type,
+  const e_side& border_side,
   const FabricVerilogOption& options) {
   /* Give a name to the Verilog netlist */
   std::string verilog_fname(generate_grid_block_netlist_name(
@@ -317,18 +342,6 @@ static void print_verilog_physical_tile_netlist(
             verilog_fpath.c_str(), phy_block_type->name);
   }
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  print_verilog_file_header(
-    fp,
-    std::string("Verilog modules for physical tile: " +
-                std::string(phy_block_type->name) + "]"),
-    options.time_stamp());
-
   /* Create a Verilog Module for the top-level physical block, and add to module
    * manager */
   std::string grid_module_name = generate_grid_block_module_name(
@@ -337,23 +350,45 @@ static void print_verilog_physical_tile_netlist(
   ModuleId grid_module = module_manager.find_module(grid_module_name);
   VTR_ASSERT(true == module_manager.valid_module_id(grid_module));
 
-  /* Write the verilog module */
-  print_verilog_comment(
-    fp, std::string("----- BEGIN Grid Verilog module: " +
-                    module_manager.module_name(grid_module) + " -----"));
-  write_verilog_module_to_file(fp, module_manager, grid_module,
-                               options.explicit_port_mapping(),
-                               options.default_net_type());
-
-  print_verilog_comment(
-    fp, std::string("----- END Grid Verilog module: " +
-                    module_manager.module_name(grid_module) + " -----"));
-
-  /* Add an empty line as a splitter */
-  fp << std::endl;
-
-  /* Close file handler */
-  fp.close();
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, grid_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    subckt_dir_name + verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(subckt_dir_name + verilog_fname, content_hash,
+                               reused);
+
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    print_verilog_file_header(
+      fp,
+      std::string("Verilog modules for physical tile: " +
+                  std::string(phy_block_type->name) + "]"),
+      options.time_stamp());
+
+    /* Write the verilog module */
+    print_verilog_comment(
+      fp, std::string("----- BEGIN Grid Verilog module: " +
+                      module_manager.module_name(grid_module) + " -----"));
+    write_verilog_module_to_file(fp, module_manager, grid_module,
+                                 options.explicit_port_mapping(),
+                                 options.default_net_type());
+
+    print_verilog_comment(
+      fp, std::string("----- END Grid Verilog module: " +
+                      module_manager.module_name(grid_module) + " -----"));
+
+    /* Add an empty line as a splitter */
+    fp << std::endl;
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -376,10 +411,11 @@ static void print_verilog_physical_tile_netlist(
  * 3. Only one module for each heterogeneous block
  ****************************************************************************/
 void print_verilog_grids(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  const FabricVerilogOption& options, const bool& verbose) {
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, const FabricVerilogOption& options,
+  const bool& verbose) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
@@ -400,8 +436,9 @@ void print_verilog_grids(
       continue;
     }
     print_verilog_logical_tile_netlist(
-      netlist_manager, module_manager, device_annotation, subckt_dir,
-      subckt_dir_name, logical_tile.pb_graph_head, options, verbose);
+      netlist_manager, netlist_manifest, module_manager, device_annotation,
+      subckt_dir, subckt_dir_name, logical_tile.pb_graph_head, options,
+      verbose);
   }
   VTR_LOG("Writing logical tiles...");
   VTR_LOG("Done\n");
@@ -432,15 +469,15 @@ void print_verilog_grids(
         find_physical_io_tile_located_sides(device_ctx.grid, &physical_tile);
       for (const e_side& io_type_side : io_type_sides) {
         print_verilog_physical_tile_netlist(
-          netlist_manager, module_manager, subckt_dir, subckt_dir_name,
-          &physical_tile, io_type_side, options);
+          netlist_manager, netlist_manifest, module_manager, subckt_dir,
+          subckt_dir_name, &physical_tile, io_type_side, options);
       }
       continue;
     } else {
       /* For CLB and heterogenenous blocks */
-      print_verilog_physical_tile_netlist(netlist_manager, module_manager,
-                                          subckt_dir, subckt_dir_name,
-                                          &physical_tile, NUM_SIDES, options);
+      print_verilog_physical_tile_netlist(
+        netlist_manager, netlist_manifest, module_manager, subckt_dir,
+        subckt_dir_name, &physical_tile, NUM_SIDES, options);
     }
   }
   VTR_LOG("Building physical tiles...");
@@ -9,6 +9,7 @@
 #include "fabric_verilog_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
+#include "netlist_manifest.h"
 #include "vpr_context.h"
 #include "vpr_device_annotation.h"
 
@@ -20,10 +21,11 @@
 namespace openfpga {
 
 void print_verilog_grids(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  const FabricVerilogOption& options, const bool& verbose);
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceContext& device_ctx,
+  const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, const FabricVerilogOption& options,
+  const bool& verbose);
 
 } /* end namespace openfpga */
 
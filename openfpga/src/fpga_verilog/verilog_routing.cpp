@@ -11,6 +11,7 @@
 #include "openfpga_digest.h"
 
 /* Include FPGA-Verilog header files*/
+#include "module_content_hash.h"
 #include "openfpga_naming.h"
 #include "verilog_constants.h"
 #include "verilog_module_writer.h"
@@ -76,9 +77,10 @@ namespace openfpga {
  *
  ********************************************************************/
 static void print_verilog_routing_connection_box_unique_module(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  const RRGSB& rr_gsb, const t_rr_type& cb_type,
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, const RRGSB& rr_gsb,
+  const t_rr_type& cb_type,
   const FabricVerilogOption& options) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
@@ -87,35 +89,45 @@ static void print_verilog_routing_connection_box_unique_module(
     cb_type, gsb_coordinate, std::string(VERILOG_NETLIST_FILE_POSTFIX)));
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  print_verilog_file_header(
-    fp,
-    std::string("Verilog modules for Unique Connection Blocks[" +
-                std::to_string(rr_gsb.get_cb_x(cb_type)) + "][" +
-                std::to_string(rr_gsb.get_cb_y(cb_type)) + "]"),
-    options.time_stamp());
-
   /* Create a Verilog Module based on the circuit model, and add to module
    * manager */
   ModuleId cb_module = module_manager.find_module(
     generate_connection_block_module_name(cb_type, gsb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
 
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, cb_module,
-                               options.explicit_port_mapping(),
-                               options.default_net_type());
-
-  /* Add an empty line as a splitter */
-  fp << std::endl;
-
-  /* Close file handler */
-  fp.close();
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, cb_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    subckt_dir_name + verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(subckt_dir_name + verilog_fname, content_hash,
+                               reused);
+
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    print_verilog_file_header(
+      fp,
+      std::string("Verilog modules for Unique Connection Blocks[" +
+                  std::to_string(rr_gsb.get_cb_x(cb_type)) + "][" +
+                  std::to_string(rr_gsb.get_cb_y(cb_type)) + "]"),
+      options.time_stamp());
+
+    /* Write the verilog module */
+    write_verilog_module_to_file(fp, module_manager, cb_module,
+                                 options.explicit_port_mapping(),
+                                 options.default_net_type());
+
+    /* Add an empty line as a splitter */
+    fp << std::endl;
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -190,9 +202,10 @@ static void print_verilog_routing_connection_box_unique_module(
  *
  ********************************************************************/
 static void print_verilog_routing_switch_box_unique_module(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const std::string& subckt_dir_name,
-  const RRGSB& rr_gsb, const FabricVerilogOption& options) {
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const std::string& subckt_dir_name, const RRGSB& rr_gsb,
+  const FabricVerilogOption& options) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
   std::string verilog_fname(generate_routing_block_netlist_name(
@@ -200,32 +213,42 @@ static void print_verilog_routing_switch_box_unique_module(
     std::string(VERILOG_NETLIST_FILE_POSTFIX)));
   std::string verilog_fpath(subckt_dir + verilog_fname);
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(verilog_fpath.c_str(), fp);
-
-  print_verilog_file_header(
-    fp,
-    std::string("Verilog modules for Unique Switch Blocks[" +
-                std::to_string(rr_gsb.get_sb_x()) + "][" +
-                std::to_string(rr_gsb.get_sb_y()) + "]"),
-    options.time_stamp());
-
   /* Create a Verilog Module based on the circuit model, and add to module
    * manager */
   ModuleId sb_module = module_manager.find_module(
     generate_switch_block_module_name(gsb_coordinate));
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
-  /* Write the verilog module */
-  write_verilog_module_to_file(fp, module_manager, sb_module,
-                               options.explicit_port_mapping(),
-                               options.default_net_type());
-
-  /* Close file handler */
-  fp.close();
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, sb_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    subckt_dir_name + verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(subckt_dir_name + verilog_fname, content_hash,
+                               reused);
+
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+
+    check_file_stream(verilog_fpath.c_str(), fp);
+
+    print_verilog_file_header(
+      fp,
+      std::string("Verilog modules for Unique Switch Blocks[" +
+                  std::to_string(rr_gsb.get_sb_x()) + "][" +
+                  std::to_string(rr_gsb.get_sb_y()) + "]"),
+      options.time_stamp());
+
+    /* Write the verilog module */
+    write_verilog_module_to_file(fp, module_manager, sb_module,
+                                 options.explicit_port_mapping(),
+                                 options.default_net_type());
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
@@ -244,10 +267,10 @@ static void print_verilog_routing_switch_box_unique_module(
  * and build a module for each of them
  *******************************************************************/
 static void print_verilog_flatten_connection_block_modules(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const DeviceRRGSB& device_rr_gsb, const std::string& subckt_dir,
-  const std::string& subckt_dir_name, const t_rr_type& cb_type,
-  const FabricVerilogOption& options) {
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const std::string& subckt_dir_name,
+  const t_rr_type& cb_type, const FabricVerilogOption& options) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
@@ -262,8 +285,8 @@ static void print_verilog_flatten_connection_block_modules(
         continue;
       }
       print_verilog_routing_connection_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, subckt_dir_name, rr_gsb,
-        cb_type, options);
+        netlist_manager, netlist_manifest, module_manager, subckt_dir,
+        subckt_dir_name, rr_gsb, cb_type, options);
     }
   }
 }
@@ -277,12 +300,11 @@ static void print_verilog_flatten_connection_block_modules(
  * 1. Connection blocks
  * 2. Switch blocks
  *******************************************************************/
-void print_verilog_flatten_routing_modules(NetlistManager& netlist_manager,
-                                           const ModuleManager& module_manager,
-                                           const DeviceRRGSB& device_rr_gsb,
-                                           const std::string& subckt_dir,
-                                           const std::string& subckt_dir_name,
-                                           const FabricVerilogOption& options) {
+void print_verilog_flatten_routing_modules(
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const std::string& subckt_dir_name,
+  const FabricVerilogOption& options) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
@@ -297,18 +319,18 @@ void print_verilog_flatten_routing_modules(NetlistManager& netlist_manager,
         continue;
       }
       print_verilog_routing_switch_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, subckt_dir_name, rr_gsb,
-        options);
+        netlist_manager, netlist_manifest, module_manager, subckt_dir,
+        subckt_dir_name, rr_gsb, options);
     }
   }
 
   print_verilog_flatten_connection_block_modules(
-    netlist_manager, module_manager, device_rr_gsb, subckt_dir, subckt_dir_name,
-    CHANX, options);
+    netlist_manager, netlist_manifest, module_manager, device_rr_gsb,
+    subckt_dir, subckt_dir_name, CHANX, options);
 
   print_verilog_flatten_connection_block_modules(
-    netlist_manager, module_manager, device_rr_gsb, subckt_dir, subckt_dir_name,
-    CHANY, options);
+    netlist_manager, netlist_manifest, module_manager, device_rr_gsb,
+    subckt_dir, subckt_dir_name, CHANY, options);
 }
 
 /********************************************************************
@@ -321,12 +343,11 @@ void print_verilog_flatten_routing_modules(NetlistManager& netlist_manager,
  * Note: this function SHOULD be called only when
  * the option compact_routing_hierarchy is turned on!!!
  *******************************************************************/
-void print_verilog_unique_routing_modules(NetlistManager& netlist_manager,
-                                          const ModuleManager& module_manager,
-                                          const DeviceRRGSB& device_rr_gsb,
-                                          const std::string& subckt_dir,
-                                          const std::string& subckt_dir_name,
-                                          const FabricVerilogOption& options) {
+void print_verilog_unique_routing_modules(
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const std::string& subckt_dir_name,
+  const FabricVerilogOption& options) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
@@ -335,8 +356,8 @@ void print_verilog_unique_routing_modules(NetlistManager& netlist_manager,
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
     const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
     print_verilog_routing_switch_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, subckt_dir_name,
-      unique_mirror, options);
+      netlist_manager, netlist_manifest, module_manager, subckt_dir,
+      subckt_dir_name, unique_mirror, options);
   }
 
   /* Build unique X-direction connection block modules */
@@ -345,8 +366,8 @@ void print_verilog_unique_routing_modules(NetlistManager& netlist_manager,
     const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
 
     print_verilog_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, subckt_dir_name,
-      unique_mirror, CHANX, options);
+      netlist_manager, netlist_manifest, module_manager, subckt_dir,
+      subckt_dir_name, unique_mirror, CHANX, options);
   }
 
   /* Build unique X-direction connection block modules */
@@ -355,8 +376,8 @@ void print_verilog_unique_routing_modules(NetlistManager& netlist_manager,
     const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
 
     print_verilog_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, subckt_dir_name,
-      unique_mirror, CHANY, options);
+      netlist_manager, netlist_manifest, module_manager, subckt_dir,
+      subckt_dir_name, unique_mirror, CHANY, options);
   }
 
   VTR_LOG("\n");
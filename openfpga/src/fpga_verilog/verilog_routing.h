@@ -10,6 +10,7 @@
 #include "module_manager.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
+#include "netlist_manifest.h"
 
 /********************************************************************
  * Function declaration
@@ -18,19 +19,17 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
-void print_verilog_flatten_routing_modules(NetlistManager& netlist_manager,
-                                           const ModuleManager& module_manager,
-                                           const DeviceRRGSB& device_rr_gsb,
-                                           const std::string& subckt_dir,
-                                           const std::string& subckt_dir_name,
-                                           const FabricVerilogOption& options);
-
-void print_verilog_unique_routing_modules(NetlistManager& netlist_manager,
-                                          const ModuleManager& module_manager,
-                                          const DeviceRRGSB& device_rr_gsb,
-                                          const std::string& subckt_dir,
-                                          const std::string& subckt_dir_name,
-                                          const FabricVerilogOption& options);
+void print_verilog_flatten_routing_modules(
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const std::string& subckt_dir_name,
+  const FabricVerilogOption& options);
+
+void print_verilog_unique_routing_modules(
+  NetlistManager& netlist_manager, NetlistManifest& netlist_manifest,
+  const ModuleManager& module_manager, const DeviceRRGSB& device_rr_gsb,
+  const std::string& subckt_dir, const std::string& subckt_dir_name,
+  const FabricVerilogOption& options);
 
 } /* end namespace openfpga */
 
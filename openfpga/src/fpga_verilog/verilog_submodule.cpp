@@ -34,6 +34,7 @@ namespace openfpga {
  ********************************************************************/
 void print_verilog_submodule(
   ModuleManager& module_manager, NetlistManager& netlist_manager,
+  NetlistManifest& netlist_manifest,
   const MemoryBankShiftRegisterBanks& blwl_sr_banks, const MuxLibrary& mux_lib,
   const DecoderLibrary& decoder_lib, const CircuitLibrary& circuit_lib,
   const std::string& submodule_dir, const std::string& submodule_dir_name,
@@ -45,7 +46,8 @@ void print_verilog_submodule(
   /* Decoders for architecture */
   print_verilog_submodule_arch_decoders(
     const_cast<const ModuleManager&>(module_manager), netlist_manager,
-    decoder_lib, submodule_dir, submodule_dir_name, fpga_verilog_opts);
+    netlist_manifest, decoder_lib, submodule_dir, submodule_dir_name,
+    fpga_verilog_opts);
 
   /* Routing multiplexers */
   /* NOTE: local decoders generation must go before the MUX generation!!!
@@ -53,8 +55,9 @@ void print_verilog_submodule(
    * modules
    */
   print_verilog_submodule_mux_local_decoders(
-    const_cast<const ModuleManager&>(module_manager), netlist_manager, mux_lib,
-    circuit_lib, submodule_dir, submodule_dir_name, fpga_verilog_opts);
+    const_cast<const ModuleManager&>(module_manager), netlist_manager,
+    netlist_manifest, mux_lib, circuit_lib, submodule_dir, submodule_dir_name,
+    fpga_verilog_opts);
   print_verilog_submodule_muxes(module_manager, netlist_manager, mux_lib,
                                 circuit_lib, submodule_dir, submodule_dir_name,
                                 fpga_verilog_opts);
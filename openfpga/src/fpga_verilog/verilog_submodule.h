@@ -10,6 +10,7 @@
 #include "module_manager.h"
 #include "mux_library.h"
 #include "netlist_manager.h"
+#include "netlist_manifest.h"
 
 /********************************************************************
  * Function declaration
@@ -20,6 +21,7 @@ namespace openfpga {
 
 void print_verilog_submodule(
   ModuleManager& module_manager, NetlistManager& netlist_manager,
+  NetlistManifest& netlist_manifest,
   const MemoryBankShiftRegisterBanks& blwl_sr_banks, const MuxLibrary& mux_lib,
   const DecoderLibrary& decoder_lib, const CircuitLibrary& circuit_lib,
   const std::string& submodule_dir, const std::string& submodule_dir_name,
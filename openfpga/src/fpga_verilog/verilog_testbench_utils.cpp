@@ -14,6 +14,7 @@
 
 /* Headers from openfpgautil library */
 #include "fabric_global_port_info_utils.h"
+#include "fabric_io_index.h"
 #include "module_manager_utils.h"
 #include "openfpga_atom_netlist_utils.h"
 #include "openfpga_digest.h"
@@ -288,6 +289,10 @@ void print_verilog_testbench_connect_fpga_ios(
     }
   }
 
+  /* Find the mappable I/O port and pin of each I/O location once, rather
+   * than searching all the mappable I/O ports for each I/O block */
+  FabricIoIndex fabric_io_index(module_manager, top_module, io_location_map);
+
   /* Keep tracking which I/Os have been used */
   std::map<ModulePortId, std::vector<bool>> io_used;
   for (const ModulePortId& module_io_port_id : module_io_ports) {
@@ -323,41 +328,13 @@ void print_verilog_testbench_connect_fpga_ios(
      * Otherwise, should find a GPIN for INPAD
      *         or should find a GPOUT for OUTPAD
      */
+    const t_pl_loc& atom_loc =
+      place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc;
     std::pair<ModulePortId, size_t> mapped_module_io_info =
-      std::make_pair(ModulePortId::INVALID(), -1);
-    for (const ModulePortId& module_io_port_id : module_io_ports) {
-      const BasicPort& module_io_port =
-        module_manager.module_port(top_module, module_io_port_id);
-
-      /* Find the index of the mapped GPIO in top-level FPGA fabric */
-      size_t temp_io_index = io_location_map.io_index(
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.x,
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.y,
-        place_ctx.block_locs[atom_ctx.lookup.atom_clb(atom_blk)].loc.sub_tile,
-        module_io_port.get_name());
-
-      /* Bypass invalid index (not mapped to this GPIO port) */
-      if (size_t(-1) == temp_io_index) {
-        continue;
-      }
-
-      /* If the port is an GPIO port, just use it */
-      if (ModuleManager::MODULE_GPIO_PORT ==
-          module_manager.port_type(top_module, module_io_port_id)) {
-        mapped_module_io_info =
-          std::make_pair(module_io_port_id, temp_io_index);
-        break;
-      }
-
-      /* If this is an INPAD, we can use an GPIN port (if available) */
-      if (atom_block_type_to_module_port_type[atom_ctx.nlist.block_type(
-            atom_blk)] ==
-          module_manager.port_type(top_module, module_io_port_id)) {
-        mapped_module_io_info =
-          std::make_pair(module_io_port_id, temp_io_index);
-        break;
-      }
-    }
+      fabric_io_index.find_io_pin(
+        atom_loc.x, atom_loc.y, atom_loc.sub_tile,
+        atom_block_type_to_module_port_type[atom_ctx.nlist.block_type(
+          atom_blk)]);
 
     /* We must find a valid one */
     VTR_ASSERT(true == module_manager.valid_module_port_id(
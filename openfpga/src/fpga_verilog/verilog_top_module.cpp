@@ -11,6 +11,7 @@
 #include "vtr_log.h"
 
 /* Headers from openfpgautil library */
+#include "module_content_hash.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
 #include "verilog_constants.h"
@@ -33,6 +34,7 @@ namespace openfpga {
  * 5. Add module nets/submodules to connect configuration ports
  *******************************************************************/
 void print_verilog_top_module(NetlistManager& netlist_manager,
+                              NetlistManifest& netlist_manifest,
                               const ModuleManager& module_manager,
                               const std::string& verilog_dir,
                               const FabricVerilogOption& options) {
@@ -51,25 +53,35 @@ void print_verilog_top_module(NetlistManager& netlist_manager,
   VTR_LOG("Writing Verilog netlist for top-level module of FPGA fabric '%s'...",
           verilog_fpath.c_str());
 
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
+  /* Skip the netlist if it is the same as the one written in the last run */
+  std::string content_hash =
+    compute_module_content_hash(module_manager, top_module);
+  bool reused = netlist_manifest.is_netlist_up_to_date(
+    verilog_fname, verilog_fpath, content_hash);
+  netlist_manifest.add_netlist(verilog_fname, content_hash, reused);
 
-  check_file_stream(verilog_fpath.c_str(), fp);
+  if (!reused) {
+    /* Create the file stream */
+    std::fstream fp;
+    fp.open(verilog_fpath, std::fstream::out | std::fstream::trunc);
 
-  print_verilog_file_header(
-    fp, std::string("Top-level Verilog module for FPGA"), options.time_stamp());
+    check_file_stream(verilog_fpath.c_str(), fp);
 
-  /* Write the module content in Verilog format */
-  write_verilog_module_to_file(fp, module_manager, top_module,
-                               options.explicit_port_mapping(),
-                               options.default_net_type());
+    print_verilog_file_header(fp,
+                              std::string("Top-level Verilog module for FPGA"),
+                              options.time_stamp());
 
-  /* Add an empty line as a splitter */
-  fp << std::endl;
+    /* Write the module content in Verilog format */
+    write_verilog_module_to_file(fp, module_manager, top_module,
+                                 options.explicit_port_mapping(),
+                                 options.default_net_type());
 
-  /* Close file handler */
-  fp.close();
+    /* Add an empty line as a splitter */
+    fp << std::endl;
+
+    /* Close file handler */
+    fp.close();
+  }
 
   /* Add fname to the netlist name list */
   NetlistId nlist_id = NetlistId::INVALID();
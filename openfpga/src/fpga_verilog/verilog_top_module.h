@@ -9,6 +9,7 @@
 #include "fabric_verilog_options.h"
 #include "module_manager.h"
 #include "netlist_manager.h"
+#include "netlist_manifest.h"
 
 /********************************************************************
  * Function declaration
@@ -18,6 +19,7 @@
 namespace openfpga {
 
 void print_verilog_top_module(NetlistManager& netlist_manager,
+                              NetlistManifest& netlist_manifest,
                               const ModuleManager& module_manager,
                               const std::string& verilog_dir,
                               const FabricVerilogOption& options);
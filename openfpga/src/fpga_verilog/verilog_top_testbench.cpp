@@ -3,6 +3,7 @@
  * an auto-check top-level testbench for a FPGA fabric
  *******************************************************************/
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 
@@ -109,6 +110,32 @@ static void print_verilog_top_testbench_config_chain_port(
     module_manager.module_port(top_module, cc_tail_port_id);
   fp << generate_verilog_port(VERILOG_PORT_WIRE, config_chain_tail_port) << ";"
      << std::endl;
+
+  /* Print the token ports of run-length decompressors if defined */
+  ModulePortId rle_load_port_id = module_manager.find_module_port(
+    top_module, std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME));
+  if (false == module_manager.valid_module_port_id(top_module,
+                                                   rle_load_port_id)) {
+    return;
+  }
+  print_verilog_comment(
+    fp, std::string("---- Configuration-chain run-length decompressors -----"));
+  fp << generate_verilog_port(
+          VERILOG_PORT_REG,
+          module_manager.module_port(top_module, rle_load_port_id))
+     << ";" << std::endl;
+  ModulePortId rle_count_port_id = module_manager.find_module_port(
+    top_module, std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME));
+  fp << generate_verilog_port(
+          VERILOG_PORT_REG,
+          module_manager.module_port(top_module, rle_count_port_id))
+     << ";" << std::endl;
+  ModulePortId rle_ready_port_id = module_manager.find_module_port(
+    top_module, std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME));
+  fp << generate_verilog_port(
+          VERILOG_PORT_WIRE,
+          module_manager.module_port(top_module, rle_ready_port_id))
+     << ";" << std::endl;
 }
 
 /********************************************************************
@@ -210,6 +237,19 @@ static void print_verilog_top_testbench_frame_decoder_port(
 
   fp << generate_verilog_port(VERILOG_PORT_REG, addr_port) << ";" << std::endl;
 
+  /* Print the address mask port for the frame-based decoder here, which is
+   * only available when broadcast is enabled */
+  ModulePortId addr_mask_port_id = module_manager.find_module_port(
+    top_module, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+  if (module_manager.valid_module_port_id(top_module, addr_mask_port_id)) {
+    print_verilog_comment(
+      fp, std::string("---- Address mask port for frame-based decoder -----"));
+    BasicPort addr_mask_port =
+      module_manager.module_port(top_module, addr_mask_port_id);
+    fp << generate_verilog_port(VERILOG_PORT_REG, addr_mask_port) << ";"
+       << std::endl;
+  }
+
   /* Print the data-input port for the frame-based decoder here */
   print_verilog_comment(
     fp, std::string("---- Data input port for frame-based decoder -----"));
@@ -985,18 +1025,6 @@ static size_t calculate_num_config_clock_cycles(
   size_t regional_bitstream_max_size =
     find_fabric_regional_bitstream_max_size(fabric_bitstream);
 
-  /* For configuration chain that require multiple programming clocks. Need a
-   * different calculation */
-  if (config_protocol.type() == CONFIG_MEM_SCAN_CHAIN) {
-    if (config_protocol.num_prog_clocks() > 1) {
-      /* TODO: Try to apply different length as the bitstream size for ccffs are
-       * different driven by differnt clocks! Tried but no luck yet. */
-      regional_bitstream_max_size =
-        config_protocol.num_prog_clocks() *
-        find_fabric_regional_bitstream_max_size(fabric_bitstream);
-    }
-  }
-
   size_t num_config_clock_cycles = 1 + regional_bitstream_max_size;
 
   /* Branch on the type of configuration protocol */
@@ -1007,41 +1035,44 @@ static size_t calculate_num_config_clock_cycles(
        */
       num_config_clock_cycles = 2;
       break;
-    case CONFIG_MEM_SCAN_CHAIN:
-      /* For fast configuration, the bitstream size counts from the first bit
-       * '1' */
-      if (true == fast_configuration) {
-        /* For fast configuration, the number of bits to be skipped
-         * depends on each regional bitstream
-         * For example:
-         *   Region 0: 000000001111101010
-         *   Region 1:     00000011010101
-         *   Region 2:   0010101111000110
-         * The number of bits that can be skipped is limited by Region 2
-         */
-        size_t num_bits_to_skip =
-          find_configuration_chain_fabric_bitstream_size_to_be_skipped(
-            fabric_bitstream, bitstream_manager, bit_value_to_skip);
-
-        if (config_protocol.num_prog_clocks() > 1) {
-          num_bits_to_skip =
-            config_protocol.num_prog_clocks() *
-            find_configuration_chain_fabric_bitstream_size_to_be_skipped(
-              fabric_bitstream, bitstream_manager, bit_value_to_skip);
-        }
-
-        num_config_clock_cycles =
-          1 + regional_bitstream_max_size - num_bits_to_skip;
+    case CONFIG_MEM_SCAN_CHAIN: {
+      /* Programming clocks shift their bitstreams one after another, each of
+       * which only covers the longest chain driven by the clock. Note that
+       * it takes one more cycle to switch between two programming clocks.
+       * For fast configuration, the bitstream size counts from the first bit
+       * '1', which depends on each regional bitstream.
+       * For example:
+       *   Region 0: 000000001111101010
+       *   Region 1:     00000011010101
+       *   Region 2:   0010101111000110
+       * The number of bits that can be skipped is limited by Region 2
+       */
+      std::vector<size_t> prog_clock_bitstream_sizes =
+        find_configuration_chain_prog_clock_bitstream_sizes(
+          fabric_bitstream, bitstream_manager, config_protocol,
+          fast_configuration, bit_value_to_skip);
+      size_t full_num_config_clock_cycles =
+        1 + prog_clock_bitstream_sizes.size() * regional_bitstream_max_size;
+      num_config_clock_cycles = prog_clock_bitstream_sizes.size();
+      for (const size_t& prog_clock_bitstream_size :
+           prog_clock_bitstream_sizes) {
+        num_config_clock_cycles += prog_clock_bitstream_size;
+      }
 
+      if ((true == fast_configuration) ||
+          (1 < prog_clock_bitstream_sizes.size())) {
         VTR_LOG(
-          "Fast configuration reduces number of configuration clock cycles "
-          "from %lu to %lu (compression_rate = %f%)\n",
-          1 + regional_bitstream_max_size, num_config_clock_cycles,
+          "%s reduces number of configuration clock cycles from %lu to %lu "
+          "(compression_rate = %f%)\n",
+          fast_configuration ? "Fast configuration"
+                             : "Bitstream length per programming clock",
+          full_num_config_clock_cycles, num_config_clock_cycles,
           100. * ((float)num_config_clock_cycles /
-                    (float)(1 + regional_bitstream_max_size) -
+                    (float)full_num_config_clock_cycles -
                   1.));
       }
       break;
+    }
     case CONFIG_MEM_QL_MEMORY_BANK: {
       if (BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type()) {
         /* For fast configuration, we will skip all the zero data points */
@@ -1096,6 +1127,14 @@ static size_t calculate_num_config_clock_cycles(
       break;
     }
     case CONFIG_MEM_FRAME_BASED: {
+      /* With address mask, identical frames are broadcast in one cycle */
+      if (0 < fabric_bitstream.address_mask_length()) {
+        num_config_clock_cycles =
+          1 + build_frame_based_multicast_fabric_bitstream(
+                fabric_bitstream, fast_configuration, bit_value_to_skip)
+                .size();
+        break;
+      }
       num_config_clock_cycles =
         1 +
         build_frame_based_fabric_bitstream_by_address(fabric_bitstream).size();
@@ -1609,15 +1648,21 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE),
                             fabric_bitstream.num_regions());
 
-  /* Additional constants for multiple programming clock */
+  /* Additional constants for multiple programming clock. Each programming
+   * clock only shifts the last bits of the bitstream, which are required by
+   * the longest chain it drives */
   if (num_prog_clocks > 1) {
+    std::vector<size_t> prog_clock_bitstream_sizes =
+      find_configuration_chain_prog_clock_bitstream_sizes(
+        fabric_bitstream, bitstream_manager, config_protocol,
+        fast_configuration, bit_value_to_skip);
     for (size_t iclk = 0; iclk < num_prog_clocks; ++iclk) {
-      /* TODO: Try to apply different length as the bitstream size for ccffs are
-       * different driven by differnt clocks! Tried but no luck yet. */
+      VTR_ASSERT(prog_clock_bitstream_sizes[iclk] <=
+                 regional_bitstream_max_size - num_bits_to_skip);
       print_verilog_define_flag(
         fp,
         std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE) + std::to_string(iclk),
-        regional_bitstream_max_size - num_bits_to_skip);
+        prog_clock_bitstream_sizes[iclk]);
     }
   }
 
@@ -1647,9 +1692,8 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
   } else {
     VTR_ASSERT(num_prog_clocks > 1);
     for (size_t iclk = 0; iclk < num_prog_clocks; ++iclk) {
-      fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk
-         << "):0] " << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk << ";"
-         << std::endl;
+      fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] "
+         << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk << ";" << std::endl;
     }
   }
 
@@ -1683,9 +1727,12 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
     fp << std::endl;
   } else {
     VTR_ASSERT(num_prog_clocks > 1);
+    /* Each programming clock starts from the first bit it requires */
     for (size_t iclk = 0; iclk < num_prog_clocks; ++iclk) {
       fp << "\t";
-      fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk << " <= 0";
+      fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk << " <= `"
+         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - `"
+         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk;
       fp << ";";
       fp << std::endl;
     }
@@ -1759,9 +1806,11 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
     VTR_ASSERT(num_prog_clocks > 1);
     for (size_t iclk = 0; iclk < num_prog_clocks; ++iclk) {
       fp << "\t";
-      fp << "for (" << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " = 0; ";
+      fp << "for (" << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " = `"
+         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - `"
+         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk << "; ";
       fp << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " < `"
-         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk << " + 1; ";
+         << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "; ";
       fp << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " = "
          << TOP_TB_BITSTREAM_ITERATOR_REG_NAME << " + 1)";
       fp << " begin";
@@ -1904,7 +1953,7 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
       fp << "if (";
       fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk;
       fp << " >= ";
-      fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk;
+      fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
       fp << ") begin";
       fp << std::endl;
 
@@ -1934,7 +1983,7 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
       fp << " >= 0 && ";
       fp << TOP_TB_BITSTREAM_INDEX_REG_NAME << iclk;
       fp << " < ";
-      fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << iclk;
+      fp << "`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE;
       fp << ") begin";
       fp << std::endl;
 
@@ -1964,6 +2013,315 @@ static void print_verilog_full_testbench_configuration_chain_bitstream(
     fp, "----- End bitstream loading during configuration phase -----");
 }
 
+/********************************************************************
+ * Find the hierarchical path from a parent module to the module which
+ * instanciates a given child module, e.g., "fpga_core_uut."
+ * Return false if the child module is not found under the parent module
+ *******************************************************************/
+static bool find_verilog_child_module_parent_path(
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const ModuleId& child_module, std::string& path) {
+  for (const ModuleId& curr_child :
+       module_manager.child_modules(parent_module)) {
+    if (curr_child == child_module) {
+      return true;
+    }
+  }
+  for (const ModuleId& curr_child :
+       module_manager.child_modules(parent_module)) {
+    for (size_t inst = 0;
+         inst < module_manager.num_instance(parent_module, curr_child);
+         ++inst) {
+      std::string curr_path =
+        path + module_manager.instance_name(parent_module, curr_child, inst) +
+        std::string(".");
+      if (true == find_verilog_child_module_parent_path(
+                    module_manager, curr_child, child_module, curr_path)) {
+        path = curr_path;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/********************************************************************
+ * Compute the signature of a configuration bitstream in the same way as the
+ * testbench, i.e., a CRC-32 shift register where bits are fed in sequence
+ *******************************************************************/
+static uint32_t compute_config_chain_bitstream_signature(
+  const std::vector<bool>& bitstream, const size_t& num_bits_to_skip) {
+  uint32_t signature = 0;
+  for (size_t ibit = num_bits_to_skip; ibit < bitstream.size(); ++ibit) {
+    uint32_t feedback = (signature & 0x80000000) ? 0x04C11DB7 : 0;
+    signature = (signature << 1) ^ feedback ^ (uint32_t)bitstream[ibit];
+  }
+  return signature;
+}
+
+/********************************************************************
+ * Print stimulus for a FPGA fabric with a configuration chain protocol
+ * where the configuration chain of each region is driven by a run-length
+ * decompressor
+ *
+ * - A token is loaded to each decompressor in the first programming cycle
+ *   and then whenever the decompressor raises its ready signal
+ * - The output of each decompressor is compressed into a signature, which is
+ *   compared to the signature of the plain bitstream when configuration is
+ *   done. This ensures that the decompressed bitstream is the same as the
+ *   plain one
+ *******************************************************************/
+static void print_verilog_full_testbench_rle_configuration_chain_bitstream(
+  std::fstream& fp, const std::string& bitstream_file,
+  const bool& fast_configuration, const bool& bit_value_to_skip,
+  const bool& self_checking, const ModuleManager& module_manager,
+  const ModuleId& top_module, const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream,
+  const ConfigProtocol& config_protocol) {
+  /* Validate the file stream */
+  valid_file_stream(fp);
+
+  print_verilog_comment(
+    fp, "----- Begin bitstream loading during configuration phase -----");
+
+  size_t count_size = config_protocol.rle_count_size();
+
+  /* Find the longest bitstream */
+  size_t regional_bitstream_max_size =
+    find_fabric_regional_bitstream_max_size(fabric_bitstream);
+
+  /* Fast configuration is rejected by the caller, as the testbench does not
+   * check the configuration bits which are skipped */
+  VTR_ASSERT(false == fast_configuration);
+  (void)bit_value_to_skip;
+  size_t num_bits_to_skip = 0;
+
+  ConfigChainFabricBitstream regional_bitstreams =
+    build_config_chain_fabric_bitstream_by_region(bitstream_manager,
+                                                  fabric_bitstream);
+  ConfigChainRleFabricBitstream regional_tokens =
+    build_config_chain_rle_fabric_bitstream_by_region(
+      bitstream_manager, fabric_bitstream, count_size, num_bits_to_skip);
+  size_t max_num_tokens = 0;
+  for (const auto& region_tokens : regional_tokens) {
+    max_num_tokens = std::max(max_num_tokens, region_tokens.size());
+  }
+
+  /* Find the decompressors in the FPGA instance */
+  ModuleId rle_module = module_manager.find_module(
+    std::string(CONFIG_CHAIN_RLE_DECOMPRESSOR_MODULE_NAME));
+  VTR_ASSERT(true == module_manager.valid_module_id(rle_module));
+  std::string rle_parent_path;
+  if (false == find_verilog_child_module_parent_path(
+                 module_manager, top_module, rle_module, rle_parent_path)) {
+    VTR_LOG_ERROR("Unable to find run-length decompressors in module '%s'!\n",
+                  module_manager.module_name(top_module).c_str());
+    exit(1);
+  }
+  rle_parent_path =
+    std::string(TOP_TESTBENCH_FPGA_INSTANCE_NAME) + "." + rle_parent_path;
+
+  /* Define constants for the bitstream length, where each programming cycle
+   * shifts a configuration bit */
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE),
+                            max_num_tokens);
+  print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE),
+                            fabric_bitstream.num_regions() * (1 + count_size));
+  print_verilog_define_flag(fp, std::string(TOP_TB_RLE_NUM_CYCLES_VARIABLE),
+                            regional_bitstream_max_size - num_bits_to_skip);
+
+  ModulePortId cc_head_port_id = module_manager.find_module_port(
+    top_module, generate_configuration_chain_head_name());
+  BasicPort config_chain_head_port =
+    module_manager.module_port(top_module, cc_head_port_id);
+  BasicPort load_port = module_manager.module_port(
+    top_module, module_manager.find_module_port(
+                  top_module, std::string(CONFIG_CHAIN_RLE_LOAD_PORT_NAME)));
+  BasicPort count_port = module_manager.module_port(
+    top_module, module_manager.find_module_port(
+                  top_module, std::string(CONFIG_CHAIN_RLE_COUNT_PORT_NAME)));
+  BasicPort ready_port = module_manager.module_port(
+    top_module, module_manager.find_module_port(
+                  top_module, std::string(CONFIG_CHAIN_RLE_READY_PORT_NAME)));
+
+  /* Declare local variables for bitstream loading in Verilog */
+  print_verilog_comment(
+    fp, "----- Virtual memory to store the bitstream from external file -----");
+  fp << "reg [0:`" << TOP_TB_BITSTREAM_WIDTH_VARIABLE << " - 1] ";
+  fp << TOP_TB_BITSTREAM_MEM_REG_NAME << "[0:`"
+     << TOP_TB_BITSTREAM_LENGTH_VARIABLE << " - 1];";
+  fp << std::endl;
+  for (size_t iregion = 0; iregion < regional_tokens.size(); ++iregion) {
+    fp << "reg [$clog2(`" << TOP_TB_BITSTREAM_LENGTH_VARIABLE << "):0] "
+       << TOP_TB_BITSTREAM_INDEX_REG_NAME << iregion << ";" << std::endl;
+    fp << "reg [31:0] " << TOP_TB_RLE_SIGNATURE_REG_NAME << iregion << ";"
+       << std::endl;
+  }
+  fp << "reg [$clog2(`" << TOP_TB_RLE_NUM_CYCLES_VARIABLE << "):0] "
+     << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << ";" << std::endl;
+
+  print_verilog_comment(
+    fp, "----- Preload bitstream file to a virtual memory -----");
+  fp << "initial begin" << std::endl;
+  fp << "\t";
+  fp << "$readmemb(\"" << bitstream_file << "\", "
+     << TOP_TB_BITSTREAM_MEM_REG_NAME << ");";
+  fp << std::endl;
+  for (const BasicPort& port :
+       {config_chain_head_port, load_port, count_port}) {
+    fp << "\t";
+    fp << generate_verilog_port_constant_values(
+      port, std::vector<size_t>(port.get_width(), 0), true);
+    fp << ";" << std::endl;
+  }
+  for (size_t iregion = 0; iregion < regional_tokens.size(); ++iregion) {
+    fp << "\t" << TOP_TB_BITSTREAM_INDEX_REG_NAME << iregion << " <= 0;"
+       << std::endl;
+    fp << "\t" << TOP_TB_RLE_SIGNATURE_REG_NAME << iregion << " <= 0;"
+       << std::endl;
+  }
+  fp << "\t" << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " <= 0;" << std::endl;
+  fp << "end" << std::endl;
+
+  BasicPort prog_clock_port(std::string(TOP_TB_PROG_CLOCK_PORT_NAME) +
+                              std::string(TOP_TB_CLOCK_REG_POSTFIX),
+                            1);
+  BasicPort config_done_port(std::string(TOP_TB_CONFIG_DONE_PORT_NAME), 1);
+
+  /* Feed tokens at the falling edge of programming clock */
+  fp << "always";
+  fp << " @(negedge "
+     << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")";
+  fp << " begin";
+  fp << std::endl;
+
+  fp << "\t";
+  fp << "if (" << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " >= `"
+     << TOP_TB_RLE_NUM_CYCLES_VARIABLE << ") begin" << std::endl;
+
+  /* Check the signatures only once when configuration is done */
+  fp << "\t\t";
+  fp << "if (" << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port)
+     << " == 1'b0) begin" << std::endl;
+  fp << "\t\t\t";
+  fp << "$display(\"Run-length decompressors load " << max_num_tokens
+     << " tokens in %0d programming cycles\", "
+     << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << ");" << std::endl;
+  for (size_t iregion = 0; iregion < regional_tokens.size(); ++iregion) {
+    uint32_t signature = compute_config_chain_bitstream_signature(
+      regional_bitstreams[iregion], num_bits_to_skip);
+    fp << "\t\t\t";
+    fp << "if (" << TOP_TB_RLE_SIGNATURE_REG_NAME << iregion << " !== 32'h"
+       << std::hex << std::setfill('0') << std::setw(8) << signature
+       << std::dec << std::setfill(' ') << ") begin" << std::endl;
+    fp << "\t\t\t\t";
+    fp << "$display(\"Error: Decompressed bitstream of configuration region "
+       << iregion << " mismatches (signature %h)!\", "
+       << TOP_TB_RLE_SIGNATURE_REG_NAME << iregion << ");" << std::endl;
+    if (true == self_checking) {
+      fp << "\t\t\t\t";
+      fp << TOP_TESTBENCH_ERROR_COUNTER << " = " << TOP_TESTBENCH_ERROR_COUNTER
+         << " + 1;" << std::endl;
+    }
+    fp << "\t\t\t";
+    fp << "end" << std::endl;
+  }
+  fp << "\t\t";
+  fp << "end" << std::endl;
+
+  fp << "\t\t";
+  fp << generate_verilog_port_constant_values(
+    config_done_port, std::vector<size_t>(config_done_port.get_width(), 1),
+    true);
+  fp << ";" << std::endl;
+  fp << "\t\t";
+  fp << generate_verilog_port_constant_values(
+    load_port, std::vector<size_t>(load_port.get_width(), 0), true);
+  fp << ";" << std::endl;
+
+  fp << "\t";
+  fp << "end else begin" << std::endl;
+
+  fp << "\t\t";
+  fp << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " <= "
+     << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " + 1;" << std::endl;
+
+  for (size_t iregion = 0; iregion < regional_tokens.size(); ++iregion) {
+    std::string index_reg =
+      std::string(TOP_TB_BITSTREAM_INDEX_REG_NAME) + std::to_string(iregion);
+    BasicPort head_pin(config_chain_head_port.get_name(),
+                       config_chain_head_port.pins()[iregion],
+                       config_chain_head_port.pins()[iregion]);
+    BasicPort load_pin(load_port.get_name(), load_port.pins()[iregion],
+                       load_port.pins()[iregion]);
+    BasicPort ready_pin(ready_port.get_name(), ready_port.pins()[iregion],
+                        ready_port.pins()[iregion]);
+    BasicPort count_pins(count_port.get_name(),
+                         count_port.pins()[iregion * count_size],
+                         count_port.pins()[iregion * count_size] +
+                           count_size - 1);
+    size_t token_lsb = iregion * (1 + count_size);
+
+    fp << "\t\t";
+    fp << "if (((" << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " == 0) || ("
+       << generate_verilog_port(VERILOG_PORT_CONKT, ready_pin)
+       << " == 1'b1)) && (" << index_reg << " < "
+       << regional_tokens[iregion].size() << ")) begin" << std::endl;
+    fp << "\t\t\t";
+    fp << generate_verilog_port(VERILOG_PORT_CONKT, head_pin) << " <= "
+       << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << index_reg << "]["
+       << token_lsb << "];" << std::endl;
+    fp << "\t\t\t";
+    fp << generate_verilog_port(VERILOG_PORT_CONKT, count_pins) << " <= "
+       << TOP_TB_BITSTREAM_MEM_REG_NAME << "[" << index_reg << "]["
+       << token_lsb + 1 << ":" << token_lsb + count_size << "];" << std::endl;
+    fp << "\t\t\t";
+    fp << generate_verilog_port(VERILOG_PORT_CONKT, load_pin) << " <= 1'b1;"
+       << std::endl;
+    fp << "\t\t\t";
+    fp << index_reg << " <= " << index_reg << " + 1;" << std::endl;
+    fp << "\t\t";
+    fp << "end else begin" << std::endl;
+    fp << "\t\t\t";
+    fp << generate_verilog_port(VERILOG_PORT_CONKT, load_pin) << " <= 1'b0;"
+       << std::endl;
+    fp << "\t\t";
+    fp << "end" << std::endl;
+  }
+
+  fp << "\t";
+  fp << "end" << std::endl;
+  fp << "end" << std::endl;
+
+  /* Compress the bits fed to the configuration chains into signatures. The
+   * decompressors output a configuration bit since the cycle when the first
+   * tokens are loaded */
+  fp << "always";
+  fp << " @(posedge "
+     << generate_verilog_port(VERILOG_PORT_CONKT, prog_clock_port) << ")";
+  fp << " begin";
+  fp << std::endl;
+  fp << "\t";
+  fp << "if ((" << TOP_TB_RLE_CYCLE_COUNTER_REG_NAME << " > 0) && ("
+     << generate_verilog_port(VERILOG_PORT_CONKT, config_done_port)
+     << " == 1'b0)) begin" << std::endl;
+  for (size_t iregion = 0; iregion < regional_tokens.size(); ++iregion) {
+    std::string sig_reg =
+      std::string(TOP_TB_RLE_SIGNATURE_REG_NAME) + std::to_string(iregion);
+    fp << "\t\t";
+    fp << sig_reg << " <= {" << sig_reg << "[30:0], 1'b0} ^ ({32{" << sig_reg
+       << "[31]}} & 32'h04C11DB7) ^ {31'b0, " << rle_parent_path
+       << CONFIG_CHAIN_RLE_DECOMPRESSOR_INSTANCE_PREFIX << iregion << "."
+       << CONFIGURABLE_MEMORY_CHAIN_OUT_NAME << "};" << std::endl;
+  }
+  fp << "\t";
+  fp << "end" << std::endl;
+  fp << "end" << std::endl;
+
+  print_verilog_comment(
+    fp, "----- End bitstream loading during configuration phase -----");
+}
+
 /********************************************************************
  * Print stimulus for a FPGA fabric with a memory bank configuration protocol
  * where configuration bits are programming in serial (one by one)
@@ -2150,6 +2508,22 @@ static void print_verilog_full_testbench_frame_decoder_bitstream(
         fabric_bitstream, bit_value_to_skip);
   }
   VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
+  size_t bitstream_length = fabric_bits_by_addr.size() - num_bits_to_skip;
+
+  /* When an address mask is available, identical frames are merged and
+   * broadcast, and each word of the bitstream file includes the mask */
+  ModulePortId addr_mask_port_id = module_manager.find_module_port(
+    top_module, std::string(DECODER_ADDRESS_MASK_PORT_NAME));
+  bool use_addr_mask =
+    module_manager.valid_module_port_id(top_module, addr_mask_port_id);
+  BasicPort addr_mask_port;
+  if (true == use_addr_mask) {
+    addr_mask_port = module_manager.module_port(top_module, addr_mask_port_id);
+    bitstream_length = build_frame_based_multicast_fabric_bitstream(
+                         fabric_bitstream, fast_configuration,
+                         bit_value_to_skip)
+                         .size();
+  }
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -2167,9 +2541,11 @@ static void print_verilog_full_testbench_frame_decoder_bitstream(
 
   /* Define a constant for the bitstream length */
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_LENGTH_VARIABLE),
-                            fabric_bits_by_addr.size() - num_bits_to_skip);
+                            bitstream_length);
   print_verilog_define_flag(fp, std::string(TOP_TB_BITSTREAM_WIDTH_VARIABLE),
-                            addr_port.get_width() + din_port.get_width());
+                            addr_port.get_width() +
+                              addr_mask_port.get_width() +
+                              din_port.get_width());
 
   /* Declare local variables for bitstream loading in Verilog */
   print_verilog_comment(
@@ -2196,6 +2572,15 @@ static void print_verilog_full_testbench_frame_decoder_bitstream(
   fp << ";";
   fp << std::endl;
 
+  if (true == use_addr_mask) {
+    print_verilog_comment(fp, "----- Address mask port default input -----");
+    fp << "\t";
+    fp << generate_verilog_port_constant_values(
+      addr_mask_port, std::vector<size_t>(addr_mask_port.get_width(), 0));
+    fp << ";";
+    fp << std::endl;
+  }
+
   print_verilog_comment(fp, "----- Data-input port default input -----");
   fp << "\t";
   fp << generate_verilog_port_constant_values(din_port, initial_din_values);
@@ -2244,6 +2629,10 @@ static void print_verilog_full_testbench_frame_decoder_bitstream(
   fp << "{";
   fp << generate_verilog_port(VERILOG_PORT_CONKT, addr_port);
   fp << ", ";
+  if (true == use_addr_mask) {
+    fp << generate_verilog_port(VERILOG_PORT_CONKT, addr_mask_port);
+    fp << ", ";
+  }
   fp << generate_verilog_port(VERILOG_PORT_CONKT, din_port);
   fp << "}";
   fp << " <= ";
@@ -2280,7 +2669,8 @@ static void print_verilog_full_testbench_bitstream(
   const bool& bit_value_to_skip, const ModuleManager& module_manager,
   const ModuleId& top_module, const BitstreamManager& bitstream_manager,
   const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const bool& self_checking) {
   /* Branch on the type of configuration protocol */
   switch (config_protocol.type()) {
     case CONFIG_MEM_STANDALONE:
@@ -2289,6 +2679,13 @@ static void print_verilog_full_testbench_bitstream(
 
       break;
     case CONFIG_MEM_SCAN_CHAIN:
+      if (0 < config_protocol.rle_count_size()) {
+        print_verilog_full_testbench_rle_configuration_chain_bitstream(
+          fp, bitstream_file, fast_configuration, bit_value_to_skip,
+          self_checking, module_manager, top_module, bitstream_manager,
+          fabric_bitstream, config_protocol);
+        break;
+      }
       print_verilog_full_testbench_configuration_chain_bitstream(
         fp, bitstream_file, fast_configuration, bit_value_to_skip,
         module_manager, top_module, bitstream_manager, fabric_bitstream,
@@ -2490,6 +2887,16 @@ int print_verilog_full_testbench(
       fabric_bitstream);
   }
 
+  /* Run-length decompressors shift exactly the bits in tokens, while the
+   * skipped bits are not checked yet */
+  if ((true == apply_fast_configuration) &&
+      (0 < config_protocol.rle_count_size())) {
+    VTR_LOG_ERROR(
+      "Fast configuration is not supported by configuration chains with "
+      "run-length decompressors!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* Start of testbench */
   print_verilog_top_testbench_ports(
     fp, module_manager, top_module, atom_ctx, netlist_annotation,
@@ -2586,7 +2993,7 @@ int print_verilog_full_testbench(
   print_verilog_full_testbench_bitstream(
     fp, bitstream_file, config_protocol, apply_fast_configuration,
     bit_value_to_skip, module_manager, top_module, bitstream_manager,
-    fabric_bitstream, blwl_sr_banks);
+    fabric_bitstream, blwl_sr_banks, !options.no_self_checking());
 
   /* Add signal initialization:
    * Bypass writing codes to files due to the autogenerated codes are very
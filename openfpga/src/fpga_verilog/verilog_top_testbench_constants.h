@@ -35,6 +35,9 @@ constexpr const char* TOP_TB_BITSTREAM_MEM_REG_NAME = "bit_mem";
 constexpr const char* TOP_TB_BITSTREAM_INDEX_REG_NAME = "bit_index";
 constexpr const char* TOP_TB_BITSTREAM_ITERATOR_REG_NAME = "ibit";
 constexpr const char* TOP_TB_BITSTREAM_SKIP_FLAG_REG_NAME = "skip_bits";
+constexpr const char* TOP_TB_RLE_NUM_CYCLES_VARIABLE = "RLE_NUM_CYCLES";
+constexpr const char* TOP_TB_RLE_CYCLE_COUNTER_REG_NAME = "rle_cycle_count";
+constexpr const char* TOP_TB_RLE_SIGNATURE_REG_NAME = "rle_signature";
 
 constexpr const char* AUTOCHECK_TOP_TESTBENCH_VERILOG_MODULE_POSTFIX =
   "_autocheck_top_tb";
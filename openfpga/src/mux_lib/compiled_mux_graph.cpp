@@ -0,0 +1,187 @@
+/**************************************************
+ * This file includes member functions for the
+ * data structures in compiled_mux_graph.h
+ *************************************************/
+#include "compiled_mux_graph.h"
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_vector.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Member functions for the class CompiledMuxGraph
+ *************************************************/
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+
+/* Compile an object from a MuxGraph */
+CompiledMuxGraph::CompiledMuxGraph(const MuxGraph& mux_graph) {
+  num_inputs_ = mux_graph.num_inputs();
+  num_outputs_ = mux_graph.num_outputs();
+  num_memory_bits_ = mux_graph.num_memory_bits();
+
+  /* Flatten the memory bits level by level */
+  level_mem_offsets_.reserve(mux_graph.num_levels() + 1);
+  level_mem_offsets_.push_back(0);
+  level_mems_.reserve(num_memory_bits_);
+  for (const size_t& level : mux_graph.levels()) {
+    for (const MuxMemId& mem : mux_graph.memories_at_level(level)) {
+      level_mems_.push_back(mem);
+    }
+    level_mem_offsets_.push_back(level_mems_.size());
+  }
+
+  /* Each node of a multiplexer drives at most one edge. Find the node driven
+   * by each node and the memory bit controlling the edge, so that the path
+   * from an input to the outputs can be followed without graph walks
+   * Note that if inv_mem is enabled, it means 0 to enable the edge
+   * otherwise, it is 1 to enable the edge
+   */
+  vtr::vector<MuxNodeId, MuxNodeId> next_nodes(mux_graph.nodes().size(),
+                                               MuxNodeId::INVALID());
+  vtr::vector<MuxNodeId, MuxMemId> next_mems(mux_graph.nodes().size(),
+                                             MuxMemId::INVALID());
+  vtr::vector<MuxNodeId, bool> next_mem_values(mux_graph.nodes().size(),
+                                               false);
+  for (const MuxNodeId& node : mux_graph.nodes()) {
+    for (const MuxEdgeId& edge : mux_graph.node_in_edges(node)) {
+      for (const MuxNodeId& src_node : mux_graph.edge_src_nodes(edge)) {
+        VTR_ASSERT_SAFE(MuxNodeId::INVALID() == next_nodes[src_node]);
+        next_nodes[src_node] = node;
+        next_mems[src_node] = mux_graph.find_edge_mem(edge);
+        next_mem_values[src_node] = !mux_graph.is_edge_use_inv_mem(edge);
+      }
+    }
+  }
+
+  /* Build the decode tables: follow the path from each input and record the
+   * memory bits each time an output is reached */
+  decode_tables_.resize(num_outputs_ * num_inputs_);
+  routable_.resize(num_outputs_ * num_inputs_, false);
+  for (const MuxNodeId& input_node : mux_graph.inputs()) {
+    MuxInputId input_id = mux_graph.input_id(input_node);
+    std::vector<bool> mem_bits(num_memory_bits_, false);
+    MuxNodeId cur_node = input_node;
+    while (MuxNodeId::INVALID() != next_nodes[cur_node]) {
+      VTR_ASSERT(MuxMemId::INVALID() != next_mems[cur_node]);
+      mem_bits[size_t(next_mems[cur_node])] = next_mem_values[cur_node];
+      cur_node = next_nodes[cur_node];
+      if (false == mux_graph.is_node_output(cur_node)) {
+        continue;
+      }
+      size_t table_index =
+        decode_table_index(input_id, mux_graph.output_id(cur_node));
+      decode_tables_[table_index] = mem_bits;
+      routable_[table_index] = true;
+    }
+  }
+
+  VTR_ASSERT_SAFE(valid_decode_tables(mux_graph));
+}
+
+/**************************************************
+ * Public Accessors: Data query
+ *************************************************/
+size_t CompiledMuxGraph::num_inputs() const { return num_inputs_; }
+
+size_t CompiledMuxGraph::num_outputs() const { return num_outputs_; }
+
+size_t CompiledMuxGraph::num_levels() const {
+  return level_mem_offsets_.size() - 1;
+}
+
+size_t CompiledMuxGraph::num_memory_bits() const { return num_memory_bits_; }
+
+size_t CompiledMuxGraph::num_memory_bits_at_level(const size_t& level) const {
+  VTR_ASSERT_SAFE(valid_level(level));
+  return level_mem_offsets_[level + 1] - level_mem_offsets_[level];
+}
+
+MuxMemId CompiledMuxGraph::memory_at_level(const size_t& level,
+                                           const size_t& index) const {
+  VTR_ASSERT_SAFE(index < num_memory_bits_at_level(level));
+  return level_mems_[level_mem_offsets_[level] + index];
+}
+
+bool CompiledMuxGraph::is_routable(const MuxInputId& input_id,
+                                   const MuxOutputId& output_id) const {
+  return routable_[decode_table_index(input_id, output_id)];
+}
+
+const std::vector<bool>& CompiledMuxGraph::decode_memory_bits(
+  const MuxInputId& input_id, const MuxOutputId& output_id) const {
+  size_t table_index = decode_table_index(input_id, output_id);
+  /* Routing must be success! */
+  VTR_ASSERT(true == routable_[table_index]);
+  return decode_tables_[table_index];
+}
+
+MemoryUsage CompiledMuxGraph::memory_usage() const {
+  MemoryUsage usage("CompiledMuxGraph");
+  usage.add_child(MemoryUsage("levels", heap_memory_usage(level_mem_offsets_) +
+                                          heap_memory_usage(level_mems_)));
+  usage.add_child(MemoryUsage(
+    "decode_tables",
+    heap_memory_usage(decode_tables_) + heap_memory_usage(routable_),
+    decode_tables_.size()));
+  return usage;
+}
+
+/**************************************************
+ * Private accessors
+ *************************************************/
+size_t CompiledMuxGraph::decode_table_index(
+  const MuxInputId& input_id, const MuxOutputId& output_id) const {
+  /* valid the input and output */
+  VTR_ASSERT_SAFE(valid_input_id(input_id));
+  VTR_ASSERT_SAFE(valid_output_id(output_id));
+  return size_t(output_id) * num_inputs_ + size_t(input_id);
+}
+
+/**************************************************
+ * Private validators
+ *************************************************/
+bool CompiledMuxGraph::valid_input_id(const MuxInputId& input_id) const {
+  return size_t(input_id) < num_inputs_;
+}
+
+bool CompiledMuxGraph::valid_output_id(const MuxOutputId& output_id) const {
+  return size_t(output_id) < num_outputs_;
+}
+
+bool CompiledMuxGraph::valid_level(const size_t& level) const {
+  return level < num_levels();
+}
+
+/* Each routable input-to-output pair should require the same memory bits as
+ * the graph decodes. The graph is not kept, so this is only available when
+ * compiling */
+bool CompiledMuxGraph::valid_decode_tables(const MuxGraph& mux_graph) const {
+  for (size_t ioutput = 0; ioutput < num_outputs_; ++ioutput) {
+    for (size_t iinput = 0; iinput < num_inputs_; ++iinput) {
+      if (false == is_routable(MuxInputId(iinput), MuxOutputId(ioutput))) {
+        continue;
+      }
+      vtr::vector<MuxMemId, bool> ref_mem_bits = mux_graph.decode_memory_bits(
+        MuxInputId(iinput), MuxOutputId(ioutput));
+      const std::vector<bool>& mem_bits =
+        decode_memory_bits(MuxInputId(iinput), MuxOutputId(ioutput));
+      if (ref_mem_bits.size() != mem_bits.size()) {
+        return false;
+      }
+      for (const MuxMemId& mem : mux_graph.memories()) {
+        if (ref_mem_bits[mem] != mem_bits[size_t(mem)]) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} /* End namespace openfpga*/
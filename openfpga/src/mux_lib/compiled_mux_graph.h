@@ -0,0 +1,95 @@
+#ifndef COMPILED_MUX_GRAPH_H
+#define COMPILED_MUX_GRAPH_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <vector>
+
+#include "mux_graph.h"
+#include "mux_graph_fwd.h"
+#include "openfpga_memory_usage.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * This file includes a compact and read-only representation
+ * of a multiplexer, which is compiled from a MuxGraph
+ *
+ * MuxGraph is a generic graph which is convenient to build
+ * any multiplexer structure (tree-like, one-level and multi-level)
+ * but querying it requires graph walks and allocates lists.
+ * The compiled multiplexer stores
+ * - the memory bits level by level in flat arrays
+ * - the memory bits required to route each input to each output,
+ *   which are precomputed as decode tables
+ * so that frequent queries, e.g., bitstream generation for each
+ * multiplexer instance in a fabric, become table look-ups
+ *
+ * The object can only be built from a valid MuxGraph and cannot be
+ * modified afterwards
+ *************************************************/
+class CompiledMuxGraph {
+ public: /* Public Constructors */
+  /* Compile an object from a MuxGraph */
+  explicit CompiledMuxGraph(const MuxGraph& mux_graph);
+
+ public: /* Public accessors: Data query */
+  /* Find the number of inputs of the multiplexer */
+  size_t num_inputs() const;
+  /* Find the number of outputs of the multiplexer */
+  size_t num_outputs() const;
+  /* Find the number of levels of the multiplexer */
+  size_t num_levels() const;
+  /* Find the number of memory bits of the multiplexer */
+  size_t num_memory_bits() const;
+  /* Find the number of memory bits at a level */
+  size_t num_memory_bits_at_level(const size_t& level) const;
+  /* Find the memory bit with a given index at a level */
+  MuxMemId memory_at_level(const size_t& level, const size_t& index) const;
+  /* Identify if an input can be routed to an output */
+  bool is_routable(const MuxInputId& input_id,
+                   const MuxOutputId& output_id) const;
+  /* Get the memory bits (indexed by MuxMemId) which route an input to an
+   * output. This is equivalent to MuxGraph::decode_memory_bits() */
+  const std::vector<bool>& decode_memory_bits(
+    const MuxInputId& input_id, const MuxOutputId& output_id) const;
+  /* Estimate the heap memory of the decode tables */
+  MemoryUsage memory_usage() const;
+
+ private: /* Private accessors */
+  /* Index of an input-to-output pair in the decode tables */
+  size_t decode_table_index(const MuxInputId& input_id,
+                            const MuxOutputId& output_id) const;
+
+ private: /* Private validators */
+  bool valid_input_id(const MuxInputId& input_id) const;
+  bool valid_output_id(const MuxOutputId& output_id) const;
+  bool valid_level(const size_t& level) const;
+  /* Check the decode tables against the graph which they are compiled from */
+  bool valid_decode_tables(const MuxGraph& mux_graph) const;
+
+ private: /* Internal data */
+  size_t num_inputs_;
+  size_t num_outputs_;
+  size_t num_memory_bits_;
+
+  /* Memory bits level by level. The memory bits at level i are stored in
+   * level_mems_ from index level_mem_offsets_[i] (included) to
+   * level_mem_offsets_[i + 1] (excluded)
+   */
+  std::vector<size_t> level_mem_offsets_;
+  std::vector<MuxMemId> level_mems_;
+
+  /* Decode tables indexed by [output_id * num_inputs + input_id]
+   * A table is empty when the input cannot be routed to the output,
+   * which is flagged by routable_
+   */
+  std::vector<std::vector<bool>> decode_tables_;
+  std::vector<bool> routable_;
+};
+
+} /* End namespace openfpga*/
+
+#endif
@@ -54,6 +54,11 @@ bool DecoderLibrary::use_readback(const DecoderId& decoder) const {
   return use_readback_[decoder];
 }
 
+bool DecoderLibrary::use_addr_mask(const DecoderId& decoder) const {
+  VTR_ASSERT_SAFE(valid_decoder_id(decoder));
+  return use_addr_mask_[decoder];
+}
+
 /* Find a decoder to the library, with the specification.
  * If found, return the id of decoder.
  * If not found, return an invalid id of decoder
@@ -68,20 +73,16 @@ DecoderId DecoderLibrary::find_decoder(const size_t& addr_size,
                                        const bool& use_enable,
                                        const bool& use_data_in,
                                        const bool& use_data_inv_port,
-                                       const bool& use_readback) const {
-  for (auto decoder : decoders()) {
-    if ((addr_size == addr_sizes_[decoder]) &&
-        (data_size == data_sizes_[decoder]) &&
-        (use_enable == use_enable_[decoder]) &&
-        (use_data_in == use_data_in_[decoder]) &&
-        (use_data_inv_port == use_data_inv_port_[decoder]) &&
-        (use_readback == use_readback_[decoder])) {
-      return decoder;
-    }
+                                       const bool& use_readback,
+                                       const bool& use_addr_mask) const {
+  auto result = decoder_lookup_.find(
+    decoder_key(addr_size, data_size, use_enable, use_data_in,
+                use_data_inv_port, use_readback, use_addr_mask));
+  if (result == decoder_lookup_.end()) {
+    /* Not found, return an invalid id by default */
+    return DecoderId::INVALID();
   }
-
-  /* Not found, return an invalid id by default */
-  return DecoderId::INVALID();
+  return result->second;
 }
 
 /***************************************************************************************
@@ -102,7 +103,8 @@ DecoderId DecoderLibrary::add_decoder(const size_t& addr_size,
                                       const bool& use_enable,
                                       const bool& use_data_in,
                                       const bool& use_data_inv_port,
-                                      const bool& use_readback) {
+                                      const bool& use_readback,
+                                      const bool& use_addr_mask) {
   DecoderId decoder = DecoderId(decoder_ids_.size());
   /* Push to the decoder list */
   decoder_ids_.push_back(decoder);
@@ -113,8 +115,29 @@ DecoderId DecoderLibrary::add_decoder(const size_t& addr_size,
   use_data_in_.push_back(use_data_in);
   use_data_inv_port_.push_back(use_data_inv_port);
   use_readback_.push_back(use_readback);
+  use_addr_mask_.push_back(use_addr_mask);
+
+  /* Keep the first decoder in the look-up when a specification is added
+   * more than once, as the linear search used to find */
+  decoder_lookup_.emplace(
+    decoder_key(addr_size, data_size, use_enable, use_data_in,
+                use_data_inv_port, use_readback, use_addr_mask),
+    decoder);
 
   return decoder;
 }
 
+/***************************************************************************************
+ * Internal functions
+ **************************************************************************************/
+DecoderLibrary::DecoderKey DecoderLibrary::decoder_key(
+  const size_t& addr_size, const size_t& data_size, const bool& use_enable,
+  const bool& use_data_in, const bool& use_data_inv_port,
+  const bool& use_readback, const bool& use_addr_mask) {
+  size_t flags = size_t(use_enable) | (size_t(use_data_in) << 1) |
+                 (size_t(use_data_inv_port) << 2) |
+                 (size_t(use_readback) << 3) | (size_t(use_addr_mask) << 4);
+  return {{addr_size, data_size, flags}};
+}
+
 } /* End namespace openfpga*/
@@ -22,7 +22,11 @@
 #ifndef DECODER_LIBRARY_H
 #define DECODER_LIBRARY_H
 
+#include <array>
+#include <unordered_map>
+
 #include "decoder_library_fwd.h"
+#include "openfpga_hash.h"
 #include "vtr_range.h"
 #include "vtr_vector.h"
 
@@ -54,6 +58,9 @@ class DecoderLibrary {
   /* Get the flag if a decoder includes a readback port which enables readback
    * from configurable memories */
   bool use_readback(const DecoderId& decoder) const;
+  /* Get the flag if a decoder includes an address mask port, where masked
+   * address bits are ignored so that multiple data outputs can be activated */
+  bool use_addr_mask(const DecoderId& decoder) const;
   /* Find a decoder to the library, with the specification.
    * If found, return the id of decoder.
    * If not found, return an invalid id of decoder
@@ -66,7 +73,8 @@ class DecoderLibrary {
   DecoderId find_decoder(const size_t& addr_size, const size_t& data_size,
                          const bool& use_enable, const bool& use_data_in,
                          const bool& use_data_inv_port,
-                         const bool& use_readback) const;
+                         const bool& use_readback,
+                         const bool& use_addr_mask = false) const;
 
  public: /* Public validators */
   /* valid ids */
@@ -77,7 +85,19 @@ class DecoderLibrary {
   DecoderId add_decoder(const size_t& addr_size, const size_t& data_size,
                         const bool& use_enable, const bool& use_data_in,
                         const bool& use_data_inv_port,
-                        const bool& use_readback);
+                        const bool& use_readback,
+                        const bool& use_addr_mask = false);
+
+ private: /* Internal types */
+  /* A decoder is identified by its address size, data size and the flags
+   * packed in a bit mask */
+  typedef std::array<size_t, 3> DecoderKey;
+  static DecoderKey decoder_key(const size_t& addr_size,
+                                const size_t& data_size, const bool& use_enable,
+                                const bool& use_data_in,
+                                const bool& use_data_inv_port,
+                                const bool& use_readback,
+                                const bool& use_addr_mask);
 
  private: /* Internal Data */
   vtr::vector<DecoderId, DecoderId> decoder_ids_;
@@ -87,6 +107,10 @@ class DecoderLibrary {
   vtr::vector<DecoderId, bool> use_data_in_;
   vtr::vector<DecoderId, bool> use_data_inv_port_;
   vtr::vector<DecoderId, bool> use_readback_;
+  vtr::vector<DecoderId, bool> use_addr_mask_;
+
+  /* Fast look-up: the first decoder added with each specification */
+  std::unordered_map<DecoderKey, DecoderId, IndexTripleHash> decoder_lookup_;
 };
 
 } /* End namespace openfpga*/
@@ -710,6 +710,29 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(
   return des_input_id;
 }
 
+MemoryUsage MuxGraph::memory_usage() const {
+  MemoryUsage usage("MuxGraph");
+  usage.add_child(MemoryUsage(
+    "nodes",
+    heap_memory_usage(node_ids_) + heap_memory_usage(node_types_) +
+      heap_memory_usage(node_input_ids_) + heap_memory_usage(node_output_ids_) +
+      heap_memory_usage(node_levels_) + heap_memory_usage(node_ids_at_level_) +
+      heap_memory_usage(node_in_edges_) + heap_memory_usage(node_out_edges_),
+    node_ids_.size()));
+  usage.add_child(MemoryUsage(
+    "edges",
+    heap_memory_usage(edge_ids_) + heap_memory_usage(edge_src_nodes_) +
+      heap_memory_usage(edge_sink_nodes_) + heap_memory_usage(edge_models_) +
+      heap_memory_usage(edge_mem_ids_) + heap_memory_usage(edge_inv_mem_),
+    edge_ids_.size()));
+  usage.add_child(MemoryUsage(
+    "mems", heap_memory_usage(mem_ids_) + heap_memory_usage(mem_levels_),
+    mem_ids_.size()));
+  usage.add_child(MemoryUsage("lookups", heap_memory_usage(node_lookup_) +
+                                           heap_memory_usage(mem_lookup_)));
+  return usage;
+}
+
 /**************************************************
  * Private mutators: basic operations
  *************************************************/
@@ -8,6 +8,7 @@
 
 #include "circuit_library.h"
 #include "mux_graph_fwd.h"
+#include "openfpga_memory_usage.h"
 #include "vtr_range.h"
 #include "vtr_vector.h"
 
@@ -146,6 +147,8 @@ class MuxGraph {
   MuxInputId find_input_node_driven_by_output_node(
     const std::map<MuxMemId, bool>& memory_bits,
     const MuxOutputId& output_id) const;
+  /* Estimate the heap memory of the graph */
+  MemoryUsage memory_usage() const;
 
  private: /* Private mutators : basic operations */
   /* Add a unconfigured node to the MuxGraph */
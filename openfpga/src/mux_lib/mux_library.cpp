@@ -5,6 +5,10 @@
 
 #include "mux_library.h"
 
+#include <algorithm>
+#include <memory>
+
+#include "openfpga_thread_pool.h"
 #include "vtr_assert.h"
 
 /* begin namespace openfpga */
@@ -40,6 +44,12 @@ const MuxGraph& MuxLibrary::mux_graph(const MuxId& mux_id) const {
   return mux_graphs_[mux_id];
 }
 
+const CompiledMuxGraph& MuxLibrary::compiled_mux_graph(
+  const MuxId& mux_id) const {
+  VTR_ASSERT_SAFE(valid_mux_id(mux_id));
+  return compiled_mux_graphs_[mux_id];
+}
+
 /* Get a mux circuit model id */
 CircuitModelId MuxLibrary::mux_circuit_model(const MuxId& mux_id) const {
   VTR_ASSERT_SAFE(valid_mux_id(mux_id));
@@ -56,6 +66,29 @@ size_t MuxLibrary::max_mux_size() const {
   return max_mux_size;
 }
 
+MemoryUsage MuxLibrary::memory_usage() const {
+  MemoryUsage usage("MuxLibrary", 0, mux_ids_.size());
+  MemoryUsage graphs("graphs", mux_graphs_.capacity() * sizeof(MuxGraph),
+                     mux_graphs_.size());
+  for (const MuxGraph& mux_graph : mux_graphs_) {
+    graphs.add_bytes(mux_graph.memory_usage().num_bytes());
+  }
+  usage.add_child(graphs);
+  MemoryUsage compiled_graphs(
+    "compiled_graphs",
+    compiled_mux_graphs_.capacity() * sizeof(CompiledMuxGraph),
+    compiled_mux_graphs_.size());
+  for (const CompiledMuxGraph& compiled_mux_graph : compiled_mux_graphs_) {
+    compiled_graphs.add_bytes(compiled_mux_graph.memory_usage().num_bytes());
+  }
+  usage.add_child(compiled_graphs);
+  usage.add_child(MemoryUsage("circuit_models",
+                              heap_memory_usage(mux_ids_) +
+                                heap_memory_usage(mux_circuit_models_)));
+  usage.add_child(container_memory_usage("lookup", mux_lookup_));
+  return usage;
+}
+
 /**************************************************
  * Private mutators:
  *************************************************/
@@ -74,6 +107,8 @@ void MuxLibrary::add_mux(const CircuitLibrary& circuit_lib,
   mux_ids_.push_back(mux);
   /* Add a mux graph */
   mux_graphs_.push_back(MuxGraph(circuit_lib, circuit_model, mux_size));
+  /* Compile the mux graph */
+  compiled_mux_graphs_.push_back(CompiledMuxGraph(mux_graphs_[mux]));
   /* Recorde mux cirucit model id */
   mux_circuit_models_.push_back(circuit_model);
 
@@ -81,6 +116,52 @@ void MuxLibrary::add_mux(const CircuitLibrary& circuit_lib,
   mux_lookup_[circuit_model][mux_size] = mux;
 }
 
+/* Add a list of muxes to the library
+ * The mux graphs are independent from each other, so that they are built by
+ * multiple threads. Then the graphs are registered sequentially in the order
+ * of the list, which results in the same ids as calling add_mux() one by one
+ */
+void MuxLibrary::add_muxes(
+  const CircuitLibrary& circuit_lib,
+  const std::vector<std::pair<CircuitModelId, size_t>>& muxes) {
+  /* Bypass the muxes which are already in the library or duplicated */
+  std::vector<std::pair<CircuitModelId, size_t>> new_muxes;
+  for (const std::pair<CircuitModelId, size_t>& mux : muxes) {
+    if (valid_mux_size(mux.first, mux.second)) {
+      continue;
+    }
+    if (new_muxes.end() != std::find(new_muxes.begin(), new_muxes.end(), mux)) {
+      continue;
+    }
+    new_muxes.push_back(mux);
+  }
+
+  /* Build and compile the graphs in parallel */
+  std::vector<std::unique_ptr<MuxGraph>> new_mux_graphs(new_muxes.size());
+  std::vector<std::unique_ptr<CompiledMuxGraph>> new_compiled_mux_graphs(
+    new_muxes.size());
+  parallel_for(0, new_muxes.size(), [&](const size_t& imux) {
+    new_mux_graphs[imux].reset(new MuxGraph(
+      circuit_lib, new_muxes[imux].first, new_muxes[imux].second));
+    new_compiled_mux_graphs[imux].reset(
+      new CompiledMuxGraph(*new_mux_graphs[imux]));
+  });
+
+  /* Register the muxes in the order of the list */
+  mux_ids_.reserve(mux_ids_.size() + new_muxes.size());
+  mux_graphs_.reserve(mux_graphs_.size() + new_muxes.size());
+  compiled_mux_graphs_.reserve(compiled_mux_graphs_.size() + new_muxes.size());
+  mux_circuit_models_.reserve(mux_circuit_models_.size() + new_muxes.size());
+  for (size_t imux = 0; imux < new_muxes.size(); ++imux) {
+    MuxId mux = MuxId(mux_ids_.size());
+    mux_ids_.push_back(mux);
+    mux_graphs_.push_back(std::move(*new_mux_graphs[imux]));
+    compiled_mux_graphs_.push_back(std::move(*new_compiled_mux_graphs[imux]));
+    mux_circuit_models_.push_back(new_muxes[imux].first);
+    mux_lookup_[new_muxes[imux].first][new_muxes[imux].second] = mux;
+  }
+}
+
 /**************************************************
  * Private accessors: validator and invalidators
  *************************************************/
@@ -11,9 +11,13 @@
 #define MUX_LIBRARY_H
 
 #include <map>
+#include <utility>
+#include <vector>
 
+#include "compiled_mux_graph.h"
 #include "mux_graph.h"
 #include "mux_library_fwd.h"
+#include "openfpga_memory_usage.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -32,15 +36,26 @@ class MuxLibrary {
   MuxId mux_graph(const CircuitModelId& circuit_model,
                   const size_t& mux_size) const;
   const MuxGraph& mux_graph(const MuxId& mux_id) const;
+  /* Get the compiled MUX graph (read-only), which is preferred for frequent
+   * queries, e.g., decoding memory bits */
+  const CompiledMuxGraph& compiled_mux_graph(const MuxId& mux_id) const;
   /* Get a mux circuit model id */
   CircuitModelId mux_circuit_model(const MuxId& mux_id) const;
   /* Find the mux sizes */
   size_t max_mux_size() const;
+  /* Estimate the heap memory of the library, including all the graphs */
+  MemoryUsage memory_usage() const;
 
  public: /* Public mutators */
   /* Add a mux to the library */
   void add_mux(const CircuitLibrary& circuit_lib,
                const CircuitModelId& circuit_model, const size_t& mux_size);
+  /* Add a list of muxes, each of which is a pair of circuit model and mux
+   * size, to the library. The mux graphs are built in parallel while the ids
+   * are assigned in the order of the list, as add_mux() does */
+  void add_muxes(
+    const CircuitLibrary& circuit_lib,
+    const std::vector<std::pair<CircuitModelId, size_t>>& muxes);
 
  public: /* Public validators */
   bool valid_mux_id(const MuxId& mux) const;
@@ -61,6 +76,8 @@ class MuxLibrary {
   vtr::vector<MuxId, MuxId> mux_ids_; /* Unique identifier for each mux graph */
   vtr::vector<MuxId, MuxGraph>
     mux_graphs_; /* Graphs describing MUX internal structures */
+  vtr::vector<MuxId, CompiledMuxGraph>
+    compiled_mux_graphs_; /* Compiled graphs for fast queries */
   vtr::vector<MuxId, CircuitModelId>
     mux_circuit_models_; /* circuit model id in circuit library */
 
@@ -1,7 +1,11 @@
 /********************************************************************
  * This file includes the functions of builders for MuxLibrary.
  *******************************************************************/
+#include <algorithm>
 #include <cmath>
+#include <set>
+#include <utility>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -16,6 +20,7 @@
 #include "mux_library_builder.h"
 #include "mux_utils.h"
 #include "openfpga_rr_graph_utils.h"
+#include "openfpga_thread_pool.h"
 #include "pb_graph_utils.h"
 #include "pb_type_utils.h"
 
@@ -23,50 +28,58 @@
 namespace openfpga {
 
 /********************************************************************
- * Update MuxLibrary with the unique multiplexer structures
- * found in the global routing architecture
+ * Find the switch driving a routing resource node
+ * All the driver edges should use the same switch. This is equivalent to
+ * get_rr_graph_driver_switches() but does not allocate a list of switches
  *******************************************************************/
-static void build_routing_arch_mux_library(
-  const RRGraphView& rr_graph, const CircuitLibrary& circuit_lib,
-  const VprDeviceAnnotation& vpr_device_annotation, MuxLibrary& mux_lib) {
-  /* The routing path is.
-   * OPIN ----> CHAN ----> ... ----> CHAN ----> IPIN
-   * Each edge is a switch, for IPIN, the switch is a connection block,
-   * for the rest is a switch box
-   */
-  /* Count the sizes of muliplexers in routing architecture */
-  for (const RRNodeId& node : rr_graph.nodes()) {
+static RRSwitchId find_rr_node_driver_switch(const RRGraphView& rr_graph,
+                                             const RRNodeId& node) {
+  RRSwitchId driver_switch = RRSwitchId::INVALID();
+  for (const RREdgeId& edge : rr_graph.node_in_edges(node)) {
+    if (!driver_switch) {
+      driver_switch = RRSwitchId(rr_graph.edge_switch(edge));
+    }
+    VTR_ASSERT(driver_switch == RRSwitchId(rr_graph.edge_switch(edge)));
+  }
+  return driver_switch;
+}
+
+/********************************************************************
+ * Find the unique multiplexers required by a range of routing resource nodes
+ * [node_begin, node_end), in the order of their first appearance
+ * Return the first node whose driver switch has no circuit model, if any
+ *******************************************************************/
+static RRNodeId find_rr_node_range_mux_requirements(
+  std::vector<std::pair<CircuitModelId, size_t>>& mux_requirements,
+  const RRGraphView& rr_graph,
+  const VprDeviceAnnotation& vpr_device_annotation, const size_t& node_begin,
+  const size_t& node_end) {
+  std::set<std::pair<CircuitModelId, size_t>> found_requirements;
+  for (size_t inode = node_begin; inode < node_end; ++inode) {
+    RRNodeId node = RRNodeId(inode);
     switch (rr_graph.node_type(node)) {
       case IPIN:
       case CHANX:
       case CHANY: {
         /* Have to consider the fan_in only, it is a connection block
          * (multiplexer)*/
-        if ((0 == rr_graph.node_in_edges(node).size()) ||
-            (1 == rr_graph.node_in_edges(node).size())) {
+        size_t mux_size = rr_graph.node_in_edges(node).size();
+        if ((0 == mux_size) || (1 == mux_size)) {
           break;
         }
         /* Find the circuit_model for multiplexers in connection blocks */
-        std::vector<RRSwitchId> driver_switches =
-          get_rr_graph_driver_switches(rr_graph, node);
-        VTR_ASSERT(1 == driver_switches.size());
         const CircuitModelId& rr_switch_circuit_model =
-          vpr_device_annotation.rr_switch_circuit_model(driver_switches[0]);
+          vpr_device_annotation.rr_switch_circuit_model(
+            find_rr_node_driver_switch(rr_graph, node));
         /* we should select a circuit model for the routing resource switch */
         if (CircuitModelId::INVALID() == rr_switch_circuit_model) {
-          VTR_LOG_ERROR(
-            "Unable to find the circuit model for rr_switch '%s'!\n",
-            rr_graph.rr_switch_inf(driver_switches[0]).name.c_str());
-          VTR_LOG("Node type: %s\n", rr_graph.node_type_string(node));
-          VTR_LOG("Node coordinate: %s\n",
-                  rr_graph.node_coordinate_to_string(node).c_str());
-          exit(1);
+          return node;
+        }
+        std::pair<CircuitModelId, size_t> mux_requirement(
+          rr_switch_circuit_model, mux_size);
+        if (found_requirements.insert(mux_requirement).second) {
+          mux_requirements.push_back(mux_requirement);
         }
-
-        VTR_ASSERT(CircuitModelId::INVALID() != rr_switch_circuit_model);
-        /* Add the mux to mux_library */
-        mux_lib.add_mux(circuit_lib, rr_switch_circuit_model,
-                        rr_graph.node_in_edges(node).size());
         break;
       }
       default:
@@ -74,6 +87,69 @@ static void build_routing_arch_mux_library(
         break;
     }
   }
+  return RRNodeId::INVALID();
+}
+
+/********************************************************************
+ * Update MuxLibrary with the unique multiplexer structures
+ * found in the global routing architecture
+ *
+ * The routing resource nodes are split into chunks which are scanned by
+ * multiple threads. The unique multiplexers of each chunk are merged in the
+ * order of chunks, so that the multiplexers are added to the library in the
+ * same order as a sequential scan
+ *******************************************************************/
+static void build_routing_arch_mux_library(
+  const RRGraphView& rr_graph, const CircuitLibrary& circuit_lib,
+  const VprDeviceAnnotation& vpr_device_annotation, MuxLibrary& mux_lib) {
+  /* The routing path is.
+   * OPIN ----> CHAN ----> ... ----> CHAN ----> IPIN
+   * Each edge is a switch, for IPIN, the switch is a connection block,
+   * for the rest is a switch box
+   */
+  /* Number of nodes to be scanned by a thread at a time */
+  constexpr size_t NUM_NODES_PER_CHUNK = 65536;
+  size_t num_nodes = rr_graph.num_nodes();
+  size_t num_chunks =
+    (num_nodes + NUM_NODES_PER_CHUNK - 1) / NUM_NODES_PER_CHUNK;
+  std::vector<std::vector<std::pair<CircuitModelId, size_t>>>
+    chunk_mux_requirements(num_chunks);
+  std::vector<RRNodeId> chunk_error_nodes(num_chunks, RRNodeId::INVALID());
+
+  /* Count the sizes of muliplexers in routing architecture */
+  parallel_for(0, num_chunks, [&](const size_t& ichunk) {
+    chunk_error_nodes[ichunk] = find_rr_node_range_mux_requirements(
+      chunk_mux_requirements[ichunk], rr_graph, vpr_device_annotation,
+      ichunk * NUM_NODES_PER_CHUNK,
+      std::min(num_nodes, (ichunk + 1) * NUM_NODES_PER_CHUNK));
+  });
+
+  /* Merge the multiplexers found in each chunk */
+  std::vector<std::pair<CircuitModelId, size_t>> mux_requirements;
+  std::set<std::pair<CircuitModelId, size_t>> found_requirements;
+  for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+    /* Report the first node without a circuit model */
+    const RRNodeId& node = chunk_error_nodes[ichunk];
+    if (node) {
+      VTR_LOG_ERROR(
+        "Unable to find the circuit model for rr_switch '%s'!\n",
+        rr_graph.rr_switch_inf(find_rr_node_driver_switch(rr_graph, node))
+          .name.c_str());
+      VTR_LOG("Node type: %s\n", rr_graph.node_type_string(node));
+      VTR_LOG("Node coordinate: %s\n",
+              rr_graph.node_coordinate_to_string(node).c_str());
+      exit(1);
+    }
+    for (const std::pair<CircuitModelId, size_t>& mux_requirement :
+         chunk_mux_requirements[ichunk]) {
+      if (found_requirements.insert(mux_requirement).second) {
+        mux_requirements.push_back(mux_requirement);
+      }
+    }
+  }
+
+  /* Add the muxes to mux_library */
+  mux_lib.add_muxes(circuit_lib, mux_requirements);
 }
 
 /********************************************************************
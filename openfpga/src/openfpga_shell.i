@@ -1,8 +1,171 @@
 /* SWIG interface file for OpenFPGA shell APIs */
 %module openfpga_shell
-
 %{
+#include "bitstream_view.h"
 #include "openfpga_shell.h"
 %}
 
+%include "std_string.i"
+
+/* Arrays of the bitstream views are exported without copying the elements
+ * in Python, as a memoryview with the type of the elements, e.g.,
+ *   numpy.frombuffer(view.bit_values(), dtype=numpy.uint8)
+ * The memoryview is built on a buffer exporter, which holds a reference to
+ * the view owning the storage. Therefore, the storage outlives the
+ * memoryview and any numpy array built on it.
+ * Tcl has no equivalent of the buffer protocol, so arrays are exported as
+ * byte arrays, which can be decoded by 'binary scan' */
+#ifdef SWIGPYTHON
+%{
+/* A read-only buffer exporter of a bitstream array, which keeps its owner
+ * alive as long as any buffer is exported */
+struct BitstreamArrayBuffer {
+  PyObject_HEAD
+  void* data;
+  Py_ssize_t num_elements;
+  Py_ssize_t element_size;
+  char format[2];
+  PyObject* owner;
+};
+
+static int bitstream_array_buffer_getbuffer(PyObject* exporter,
+                                            Py_buffer* view, int flags) {
+  BitstreamArrayBuffer* buffer = (BitstreamArrayBuffer*)exporter;
+  if (PyBUF_WRITABLE == (flags & PyBUF_WRITABLE)) {
+    PyErr_SetString(PyExc_BufferError, "Bitstream arrays are read-only");
+    view->obj = NULL;
+    return -1;
+  }
+  view->obj = exporter;
+  Py_INCREF(exporter);
+  view->buf = buffer->data;
+  view->len = buffer->num_elements * buffer->element_size;
+  view->readonly = 1;
+  view->itemsize = buffer->element_size;
+  view->format = (PyBUF_FORMAT == (flags & PyBUF_FORMAT)) ? buffer->format
+                                                           : NULL;
+  view->ndim = 1;
+  view->shape =
+    (PyBUF_ND == (flags & PyBUF_ND)) ? &buffer->num_elements : NULL;
+  view->strides =
+    (PyBUF_STRIDES == (flags & PyBUF_STRIDES)) ? &buffer->element_size : NULL;
+  view->suboffsets = NULL;
+  view->internal = NULL;
+  return 0;
+}
+
+static void bitstream_array_buffer_dealloc(PyObject* exporter) {
+  Py_XDECREF(((BitstreamArrayBuffer*)exporter)->owner);
+  Py_TYPE(exporter)->tp_free(exporter);
+}
+
+/* Keep a reference to the owner of the storage, and return a memoryview on
+ * the array */
+static PyObject* bitstream_array_buffer_bind(PyObject* exporter,
+                                             PyObject* owner) {
+  BitstreamArrayBuffer* buffer = (BitstreamArrayBuffer*)exporter;
+  Py_INCREF(owner);
+  Py_XSETREF(buffer->owner, owner);
+  return PyMemoryView_FromObject(exporter);
+}
+
+static PyMethodDef bitstream_array_buffer_methods[] = {
+  {"bind", bitstream_array_buffer_bind, METH_O,
+   "Keep the owner alive and return a memoryview on the array"},
+  {NULL, NULL, 0, NULL}};
+
+static PyBufferProcs bitstream_array_buffer_procs = {
+  bitstream_array_buffer_getbuffer, NULL};
+
+static PyTypeObject bitstream_array_buffer_type = {
+  PyVarObject_HEAD_INIT(NULL, 0) "openfpga_shell.BitstreamArrayBuffer"};
+
+static PyObject* new_bitstream_array_buffer(
+  const openfpga::BitstreamArrayView& array) {
+  if (0 == bitstream_array_buffer_type.tp_basicsize) {
+    bitstream_array_buffer_type.tp_basicsize = sizeof(BitstreamArrayBuffer);
+    bitstream_array_buffer_type.tp_flags = Py_TPFLAGS_DEFAULT;
+    bitstream_array_buffer_type.tp_doc = "Read-only array of a bitstream view";
+    bitstream_array_buffer_type.tp_dealloc = bitstream_array_buffer_dealloc;
+    bitstream_array_buffer_type.tp_as_buffer = &bitstream_array_buffer_procs;
+    bitstream_array_buffer_type.tp_methods = bitstream_array_buffer_methods;
+  }
+  if (0 > PyType_Ready(&bitstream_array_buffer_type)) {
+    return NULL;
+  }
+  BitstreamArrayBuffer* buffer =
+    PyObject_New(BitstreamArrayBuffer, &bitstream_array_buffer_type);
+  if (NULL == buffer) {
+    return NULL;
+  }
+  /* A buffer must not be NULL even if it is empty */
+  static char empty_array;
+  buffer->data = array.data ? (void*)array.data : (void*)&empty_array;
+  buffer->num_elements = array.num_elements;
+  buffer->element_size = array.element_size;
+  buffer->format[0] = array.format;
+  buffer->format[1] = '\0';
+  buffer->owner = NULL;
+  return (PyObject*)buffer;
+}
+%}
+
+%typemap(out) openfpga::BitstreamArrayView {
+  $result = new_bitstream_array_buffer($1);
+}
+
+/* The proxy methods bind the array to the view which owns the storage */
+%define %bitstream_array_method(METHOD)
+%pythonappend METHOD() const "val = val.bind(self)"
+%enddef
+%bitstream_array_method(openfpga::BitstreamManagerView::bit_values)
+%bitstream_array_method(openfpga::BitstreamManagerView::bit_blocks)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_parents)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_bit_offsets)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_num_bits)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_child_offsets)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_children)
+%bitstream_array_method(openfpga::BitstreamManagerView::block_preorder)
+%bitstream_array_method(openfpga::FabricBitstreamView::config_bits)
+%bitstream_array_method(openfpga::FabricBitstreamView::dins)
+%bitstream_array_method(openfpga::FabricBitstreamView::addresses)
+%bitstream_array_method(openfpga::FabricBitstreamView::wl_addresses)
+%bitstream_array_method(openfpga::FabricBitstreamView::region_offsets)
+%bitstream_array_method(openfpga::FabricBitstreamView::region_bits)
+#endif
+#ifdef SWIGTCL
+%typemap(out) openfpga::BitstreamArrayView {
+  Tcl_SetObjResult(interp, Tcl_NewByteArrayObj(
+    (const unsigned char*)$1.data, $1.num_elements * $1.element_size));
+}
+#endif
+
+%ignore openfpga::BitstreamArrayView;
+
+%include "bitstream_view.h"
+
+#ifdef SWIGPYTHON
+/* Iteration helpers on the block hierarchy */
+%extend openfpga::BitstreamManagerView {
+%pythoncode %{
+def iter_block_paths(self):
+    """Yield (block, path) of all the blocks in a depth-first order, where
+    the path is the full hierarchical name, e.g., fpga_top.grid_clb_1__1_"""
+    parents = self.block_parents()
+    paths = {}
+    for block in self.block_preorder():
+        parent = parents[block]
+        name = self.block_name(block)
+        path = name if -1 == parent else paths[parent] + "." + name
+        paths[block] = path
+        yield block, path
+
+def iter_block_bits(self, block):
+    """Return the ids of the bits of a block as a range"""
+    offset = self.block_bit_offsets()[block]
+    return range(offset, offset + self.block_num_bits()[block])
+%}
+}
+#endif
+
 %include "openfpga_shell.h"
@@ -139,6 +139,26 @@ t_mode* LbRRGraph::edge_mode(const LbRREdgeId& edge) const {
   return edge_modes_[edge];
 }
 
+MemoryUsage LbRRGraph::memory_usage() const {
+  MemoryUsage usage("LbRRGraph");
+  usage.add_child(MemoryUsage(
+    "nodes",
+    heap_memory_usage(node_ids_) + heap_memory_usage(node_types_) +
+      heap_memory_usage(node_capacities_) +
+      heap_memory_usage(node_pb_graph_pins_) +
+      heap_memory_usage(node_intrinsic_costs_) +
+      heap_memory_usage(node_in_edges_) + heap_memory_usage(node_out_edges_),
+    node_ids_.size()));
+  usage.add_child(MemoryUsage(
+    "edges",
+    heap_memory_usage(edge_ids_) + heap_memory_usage(edge_src_nodes_) +
+      heap_memory_usage(edge_sink_nodes_) +
+      heap_memory_usage(edge_intrinsic_costs_) + heap_memory_usage(edge_modes_),
+    edge_ids_.size()));
+  usage.add_child(container_memory_usage("node_lookup", node_lookup_));
+  return usage;
+}
+
 /******************************************************************************
  * Public Mutators
  ******************************************************************************/
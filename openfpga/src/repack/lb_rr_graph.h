@@ -156,6 +156,9 @@
 #include "vtr_range.h"
 #include "vtr_vector.h"
 
+/* Header from openfpgautil library */
+#include "openfpga_memory_usage.h"
+
 /* Header from readarch library */
 #include "physical_types.h"
 
@@ -235,6 +238,9 @@ class LbRRGraph {
   float edge_intrinsic_cost(const LbRREdgeId& edge) const;
   t_mode* edge_mode(const LbRREdgeId& edge) const;
 
+  /* Estimate the heap memory of the nodes, edges and fast look-up */
+  MemoryUsage memory_usage() const;
+
  public: /* Mutators */
   /* Reserve the lists of nodes, edges, switches etc. to be memory efficient.
    * This function is mainly used to reserve memory space inside RRGraph,
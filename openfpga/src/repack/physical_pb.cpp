@@ -80,6 +80,12 @@ AtomNetId PhysicalPb::pb_graph_pin_atom_net(
   return AtomNetId::INVALID();
 }
 
+std::map<const t_pb_graph_pin*, AtomNetId> PhysicalPb::pb_graph_pin_atom_nets(
+  const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return pin_atom_nets_[pb];
+}
+
 bool PhysicalPb::is_wire_lut_output(const PhysicalPbId& pb,
                                     const t_pb_graph_pin* pb_graph_pin) const {
   VTR_ASSERT(true == valid_pb_id(pb));
@@ -91,6 +97,12 @@ bool PhysicalPb::is_wire_lut_output(const PhysicalPbId& pb,
   return false;
 }
 
+std::map<const t_pb_graph_pin*, bool> PhysicalPb::wire_lut_outputs(
+  const PhysicalPbId& pb) const {
+  VTR_ASSERT(true == valid_pb_id(pb));
+  return wire_lut_outputs_[pb];
+}
+
 std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable>
 PhysicalPb::truth_tables(const PhysicalPbId& pb) const {
   VTR_ASSERT(true == valid_pb_id(pb));
@@ -124,6 +136,26 @@ size_t PhysicalPb::fixed_mode_select_bitstream_offset(
   return fixed_mode_select_bitstream_offsets_[pb];
 }
 
+MemoryUsage PhysicalPb::memory_usage() const {
+  MemoryUsage usage("PhysicalPb", 0, pb_ids_.size());
+  usage.add_child(MemoryUsage(
+    "pbs",
+    heap_memory_usage(pb_ids_) + heap_memory_usage(pb_graph_nodes_) +
+      heap_memory_usage(names_) + heap_memory_usage(child_pbs_) +
+      heap_memory_usage(parent_pbs_) + heap_memory_usage(type2id_map_)));
+  usage.add_child(MemoryUsage("nets", heap_memory_usage(atom_blocks_) +
+                                        heap_memory_usage(pin_atom_nets_) +
+                                        heap_memory_usage(wire_lut_outputs_)));
+  usage.add_child(MemoryUsage(
+    "configurations",
+    heap_memory_usage(truth_tables_) + heap_memory_usage(mode_bits_) +
+      heap_memory_usage(fixed_bitstreams_) +
+      heap_memory_usage(fixed_bitstream_offsets_) +
+      heap_memory_usage(fixed_mode_select_bitstreams_) +
+      heap_memory_usage(fixed_mode_select_bitstream_offsets_)));
+  return usage;
+}
+
 /******************************************************************************
  * Private Mutators
  ******************************************************************************/
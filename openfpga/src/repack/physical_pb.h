@@ -8,6 +8,9 @@
 #include "vtr_geometry.h"
 #include "vtr_vector.h"
 
+/* Headers from openfpgautil library */
+#include "openfpga_memory_usage.h"
+
 /* Headers from readarch library */
 #include "physical_types.h"
 
@@ -50,8 +53,14 @@ class PhysicalPb {
   std::vector<AtomBlockId> atom_blocks(const PhysicalPbId& pb) const;
   AtomNetId pb_graph_pin_atom_net(const PhysicalPbId& pb,
                                   const t_pb_graph_pin* pb_graph_pin) const;
+  /* Find all the pins which are mapped to atom nets */
+  std::map<const t_pb_graph_pin*, AtomNetId> pb_graph_pin_atom_nets(
+    const PhysicalPbId& pb) const;
   bool is_wire_lut_output(const PhysicalPbId& pb,
                           const t_pb_graph_pin* pb_graph_pin) const;
+  /* Find all the pins whose status on wire LUT output is set */
+  std::map<const t_pb_graph_pin*, bool> wire_lut_outputs(
+    const PhysicalPbId& pb) const;
   std::map<const t_pb_graph_pin*, AtomNetlist::TruthTable> truth_tables(
     const PhysicalPbId& pb) const;
   std::vector<size_t> mode_bits(const PhysicalPbId& pb) const;
@@ -59,6 +68,8 @@ class PhysicalPb {
   size_t fixed_bitstream_offset(const PhysicalPbId& pb) const;
   std::string fixed_mode_select_bitstream(const PhysicalPbId& pb) const;
   size_t fixed_mode_select_bitstream_offset(const PhysicalPbId& pb) const;
+  /* Estimate the heap memory of the physical pbs */
+  MemoryUsage memory_usage() const;
 
  public: /* Public mutators */
   PhysicalPbId create_pb(const t_pb_graph_node* pb_graph_node);
@@ -2,6 +2,11 @@
  * This file includes functions that build the point-to-point direct connections
  * between tiles (programmable blocks)
  ***************************************************************************************/
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -11,6 +16,7 @@
 /* Headers from openfpgautil library */
 #include "openfpga_port.h"
 #include "openfpga_port_parser.h"
+#include "openfpga_thread_pool.h"
 #include "openfpga_tokenizer.h"
 
 /* Headers from vpr library */
@@ -144,36 +150,110 @@ static std::vector<size_t> find_physical_tile_pin_id(
 }
 
 /********************************************************************
- * Check if the grid coorindate given is in the device grid range
+ * Pin ids of a port of a physical tile, indexed by
+ * [width_offset][height_offset][side]
  *******************************************************************/
-static bool is_grid_coordinate_exist_in_device(
-  const DeviceGrid& device_grid, const vtr::Point<size_t>& grid_coordinate) {
-  return (grid_coordinate <
-          vtr::Point<size_t>(device_grid.width(), device_grid.height()));
+typedef std::vector<std::vector<std::array<std::vector<size_t>, NUM_SIDES>>>
+  TilePortPinIds;
+
+/********************************************************************
+ * Find the pin ids of a port of a physical tile at all the locations
+ * and sides of the tile, so that the pin ids can be shared by all the
+ * grids of the same type
+ *******************************************************************/
+static TilePortPinIds build_physical_tile_port_pin_ids(
+  t_physical_tile_type_ptr physical_tile, const BasicPort& tile_port) {
+  TilePortPinIds pin_ids(
+    physical_tile->width,
+    std::vector<std::array<std::vector<size_t>, NUM_SIDES>>(
+      physical_tile->height));
+  for (int iwidth = 0; iwidth < physical_tile->width; ++iwidth) {
+    for (int iheight = 0; iheight < physical_tile->height; ++iheight) {
+      for (const e_side& side : {TOP, RIGHT, BOTTOM, LEFT}) {
+        pin_ids[iwidth][iheight][size_t(side)] = find_physical_tile_pin_id(
+          physical_tile, iwidth, iheight, tile_port, side);
+      }
+    }
+  }
+  return pin_ids;
 }
 
 /********************************************************************
- * Find the coordinate of a grid in a specific column
- * with a given type
- * This function will return the coordinate of the grid that satifies
- * the type requirement
+ * Coordinates of the grids where a tile type is located
+ * - column_ys[x] includes the y coordinates of the grids in column x
+ * - row_xs[y] includes the x coordinates of the grids in row y
+ * All the coordinates are in ascending order
  *******************************************************************/
-static vtr::Point<size_t> find_grid_coordinate_given_type(
-  const DeviceGrid& grids,
-  const std::vector<vtr::Point<size_t>>& candidate_coords,
-  const std::string& wanted_grid_type_name) {
-  for (vtr::Point<size_t> coord : candidate_coords) {
-    /* If the next column is not longer in device range, we can return */
-    if (false == is_grid_coordinate_exist_in_device(grids, coord)) {
-      continue;
+struct TileTypeCoordinates {
+  t_physical_tile_type_ptr type;
+  std::vector<std::vector<size_t>> column_ys;
+  std::vector<std::vector<size_t>> row_xs;
+};
+
+/* Coordinates of the tile types, indexed by the names of tile types */
+typedef std::map<std::string, TileTypeCoordinates> TileTypeCoordinateLookup;
+
+/********************************************************************
+ * Collect the coordinates of each tile type in a single walk through
+ * the device grid. Empty grids are skipped.
+ *******************************************************************/
+static TileTypeCoordinateLookup build_tile_type_coordinate_lookup(
+  const DeviceGrid& grids) {
+  TileTypeCoordinateLookup lookup;
+  for (size_t x = 0; x < grids.width(); ++x) {
+    for (size_t y = 0; y < grids.height(); ++y) {
+      /* Bypass empty grid */
+      if (true == is_empty_type(grids[x][y].type)) {
+        continue;
+      }
+      TileTypeCoordinates& tile_coords =
+        lookup[std::string(grids[x][y].type->name)];
+      if (true == tile_coords.column_ys.empty()) {
+        tile_coords.type = grids[x][y].type;
+        tile_coords.column_ys.resize(grids.width());
+        tile_coords.row_xs.resize(grids.height());
+      }
+      tile_coords.column_ys[x].push_back(y);
+      tile_coords.row_xs[y].push_back(x);
     }
-    if (wanted_grid_type_name ==
-        std::string(grids[coord.x()][coord.y()].type->name)) {
-      return coord;
+  }
+  return lookup;
+}
+
+/********************************************************************
+ * Find the first coordinate of a column (or a row) in the core range
+ * [1, line_size - 2] from the ascending coordinates of a tile type
+ * The search starts from the smallest coordinate, or from the largest
+ * coordinate when reverse is required
+ * Return line_size if there is no such coordinate
+ *******************************************************************/
+static size_t find_core_coordinate_in_line(const std::vector<size_t>& coords,
+                                           const size_t& line_size,
+                                           const bool& reverse) {
+  if (line_size < 2) {
+    return line_size;
+  }
+  if (false == reverse) {
+    auto result = std::lower_bound(coords.begin(), coords.end(), size_t(1));
+    if ((result != coords.end()) && (*result < line_size - 1)) {
+      return *result;
     }
+    return line_size;
   }
-  /* Return an valid coordinate */
-  return vtr::Point<size_t>(grids.width(), grids.height());
+  auto result = std::lower_bound(coords.begin(), coords.end(), line_size - 1);
+  if ((result != coords.begin()) && (*std::prev(result) >= 1)) {
+    return *std::prev(result);
+  }
+  return line_size;
+}
+
+/********************************************************************
+ * Check if the grid coorindate given is in the device grid range
+ *******************************************************************/
+static bool is_grid_coordinate_exist_in_device(
+  const DeviceGrid& device_grid, const vtr::Point<size_t>& grid_coordinate) {
+  return (grid_coordinate <
+          vtr::Point<size_t>(device_grid.width(), device_grid.height()));
 }
 
 /********************************************************************
@@ -181,13 +261,12 @@ static vtr::Point<size_t> find_grid_coordinate_given_type(
  * considering intra column/row direct connections in core grids
  *******************************************************************/
 static vtr::Point<size_t> find_inter_direct_destination_coordinate(
-  const DeviceGrid& grids, const vtr::Point<size_t>& src_coord,
-  const std::string des_tile_type_name, const ArchDirect& arch_direct,
+  const DeviceGrid& grids, const TileTypeCoordinates& des_tile_coords,
+  const vtr::Point<size_t>& src_coord, const ArchDirect& arch_direct,
   const ArchDirectId& arch_direct_id) {
   vtr::Point<size_t> des_coord(grids.width(), grids.height());
 
   std::vector<size_t> first_search_space;
-  std::vector<size_t> second_search_space;
 
   /* Cross column connection from Bottom to Top on Right
    * The next column may NOT have the grid type we want!
@@ -232,12 +311,8 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  +------+
      *  | Grid | 1
      *  +------+
-     */
-    for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
-      second_search_space.push_back(iy);
-    }
-
-    /* For negative direction, our second search space will be in y-direction:
+     *
+     * For positive direction, our second search space will be in y-direction:
      *
      *  +------+
      *  | Grid | ny
@@ -249,9 +324,16 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  | Grid | 1
      *  +------+
      */
-    if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
+    bool reverse = (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id));
+    for (size_t ix : first_search_space) {
+      size_t iy = find_core_coordinate_in_line(des_tile_coords.column_ys[ix],
+                                               grids.height(), reverse);
+      /* For a valid coordinate, we can return */
+      if (iy < grids.height()) {
+        return vtr::Point<size_t>(ix, iy);
+      }
     }
+    return des_coord;
   }
 
   /* Cross row connection from Bottom to Top on Right
@@ -260,83 +342,65 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
    * Our search space will start from the next column
    * and ends at the RIGHT side of fabric
    */
-  if (INTER_ROW == arch_direct.type(arch_direct_id)) {
-    if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-      /* Our first search space will be in y-direction:
-       *
-       *  +------+
-       *  | Grid | ny
-       *  +------+
-       *     ^     .
-       *     |     .
-       *     |     .
-       *  +------+
-       *  | Grid | y
-       *  +------+
-       */
-      for (size_t iy = src_coord.y() + 1; iy < grids.height() - 1; ++iy) {
-        first_search_space.push_back(iy);
-      }
-    } else {
-      VTR_ASSERT(NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id));
-      /* For negative y-direction,
-       * Our first search space will be in y-direction:
-       *
-       *  +------+
-       *  | Grid | ny
-       *  +------+
-       *     |     .
-       *     |     .
-       *     v     .
-       *  +------+
-       *  | Grid | y
-       *  +------+
-       */
-      for (size_t iy = src_coord.y() - 1; iy >= 1; --iy) {
-        first_search_space.push_back(iy);
-      }
-    }
-
-    /* Our second search space will be in x-direction:
+  VTR_ASSERT(INTER_ROW == arch_direct.type(arch_direct_id));
+  if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
+    /* Our first search space will be in y-direction:
      *
-     *     1      ...     nx
-     *  +------+       +------+
-     *  | Grid |<------| Grid |
-     *  +------+       +------+
+     *  +------+
+     *  | Grid | ny
+     *  +------+
+     *     ^     .
+     *     |     .
+     *     |     .
+     *  +------+
+     *  | Grid | y
+     *  +------+
      */
-    for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
-      second_search_space.push_back(ix);
+    for (size_t iy = src_coord.y() + 1; iy < grids.height() - 1; ++iy) {
+      first_search_space.push_back(iy);
     }
-
-    /* For negative direction,
-     * our second search space will be in x-direction:
+  } else {
+    VTR_ASSERT(NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id));
+    /* For negative y-direction,
+     * Our first search space will be in y-direction:
      *
-     *     1      ...     nx
-     *  +------+       +------+
-     *  | Grid |------>| Grid |
-     *  +------+       +------+
+     *  +------+
+     *  | Grid | ny
+     *  +------+
+     *     |     .
+     *     |     .
+     *     v     .
+     *  +------+
+     *  | Grid | y
+     *  +------+
      */
-    if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
+    for (size_t iy = src_coord.y() - 1; iy >= 1; --iy) {
+      first_search_space.push_back(iy);
     }
   }
 
-  for (size_t ix : first_search_space) {
-    std::vector<vtr::Point<size_t>> next_col_row_coords;
-    for (size_t iy : second_search_space) {
-      if (INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-        next_col_row_coords.push_back(vtr::Point<size_t>(ix, iy));
-      } else {
-        VTR_ASSERT(INTER_ROW == arch_direct.type(arch_direct_id));
-        /* For cross-row connection, our search space is flipped */
-        next_col_row_coords.push_back(vtr::Point<size_t>(iy, ix));
-      }
-    }
-    vtr::Point<size_t> des_coord_cand = find_grid_coordinate_given_type(
-      grids, next_col_row_coords, des_tile_type_name);
+  /* Our second search space will be in x-direction:
+   *
+   *     1      ...     nx
+   *  +------+       +------+
+   *  | Grid |<------| Grid |
+   *  +------+       +------+
+   *
+   * For positive direction,
+   * our second search space will be in x-direction:
+   *
+   *     1      ...     nx
+   *  +------+       +------+
+   *  | Grid |------>| Grid |
+   *  +------+       +------+
+   */
+  bool reverse = (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id));
+  for (size_t iy : first_search_space) {
+    size_t ix = find_core_coordinate_in_line(des_tile_coords.row_xs[iy],
+                                             grids.width(), reverse);
     /* For a valid coordinate, we can return */
-    if (true == is_grid_coordinate_exist_in_device(grids, des_coord_cand)) {
-      return des_coord_cand;
+    if (ix < grids.width()) {
+      return vtr::Point<size_t>(ix, iy);
     }
   }
   return des_coord;
@@ -356,6 +420,122 @@ static void report_direct_from_port_and_to_port_mismatch(
     to_tile_port.get_lsb(), to_tile_port.get_msb());
 }
 
+/********************************************************************
+ * A tile-to-tile direct connection which is found by the search
+ * but not yet added to the TileDirect object
+ *******************************************************************/
+struct TileDirectCandidate {
+  vtr::Point<size_t> from_grid_coord;
+  e_side from_side;
+  size_t from_pin;
+  vtr::Point<size_t> to_grid_coord;
+  e_side to_side;
+  size_t to_pin;
+};
+
+/********************************************************************
+ * Pair the pins of a port of the source grid with the pins of a port of
+ * the sink grid, at any side of both grids
+ * Return false if the from port and to port do not match in sizes
+ *******************************************************************/
+static bool find_tile_direct_candidates(
+  std::vector<TileDirectCandidate>& candidates, const DeviceGrid& grids,
+  const vtr::Point<size_t>& from_grid_coord,
+  const TilePortPinIds& from_tile_pins, const vtr::Point<size_t>& to_grid_coord,
+  const TilePortPinIds& to_tile_pins) {
+  const auto& from_grid = grids[from_grid_coord.x()][from_grid_coord.y()];
+  const auto& to_grid = grids[to_grid_coord.x()][to_grid_coord.y()];
+
+  /* Search all the sides, the from pin may locate any side!
+   * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
+   * This should be reported to VPR!!!
+   */
+  for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+    /* Try to find the pin in this tile */
+    const std::vector<size_t>& from_pins =
+      from_tile_pins[from_grid.width_offset][from_grid.height_offset]
+                    [size_t(from_side)];
+    /* If nothing found, we can continue */
+    if (0 == from_pins.size()) {
+      continue;
+    }
+
+    /* Search all the sides, the to pin may locate any side!
+     * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
+     * This should be reported to VPR!!!
+     */
+    for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+      /* Try to find the pin in this tile */
+      const std::vector<size_t>& to_pins =
+        to_tile_pins[to_grid.width_offset][to_grid.height_offset]
+                    [size_t(to_side)];
+      /* If nothing found, we can continue */
+      if (0 == to_pins.size()) {
+        continue;
+      }
+
+      /* If from port and to port do not match in sizes, error out */
+      if (from_pins.size() != to_pins.size()) {
+        return false;
+      }
+
+      for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
+        candidates.push_back({from_grid_coord, from_side, from_pins[ipin],
+                              to_grid_coord, to_side, to_pins[ipin]});
+      }
+    }
+  }
+  return true;
+}
+
+/********************************************************************
+ * Run a number of independent search tasks on the shared thread pool
+ * Each task is identified by its index and returns false on failure
+ * Return false if any of the tasks fails
+ *******************************************************************/
+template <typename SearchTask>
+static bool run_tile_direct_search_tasks(const size_t& num_tasks,
+                                         const SearchTask& search_task) {
+  return parallel_map_reduce(
+    0, num_tasks, true, search_task,
+    [](const bool& status, const bool& task_status) {
+      return status && task_status;
+    });
+}
+
+/********************************************************************
+ * Add the direct connections found by the search tasks to the
+ * TileDirect object, in the order of tasks, so that the results
+ * do not depend on the number of threads
+ *******************************************************************/
+static void add_tile_direct_candidates(
+  TileDirect& tile_direct,
+  const std::vector<std::vector<TileDirectCandidate>>& task_candidates,
+  const std::string& direct_type_name, const std::string& from_tile_name,
+  const BasicPort& from_tile_port, const std::string& to_tile_name,
+  const BasicPort& to_tile_port, const ArchDirectId& arch_direct_id,
+  const bool& verbose) {
+  for (const std::vector<TileDirectCandidate>& candidates : task_candidates) {
+    for (const TileDirectCandidate& candidate : candidates) {
+      VTR_LOGV(verbose,
+               "Built a %s tile-to-tile direct from "
+               "%s[%lu][%lu].%s[%lu] at side '%s' to "
+               "%s[%lu][%lu].%s[%lu] at side '%s'\n",
+               direct_type_name.c_str(), from_tile_name.c_str(),
+               candidate.from_grid_coord.x(), candidate.from_grid_coord.y(),
+               from_tile_port.get_name().c_str(), candidate.from_pin,
+               SIDE_STRING[candidate.from_side], to_tile_name.c_str(),
+               candidate.to_grid_coord.x(), candidate.to_grid_coord.y(),
+               to_tile_port.get_name().c_str(), candidate.to_pin,
+               SIDE_STRING[candidate.to_side]);
+      TileDirectId tile_direct_id = tile_direct.add_direct(
+        candidate.from_grid_coord, candidate.from_side, candidate.from_pin,
+        candidate.to_grid_coord, candidate.to_side, candidate.to_pin);
+      tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
+    }
+  }
+}
+
 /***************************************************************************************
  * Build the point-to-point direct connections based on
  *   - original VPR arch definition
@@ -379,11 +559,13 @@ static void report_direct_from_port_and_to_port_mismatch(
  *     |      |
  *     +------+
  *
+ * The columns of the fabric are searched in parallel
  ***************************************************************************************/
 static void build_inner_column_row_tile_direct(
   TileDirect& tile_direct, const t_direct_inf& vpr_direct,
-  const DeviceContext& device_ctx, const ArchDirectId& arch_direct_id,
-  const bool& verbose) {
+  const DeviceContext& device_ctx,
+  const TileTypeCoordinateLookup& tile_type_coords,
+  const ArchDirectId& arch_direct_id, const bool& verbose) {
   /* Get the source tile and pin information */
   std::string from_tile_name =
     parse_direct_tile_name(std::string(vpr_direct.from_pin));
@@ -398,94 +580,61 @@ static void build_inner_column_row_tile_direct(
     parse_direct_port(std::string(vpr_direct.to_pin)));
   const BasicPort& to_tile_port = to_tile_port_parser.port();
 
+  /* Nothing to build if either tile does not exist in the fabric */
+  auto from_tile_result = tile_type_coords.find(from_tile_name);
+  auto to_tile_result = tile_type_coords.find(to_tile_name);
+  if ((from_tile_result == tile_type_coords.end()) ||
+      (to_tile_result == tile_type_coords.end())) {
+    return;
+  }
+  const TileTypeCoordinates& from_tile_coords = from_tile_result->second;
+  const TileTypeCoordinates& to_tile_coords = to_tile_result->second;
+
+  TilePortPinIds from_tile_pins =
+    build_physical_tile_port_pin_ids(from_tile_coords.type, from_tile_port);
+  TilePortPinIds to_tile_pins =
+    build_physical_tile_port_pin_ids(to_tile_coords.type, to_tile_port);
+
   /* Walk through the device fabric and find the grid that fit the source */
-  for (size_t x = 0; x < device_ctx.grid.width(); ++x) {
-    for (size_t y = 0; y < device_ctx.grid.height(); ++y) {
-      /* Bypass empty grid */
-      if (true == is_empty_type(device_ctx.grid[x][y].type)) {
+  const DeviceGrid& grids = device_ctx.grid;
+  std::vector<std::vector<TileDirectCandidate>> column_candidates(
+    grids.width());
+  bool status = run_tile_direct_search_tasks(grids.width(), [&](size_t x) {
+    for (const size_t& y : from_tile_coords.column_ys[x]) {
+      /* We should try to the sink grid for inner-column/row direct
+       * connections */
+      vtr::Point<size_t> from_grid_coord(x, y);
+      vtr::Point<size_t> to_grid_coord(x + vpr_direct.x_offset,
+                                       y + vpr_direct.y_offset);
+      if (false == is_grid_coordinate_exist_in_device(grids, to_grid_coord)) {
         continue;
       }
 
-      /* Bypass the grid that does not fit the from_tile name */
-      if (from_tile_name != std::string(device_ctx.grid[x][y].type->name)) {
+      /* Bypass the grid that does not fit the to_tile name */
+      if (to_tile_coords.type !=
+          grids[to_grid_coord.x()][to_grid_coord.y()].type) {
         continue;
       }
 
-      /* Search all the sides, the from pin may locate any side!
-       * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
-       * This should be reported to VPR!!!
-       */
-      for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-        /* Try to find the pin in this tile */
-        std::vector<size_t> from_pins = find_physical_tile_pin_id(
-          device_ctx.grid[x][y].type, device_ctx.grid[x][y].width_offset,
-          device_ctx.grid[x][y].height_offset, from_tile_port, from_side);
-        /* If nothing found, we can continue */
-        if (0 == from_pins.size()) {
-          continue;
-        }
-
-        /* We should try to the sink grid for inner-column/row direct
-         * connections */
-        vtr::Point<size_t> from_grid_coord(x, y);
-        vtr::Point<size_t> to_grid_coord(x + vpr_direct.x_offset,
-                                         y + vpr_direct.y_offset);
-        if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
-                                                        to_grid_coord)) {
-          continue;
-        }
-
-        /* Bypass the grid that does not fit the from_tile name */
-        if (to_tile_name !=
-            std::string(device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()]
-                          .type->name)) {
-          continue;
-        }
-
-        /* Search all the sides, the to pin may locate any side!
-         * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
-         * This should be reported to VPR!!!
-         */
-        for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-          /* Try to find the pin in this tile */
-          std::vector<size_t> to_pins = find_physical_tile_pin_id(
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
-            to_tile_port, to_side);
-          /* If nothing found, we can continue */
-          if (0 == to_pins.size()) {
-            continue;
-          }
-
-          /* If from port and to port do not match in sizes, error out */
-          if (from_pins.size() != to_pins.size()) {
-            report_direct_from_port_and_to_port_mismatch(
-              vpr_direct, from_tile_port, to_tile_port);
-            exit(1);
-          }
-
-          /* Now add the tile direct */
-          for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
-            VTR_LOGV(verbose,
-                     "Built a inner-column/row tile-to-tile direct from "
-                     "%s[%lu][%lu].%s[%lu] at side '%s' to "
-                     "%s[%lu][%lu].%s[%lu] at side '%s'\n",
-                     from_tile_name.c_str(), x, y,
-                     from_tile_port.get_name().c_str(), from_pins[ipin],
-                     SIDE_STRING[from_side], to_tile_name.c_str(),
-                     to_grid_coord.x(), to_grid_coord.y(),
-                     to_tile_port.get_name().c_str(), to_pins[ipin],
-                     SIDE_STRING[to_side]);
-            TileDirectId tile_direct_id = tile_direct.add_direct(
-              from_grid_coord, from_side, from_pins[ipin], to_grid_coord,
-              to_side, to_pins[ipin]);
-            tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
-          }
-        }
+      if (false == find_tile_direct_candidates(
+                     column_candidates[x], grids, from_grid_coord,
+                     from_tile_pins, to_grid_coord, to_tile_pins)) {
+        return false;
       }
     }
+    return true;
+  });
+  if (false == status) {
+    report_direct_from_port_and_to_port_mismatch(vpr_direct, from_tile_port,
+                                                 to_tile_port);
+    exit(1);
   }
+
+  /* Now add the tile direct */
+  add_tile_direct_candidates(tile_direct, column_candidates,
+                             std::string("inner-column/row"), from_tile_name,
+                             from_tile_port, to_tile_name, to_tile_port,
+                             arch_direct_id, verbose);
 }
 
 /********************************************************************
@@ -520,11 +669,14 @@ static void build_inner_column_row_tile_direct(
  * Note that: this will only apply to the core grids!
  *            I/Os or any blocks on the border of fabric are NOT supported!
  *
+ * The columns (or rows) of the fabric are searched in parallel
  *******************************************************************/
 static void build_inter_column_row_tile_direct(
   TileDirect& tile_direct, const t_direct_inf& vpr_direct,
-  const DeviceContext& device_ctx, const ArchDirect& arch_direct,
-  const ArchDirectId& arch_direct_id, const bool& verbose) {
+  const DeviceContext& device_ctx,
+  const TileTypeCoordinateLookup& tile_type_coords,
+  const ArchDirect& arch_direct, const ArchDirectId& arch_direct_id,
+  const bool& verbose) {
   /* Get the source tile and pin information */
   std::string from_tile_name =
     parse_direct_tile_name(std::string(vpr_direct.from_pin));
@@ -545,225 +697,100 @@ static void build_inter_column_row_tile_direct(
       (INTER_ROW != arch_direct.type(arch_direct_id))) {
     return;
   }
-  /* For cross-column connection, we will search the first valid grid in each
-   * column from y = 1 to y = ny
-   *
-   *   +------+
-   *   | Grid |  y=ny
-   *   +------+
-   *      ^
-   *      |  search direction (when y_dir is negative)
-   *     ...
-   *      |
-   *   +------+
-   *   | Grid |  y=1
-   *   +------+
-   *
-   */
-  if (INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-    for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-      /* For negative y- direction, we should start from y = ny */
-      for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-        next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-      }
-      /* For positive y- direction, we should start from y = 1 */
-      if (NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-        std::reverse(next_col_src_grid_coords.begin(),
-                     next_col_src_grid_coords.end());
-      }
-
-      /* Bypass the grid that does not fit the from_tile name */
-      vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-        device_ctx.grid, next_col_src_grid_coords, from_tile_name);
-      /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
-       * block */
-      if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
-                                                      from_grid_coord)) {
-        continue;
-      }
-
-      /* Search all the sides, the from pin may locate any side!
-       * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
-       * This should be reported to VPR!!!
-       */
-      for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-        /* Try to find the pin in this tile */
-        std::vector<size_t> from_pins = find_physical_tile_pin_id(
-          device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].type,
-          device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()]
-            .width_offset,
-          device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()]
-            .height_offset,
-          from_tile_port, from_side);
-        /* If nothing found, we can continue */
-        if (0 == from_pins.size()) {
-          continue;
-        }
-
-        /* For a valid coordinate, we can find the coordinate of the destination
-         * clb */
-        vtr::Point<size_t> to_grid_coord =
-          find_inter_direct_destination_coordinate(
-            device_ctx.grid, from_grid_coord, to_tile_name, arch_direct,
-            arch_direct_id);
-        /* If destination clb is valid, we should add something */
-        if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
-                                                        to_grid_coord)) {
-          continue;
-        }
-
-        /* Search all the sides, the to pin may locate any side!
-         * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
-         * This should be reported to VPR!!!
-         */
-        for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-          /* Try to find the pin in this tile */
-          std::vector<size_t> to_pins = find_physical_tile_pin_id(
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
-            to_tile_port, to_side);
-          /* If nothing found, we can continue */
-          if (0 == to_pins.size()) {
-            continue;
-          }
-
-          /* If from port and to port do not match in sizes, error out */
-          if (from_pins.size() != to_pins.size()) {
-            report_direct_from_port_and_to_port_mismatch(
-              vpr_direct, from_tile_port, to_tile_port);
-            exit(1);
-          }
 
-          /* Now add the tile direct */
-          for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
-            VTR_LOGV(verbose,
-                     "Built a inter-column/row tile-to-tile direct from "
-                     "%s[%lu][%lu].%s[%lu] at side '%s' to "
-                     "%s[%lu][%lu].%s[%lu] at side '%s'\n",
-                     from_tile_name.c_str(), from_grid_coord.x(),
-                     from_grid_coord.y(), from_tile_port.get_name().c_str(),
-                     from_pins[ipin], SIDE_STRING[from_side],
-                     to_tile_name.c_str(), to_grid_coord.x(), to_grid_coord.y(),
-                     to_tile_port.get_name().c_str(), to_pins[ipin],
-                     SIDE_STRING[to_side]);
-
-            TileDirectId tile_direct_id = tile_direct.add_direct(
-              from_grid_coord, from_side, from_pins[ipin], to_grid_coord,
-              to_side, to_pins[ipin]);
-            tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
-          }
-        }
-      }
-    }
-    return; /* Go to next direct type */
+  /* Nothing to build if either tile does not exist in the fabric */
+  auto from_tile_result = tile_type_coords.find(from_tile_name);
+  auto to_tile_result = tile_type_coords.find(to_tile_name);
+  if ((from_tile_result == tile_type_coords.end()) ||
+      (to_tile_result == tile_type_coords.end())) {
+    return;
   }
-
-  /* Reach here, it must be a cross-row connection */
-  VTR_ASSERT(INTER_ROW == arch_direct.type(arch_direct_id));
-  /* For cross-row connection, we will search the first valid grid in each
-   * column from x = 1 to x = nx
-   *
-   *     x=1                    x=nx
-   *   +------+               +------+
-   *   | Grid | <--- ... ---- | Grid |
-   *   +------+               +------+
-   *
-   */
-  for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-    std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-    /* For negative x- direction, we should start from x = nx */
-    for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-    }
-    /* For positive x- direction, we should start from x = 1 */
-    if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(next_col_src_grid_coords.begin(),
-                   next_col_src_grid_coords.end());
+  const TileTypeCoordinates& from_tile_coords = from_tile_result->second;
+  const TileTypeCoordinates& to_tile_coords = to_tile_result->second;
+
+  TilePortPinIds from_tile_pins =
+    build_physical_tile_port_pin_ids(from_tile_coords.type, from_tile_port);
+  TilePortPinIds to_tile_pins =
+    build_physical_tile_port_pin_ids(to_tile_coords.type, to_tile_port);
+
+  /* Each task searches a core column (or a core row) */
+  const DeviceGrid& grids = device_ctx.grid;
+  bool inter_column = (INTER_COLUMN == arch_direct.type(arch_direct_id));
+  size_t line_size = inter_column ? grids.width() : grids.height();
+  size_t num_core_lines = (line_size > 2) ? line_size - 2 : 0;
+  std::vector<std::vector<TileDirectCandidate>> line_candidates(
+    num_core_lines);
+  bool status = run_tile_direct_search_tasks(num_core_lines, [&](size_t iline) {
+    vtr::Point<size_t> from_grid_coord(grids.width(), grids.height());
+    if (true == inter_column) {
+      /* For cross-column connection, we will search the first valid grid in
+       * each column from y = 1 to y = ny
+       *
+       *   +------+
+       *   | Grid |  y=ny
+       *   +------+
+       *      ^
+       *      |  search direction (when y_dir is negative)
+       *     ...
+       *      |
+       *   +------+
+       *   | Grid |  y=1
+       *   +------+
+       *
+       * For negative y- direction, we should start from y = ny
+       */
+      size_t ix = iline + 1;
+      size_t iy = find_core_coordinate_in_line(
+        from_tile_coords.column_ys[ix], grids.height(),
+        NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id));
+      from_grid_coord = vtr::Point<size_t>(ix, iy);
+    } else {
+      /* For cross-row connection, we will search the first valid grid in
+       * each row from x = 1 to x = nx
+       *
+       *     x=1                    x=nx
+       *   +------+               +------+
+       *   | Grid | <--- ... ---- | Grid |
+       *   +------+               +------+
+       *
+       * For positive x- direction, we should start from x = nx
+       */
+      size_t iy = iline + 1;
+      size_t ix = find_core_coordinate_in_line(
+        from_tile_coords.row_xs[iy], grids.width(),
+        POSITIVE_DIR == arch_direct.x_dir(arch_direct_id));
+      from_grid_coord = vtr::Point<size_t>(ix, iy);
     }
-
-    vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-      device_ctx.grid, next_col_src_grid_coords, from_tile_name);
     /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
      * block */
-    if (false ==
-        is_grid_coordinate_exist_in_device(device_ctx.grid, from_grid_coord)) {
-      continue;
+    if (false == is_grid_coordinate_exist_in_device(grids, from_grid_coord)) {
+      return true;
     }
 
-    /* Search all the sides, the from pin may locate any side!
-     * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
-     * This should be reported to VPR!!!
-     */
-    for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-      /* Try to find the pin in this tile */
-      std::vector<size_t> from_pins = find_physical_tile_pin_id(
-        device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].type,
-        device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].width_offset,
-        device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].height_offset,
-        from_tile_port, from_side);
-      /* If nothing found, we can continue */
-      if (0 == from_pins.size()) {
-        continue;
-      }
-
-      /* For a valid coordinate, we can find the coordinate of the destination
-       * clb */
-      vtr::Point<size_t> to_grid_coord =
-        find_inter_direct_destination_coordinate(device_ctx.grid,
-                                                 from_grid_coord, to_tile_name,
-                                                 arch_direct, arch_direct_id);
-      /* If destination clb is valid, we should add something */
-      if (false ==
-          is_grid_coordinate_exist_in_device(device_ctx.grid, to_grid_coord)) {
-        continue;
-      }
-
-      /* Search all the sides, the to pin may locate any side!
-       * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
-       * This should be reported to VPR!!!
-       */
-      for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-        /* Try to find the pin in this tile */
-        std::vector<size_t> to_pins = find_physical_tile_pin_id(
-          device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
-          device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
-          device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
-          to_tile_port, to_side);
-        /* If nothing found, we can continue */
-        if (0 == to_pins.size()) {
-          continue;
-        }
-
-        /* If from port and to port do not match in sizes, error out */
-        if (from_pins.size() != to_pins.size()) {
-          report_direct_from_port_and_to_port_mismatch(
-            vpr_direct, from_tile_port, to_tile_port);
-          exit(1);
-        }
-
-        /* Now add the tile direct */
-        for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
-          VTR_LOGV(verbose,
-                   "Built a inter-column/row tile-to-tile direct from "
-                   "%s[%lu][%lu].%s[%lu] at side '%s' to %s[%lu][%lu].%s[%lu] "
-                   "at side '%s'\n",
-                   from_tile_name.c_str(), from_grid_coord.x(),
-                   from_grid_coord.y(), from_tile_port.get_name().c_str(),
-                   from_pins[ipin], SIDE_STRING[from_side],
-                   to_tile_name.c_str(), to_grid_coord.x(), to_grid_coord.y(),
-                   to_tile_port.get_name().c_str(), to_pins[ipin],
-                   SIDE_STRING[to_side]);
-
-          TileDirectId tile_direct_id =
-            tile_direct.add_direct(from_grid_coord, from_side, from_pins[ipin],
-                                   to_grid_coord, to_side, to_pins[ipin]);
-          tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
-        }
-      }
+    /* For a valid coordinate, we can find the coordinate of the destination
+     * clb */
+    vtr::Point<size_t> to_grid_coord = find_inter_direct_destination_coordinate(
+      grids, to_tile_coords, from_grid_coord, arch_direct, arch_direct_id);
+    /* If destination clb is valid, we should add something */
+    if (false == is_grid_coordinate_exist_in_device(grids, to_grid_coord)) {
+      return true;
     }
+
+    return find_tile_direct_candidates(line_candidates[iline], grids,
+                                       from_grid_coord, from_tile_pins,
+                                       to_grid_coord, to_tile_pins);
+  });
+  if (false == status) {
+    report_direct_from_port_and_to_port_mismatch(vpr_direct, from_tile_port,
+                                                 to_tile_port);
+    exit(1);
   }
+
+  /* Now add the tile direct */
+  add_tile_direct_candidates(tile_direct, line_candidates,
+                             std::string("inter-column/row"), from_tile_name,
+                             from_tile_port, to_tile_name, to_tile_port,
+                             arch_direct_id, verbose);
 }
 
 /***************************************************************************************
@@ -778,6 +805,11 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
 
   TileDirect tile_direct;
 
+  /* Walk through the device grid only once, the coordinates of tile types
+   * are shared by all the direct definitions */
+  TileTypeCoordinateLookup tile_type_coords =
+    build_tile_type_coordinate_lookup(device_ctx.grid);
+
   /* Walk through each direct definition in the VPR arch */
   for (int idirect = 0; idirect < device_ctx.arch->num_directs; ++idirect) {
     ArchDirectId arch_direct_id =
@@ -790,13 +822,13 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
       exit(1);
     }
     /* Build from original VPR arch definition */
-    build_inner_column_row_tile_direct(tile_direct,
-                                       device_ctx.arch->Directs[idirect],
-                                       device_ctx, arch_direct_id, verbose);
+    build_inner_column_row_tile_direct(
+      tile_direct, device_ctx.arch->Directs[idirect], device_ctx,
+      tile_type_coords, arch_direct_id, verbose);
     /* Build from OpenFPGA arch definition */
     build_inter_column_row_tile_direct(
-      tile_direct, device_ctx.arch->Directs[idirect], device_ctx, arch_direct,
-      arch_direct_id, verbose);
+      tile_direct, device_ctx.arch->Directs[idirect], device_ctx,
+      tile_type_coords, arch_direct, arch_direct_id, verbose);
   }
 
   VTR_LOG(
@@ -6,6 +6,7 @@
  ***********************************************************************/
 
 #include <algorithm>
+#include <set>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -33,7 +34,7 @@ size_t find_fabric_regional_bitstream_max_size(
   for (const auto& region : fabric_bitstream.regions()) {
     if (!region_whitelist.empty() &&
         (std::find(region_whitelist.begin(), region_whitelist.end(),
-                   size_t(region)) != region_whitelist.end())) {
+                   size_t(region)) == region_whitelist.end())) {
       continue;
     }
     if (regional_bitstream_max_size <
@@ -65,7 +66,7 @@ size_t find_configuration_chain_fabric_bitstream_size_to_be_skipped(
   for (const auto& region : fabric_bitstream.regions()) {
     if (!region_whitelist.empty() &&
         (std::find(region_whitelist.begin(), region_whitelist.end(),
-                   size_t(region)) != region_whitelist.end())) {
+                   size_t(region)) == region_whitelist.end())) {
       continue;
     }
     size_t curr_region_num_bits_to_skip = 0;
@@ -87,6 +88,53 @@ size_t find_configuration_chain_fabric_bitstream_size_to_be_skipped(
   return num_bits_to_skip;
 }
 
+/********************************************************************
+ * Find the number of bits to be loaded by each programming clock of a
+ * configuration chain. Each programming clock only needs to shift the
+ * longest bitstream among the regions it drives, i.e., the last bits of the
+ * aligned bitstream. For example:
+ *   Region 0 (CK[0]): 000000001111101010
+ *   Region 1 (CK[1]):     00000011010101 <- CK[1] shifts 14 bits
+ * For fast configuration, the leading bits to be skipped are excluded, which
+ * depend only on the regions driven by the programming clock
+ *******************************************************************/
+std::vector<size_t> find_configuration_chain_prog_clock_bitstream_sizes(
+  const FabricBitstream& fabric_bitstream,
+  const BitstreamManager& bitstream_manager,
+  const ConfigProtocol& config_protocol, const bool& fast_configuration,
+  const bool& bit_value_to_skip) {
+  std::vector<size_t> prog_clock_bitstream_sizes;
+  if (1 == config_protocol.num_prog_clocks()) {
+    size_t num_bits_to_skip = 0;
+    if (true == fast_configuration) {
+      num_bits_to_skip =
+        find_configuration_chain_fabric_bitstream_size_to_be_skipped(
+          fabric_bitstream, bitstream_manager, bit_value_to_skip);
+    }
+    prog_clock_bitstream_sizes.push_back(
+      find_fabric_regional_bitstream_max_size(fabric_bitstream) -
+      num_bits_to_skip);
+    return prog_clock_bitstream_sizes;
+  }
+
+  for (const BasicPort& prog_clock_pin : config_protocol.prog_clock_pins()) {
+    std::vector<size_t> ccff_head_indices =
+      config_protocol.prog_clock_pin_ccff_head_indices(prog_clock_pin);
+    size_t num_bits_to_skip = 0;
+    if (true == fast_configuration) {
+      num_bits_to_skip =
+        find_configuration_chain_fabric_bitstream_size_to_be_skipped(
+          fabric_bitstream, bitstream_manager, bit_value_to_skip,
+          ccff_head_indices);
+    }
+    prog_clock_bitstream_sizes.push_back(
+      find_fabric_regional_bitstream_max_size(fabric_bitstream,
+                                              ccff_head_indices) -
+      num_bits_to_skip);
+  }
+  return prog_clock_bitstream_sizes;
+}
+
 /********************************************************************
  * Build a fabric bitstream which can be directly loaded to a configuration
  * chain (either single-head or multi-bit)
@@ -129,6 +177,45 @@ ConfigChainFabricBitstream build_config_chain_fabric_bitstream_by_region(
   return regional_bitstreams;
 }
 
+/********************************************************************
+ * Encode the regional bitstreams of a configuration chain into
+ * run-length tokens. Note that the regional bitstreams are aligned in the same
+ * way as build_config_chain_fabric_bitstream_by_region(), so that the
+ * expanded bitstream is the same as the plain one
+ *******************************************************************/
+ConfigChainRleFabricBitstream build_config_chain_rle_fabric_bitstream_by_region(
+  const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream, const size_t& count_size,
+  const size_t& num_bits_to_skip) {
+  VTR_ASSERT(0 < count_size);
+  /* A token covers at most 2^K bits */
+  size_t max_count = (size_t(1) << count_size) - 1;
+
+  ConfigChainFabricBitstream regional_bitstreams =
+    build_config_chain_fabric_bitstream_by_region(bitstream_manager,
+                                                  fabric_bitstream);
+
+  ConfigChainRleFabricBitstream regional_tokens;
+  regional_tokens.reserve(regional_bitstreams.size());
+  for (const std::vector<bool>& region_bitstream : regional_bitstreams) {
+    std::vector<ConfigChainRleToken> curr_tokens;
+    for (size_t ibit = num_bits_to_skip; ibit < region_bitstream.size();
+         ++ibit) {
+      /* Extend the last token if the value is the same and the count is not
+       * saturated. Otherwise, start a new token */
+      if (!curr_tokens.empty() &&
+          (curr_tokens.back().value == region_bitstream[ibit]) &&
+          (curr_tokens.back().count < max_count)) {
+        curr_tokens.back().count++;
+        continue;
+      }
+      curr_tokens.push_back({region_bitstream[ibit], 0});
+    }
+    regional_tokens.push_back(curr_tokens);
+  }
+  return regional_tokens;
+}
+
 /********************************************************************
  * Reorganize the fabric bitstream for frame-based protocol
  * by the same address across regions:
@@ -213,6 +300,132 @@ size_t find_frame_based_fast_configuration_fabric_bitstream_size(
   return num_bits;
 }
 
+/********************************************************************
+ * Reorganize the fabric bitstream for frame-based protocol with address mask
+ * The last M bits of the address (M is the size of address mask) belong to
+ * the top-level decoders of configuration regions. However, the top-level
+ * decoder of a region may be narrower than M: it only takes the MSBs of the
+ * address mask, while its other address bits are decoded by the child
+ * modules without any mask. A region with a single child is even short-wired
+ * and ignores the mask. Therefore, only the last N bits of address are
+ * masked, where N is the smallest width of the top-level decoders among
+ * regions. Masking these bits broadcasts the data input to several frames in
+ * the same cycle in every region, while the rest of address bits are applied
+ * to each frame as usual.
+ *
+ * Frames are grouped by the address bits outside the mask and by the data
+ * input. Inside each group, the codes of masked bits are covered by cubes in
+ *a greedy way: starting from the smallest uncovered code, the cube is expanded
+ *bit by bit as long as all the codes in the expanded cube belong to the group
+ *and are not yet covered. As a result, each cube writes exactly the frames
+ *which would be written one by one without address mask.
+ *******************************************************************/
+FrameMulticastFabricBitstream build_frame_based_multicast_fabric_bitstream(
+  const FabricBitstream& fabric_bitstream, const bool& fast_configuration,
+  const bool& bit_value_to_skip) {
+  FrameFabricBitstream fabric_bits_by_addr =
+    build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+
+  size_t mask_size = fabric_bitstream.address_mask_length();
+  VTR_ASSERT(0 < mask_size && mask_size < 8 * sizeof(size_t));
+
+  /* Only the address mask bits reaching the top-level decoders of all the
+   * regions can be masked */
+  size_t num_mask_bits = mask_size;
+  for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
+    num_mask_bits = std::min(
+      num_mask_bits, fabric_bitstream.region_address_mask_length(region));
+  }
+
+  /* Group the codes of masked bits by the rest of address and data input */
+  std::map<std::pair<std::string, std::vector<bool>>, std::set<size_t>>
+    grouped_codes;
+  for (const auto& addr_din_pair : fabric_bits_by_addr) {
+    /* Skip the frames which are not required by fast configuration */
+    if ((true == fast_configuration) &&
+        (addr_din_pair.second ==
+         std::vector<bool>(addr_din_pair.second.size(), bit_value_to_skip))) {
+      continue;
+    }
+    const std::string& addr_str = addr_din_pair.first;
+    VTR_ASSERT(mask_size <= addr_str.size());
+    size_t local_addr_size = addr_str.size() - num_mask_bits;
+    size_t code = 0;
+    for (size_t ibit = 0; ibit < num_mask_bits; ++ibit) {
+      if ('1' == addr_str[local_addr_size + ibit]) {
+        code |= (size_t(1) << ibit);
+      }
+    }
+    grouped_codes[std::make_pair(addr_str.substr(0, local_addr_size),
+                                 addr_din_pair.second)]
+      .insert(code);
+  }
+
+  FrameMulticastFabricBitstream fabric_words;
+  for (const auto& group : grouped_codes) {
+    const std::set<size_t>& codes = group.second;
+    std::set<size_t> covered_codes;
+    /* Codes are visited in ascending order, so the masked bits of the base
+     * code are always zero */
+    for (const size_t& base_code : codes) {
+      if (0 < covered_codes.count(base_code)) {
+        continue;
+      }
+      size_t mask = 0;
+      for (size_t ibit = 0; ibit < num_mask_bits; ++ibit) {
+        size_t bit = size_t(1) << ibit;
+        if (0 != (base_code & bit)) {
+          continue;
+        }
+        /* Only the new half of the cube has to be checked, i.e., the codes
+         * with the current bit set */
+        bool expandable = true;
+        size_t sub_mask = mask;
+        while (true) {
+          size_t curr_code = base_code | bit | sub_mask;
+          if ((0 == codes.count(curr_code)) ||
+              (0 < covered_codes.count(curr_code))) {
+            expandable = false;
+            break;
+          }
+          if (0 == sub_mask) {
+            break;
+          }
+          sub_mask = (sub_mask - 1) & mask;
+        }
+        if (true == expandable) {
+          mask |= bit;
+        }
+      }
+      /* Mark all the codes in the cube as covered */
+      size_t sub_mask = mask;
+      while (true) {
+        covered_codes.insert(base_code | sub_mask);
+        if (0 == sub_mask) {
+          break;
+        }
+        sub_mask = (sub_mask - 1) & mask;
+      }
+
+      FrameMulticastFabricWord word;
+      word.address = group.first.first;
+      /* The address mask bits outside the last N bits are never set */
+      word.address_mask = std::string(mask_size, '0');
+      for (size_t ibit = 0; ibit < num_mask_bits; ++ibit) {
+        size_t bit = size_t(1) << ibit;
+        word.address.push_back(0 != (base_code & bit) ? '1' : '0');
+        if (0 != (mask & bit)) {
+          word.address_mask[mask_size - num_mask_bits + ibit] = '1';
+        }
+      }
+      word.din = group.first.second;
+      fabric_words.push_back(word);
+    }
+  }
+
+  return fabric_words;
+}
+
 /********************************************************************
  * Reorganize the fabric bitstream for memory banks which use BL and WL decoders
  * by the same address across regions:
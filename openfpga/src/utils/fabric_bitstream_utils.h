@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "bitstream_manager.h"
+#include "config_protocol.h"
 #include "fabric_bitstream.h"
 #include "memory_bank_flatten_fabric_bitstream.h"
 #include "memory_bank_shift_register_banks.h"
@@ -33,6 +34,12 @@ size_t find_configuration_chain_fabric_bitstream_size_to_be_skipped(
   const BitstreamManager& bitstream_manager, const bool& bit_value_to_skip,
   const std::vector<size_t>& region_whitelist = std::vector<size_t>{});
 
+std::vector<size_t> find_configuration_chain_prog_clock_bitstream_sizes(
+  const FabricBitstream& fabric_bitstream,
+  const BitstreamManager& bitstream_manager,
+  const ConfigProtocol& config_protocol, const bool& fast_configuration,
+  const bool& bit_value_to_skip);
+
 /* Alias to a specific organization of bitstreams for frame-based configuration
  * protocol */
 typedef std::vector<std::vector<bool>> ConfigChainFabricBitstream;
@@ -40,6 +47,35 @@ ConfigChainFabricBitstream build_config_chain_fabric_bitstream_by_region(
   const BitstreamManager& bitstream_manager,
   const FabricBitstream& fabric_bitstream);
 
+/* A token of run-length encoded configuration chain bitstream, which is
+ * expanded to (count + 1) bits of the same value */
+struct ConfigChainRleToken {
+  bool value;
+  size_t count;
+};
+typedef std::vector<std::vector<ConfigChainRleToken>>
+  ConfigChainRleFabricBitstream;
+
+/********************************************************************
+ * @brief Encode the aligned bitstream of each configuration region into
+ *tokens, each of which represents a run of identical bits. A run whose length
+ *exceeds the maximum count is split into multiple tokens. The first bits to be
+ *skipped (fast configuration) are excluded
+ *
+ * Quick Example (2-bit count)
+ *   Region 0: 0000011
+ *
+ *   the bitstream will be encoded as
+ *   <value> <count>
+ *   0 3
+ *   0 0
+ *   1 1
+ *******************************************************************/
+ConfigChainRleFabricBitstream build_config_chain_rle_fabric_bitstream_by_region(
+  const BitstreamManager& bitstream_manager,
+  const FabricBitstream& fabric_bitstream, const size_t& count_size,
+  const size_t& num_bits_to_skip);
+
 /* Alias to a specific organization of bitstreams for frame-based configuration
  * protocol */
 typedef std::map<std::string, std::vector<bool>> FrameFabricBitstream;
@@ -49,6 +85,38 @@ FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(
 size_t find_frame_based_fast_configuration_fabric_bitstream_size(
   const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip);
 
+/* A word of frame-based bitstream which is broadcast to all the addresses
+ * matching the address on the bits which are not masked */
+struct FrameMulticastFabricWord {
+  std::string address;
+  std::string address_mask;
+  std::vector<bool> din;
+};
+typedef std::vector<FrameMulticastFabricWord> FrameMulticastFabricBitstream;
+
+/********************************************************************
+ * @brief Reorganize the fabric bitstream for frame-based protocol whose
+ *top-level decoders accept an address mask. Frames which share the same data
+ *inputs and differ only on the address bits of top-level decoders are merged
+ *into a single word with address mask. Only the address bits decoded by the
+ *top-level decoders of all the regions are masked, so that a word is written
+ *to the same frames in every region
+ *
+ * Quick Example (mask covers the last 2 bits of address)
+ *   <address> <data input>
+ *   0100 1
+ *   0101 1
+ *   0110 1
+ *   0111 1
+ *
+ *   the bitstream will be merged as
+ *   <address> <address mask> <data input>
+ *   0100 11 1
+ *******************************************************************/
+FrameMulticastFabricBitstream build_frame_based_multicast_fabric_bitstream(
+  const FabricBitstream& fabric_bitstream, const bool& fast_configuration,
+  const bool& bit_value_to_skip);
+
 /********************************************************************
  * @ brief Reorganize the fabric bitstream for memory banks which use flatten BL
  *and WLs For each configuration region, we will merge BL address (which are
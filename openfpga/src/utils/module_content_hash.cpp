@@ -0,0 +1,97 @@
+/******************************************************************************
+ * This files includes the functions which hash the content of modules.
+ * The hash of a module covers everything that a netlist writer reads to
+ * print the module: its ports, its child instances together with the ports
+ * of the child modules, and its nets. The internals of child modules are not
+ * covered, as they are printed in their own netlists.
+ * Modules are referred to by names rather than ids, so that the hash does
+ * not change when other modules are added or removed.
+ ******************************************************************************/
+#include "module_content_hash.h"
+
+#include <map>
+
+/* Headers from openfpgautil library */
+#include "openfpga_hash.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+static void add_module_ports_to_hash(StableHash& hash,
+                                     const ModuleManager& module_manager,
+                                     const ModuleId& module) {
+  hash.add_integer(module_manager.module_ports(module).size());
+  for (const ModulePortId& port : module_manager.module_ports(module)) {
+    BasicPort port_info = module_manager.module_port(module, port);
+    hash.add_string(port_info.get_name());
+    hash.add_integer(port_info.get_lsb());
+    hash.add_integer(port_info.get_msb());
+    hash.add_integer(module_manager.port_type(module, port));
+    hash.add_integer(module_manager.port_is_wire(module, port));
+    hash.add_integer(module_manager.port_is_register(module, port));
+    hash.add_integer(module_manager.port_is_mappable_io(module, port));
+    hash.add_string(module_manager.port_preproc_flag(module, port));
+  }
+}
+
+/******************************************************************************
+ * Compute the hash of the content of a module as a hexadecimal string
+ ******************************************************************************/
+std::string compute_module_content_hash(const ModuleManager& module_manager,
+                                        const ModuleId& module) {
+  StableHash hash;
+  hash.add_string(module_manager.module_name(module));
+  hash.add_integer(module_manager.module_usage(module));
+  add_module_ports_to_hash(hash, module_manager, module);
+
+  /* Nets refer to the module itself or its children by local indices */
+  std::map<ModuleId, size_t> local_module_indices;
+  local_module_indices[module] = 0;
+  std::vector<ModuleId> child_modules = module_manager.child_modules(module);
+  hash.add_integer(child_modules.size());
+  for (const ModuleId& child : child_modules) {
+    size_t local_index = local_module_indices.size();
+    local_module_indices[child] = local_index;
+    hash.add_string(module_manager.module_name(child));
+    add_module_ports_to_hash(hash, module_manager, child);
+    std::vector<size_t> instances =
+      module_manager.child_module_instances(module, child);
+    hash.add_integer(instances.size());
+    for (const size_t& instance : instances) {
+      hash.add_string(module_manager.instance_name(module, child, instance));
+    }
+  }
+
+  hash.add_integer(module_manager.num_nets(module));
+  for (const ModuleNetId& net : module_manager.module_nets(module)) {
+    hash.add_string(module_manager.net_name(module, net));
+    auto src_modules = module_manager.net_source_modules(module, net);
+    auto src_instances = module_manager.net_source_instances(module, net);
+    auto src_ports = module_manager.net_source_ports(module, net);
+    auto src_pins = module_manager.net_source_pins(module, net);
+    hash.add_integer(src_modules.size());
+    for (const ModuleNetSrcId& src : module_manager.module_net_sources(module,
+                                                                      net)) {
+      hash.add_integer(local_module_indices.at(src_modules[src]));
+      hash.add_integer(src_instances[src]);
+      hash.add_integer(size_t(src_ports[src]));
+      hash.add_integer(src_pins[src]);
+    }
+    auto sink_modules = module_manager.net_sink_modules(module, net);
+    auto sink_instances = module_manager.net_sink_instances(module, net);
+    auto sink_ports = module_manager.net_sink_ports(module, net);
+    auto sink_pins = module_manager.net_sink_pins(module, net);
+    hash.add_integer(sink_modules.size());
+    for (const ModuleNetSinkId& sink :
+         module_manager.module_net_sinks(module, net)) {
+      hash.add_integer(local_module_indices.at(sink_modules[sink]));
+      hash.add_integer(sink_instances[sink]);
+      hash.add_integer(size_t(sink_ports[sink]));
+      hash.add_integer(sink_pins[sink]);
+    }
+  }
+
+  return hash.to_string();
+}
+
+} /* end namespace openfpga */
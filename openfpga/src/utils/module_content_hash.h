@@ -0,0 +1,27 @@
+/******************************************************************************
+ * This files includes declarations for the functions which hash the content
+ * of modules, in order to detect the modules changed between runs
+ ******************************************************************************/
+#ifndef MODULE_CONTENT_HASH_H
+#define MODULE_CONTENT_HASH_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "module_manager.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+std::string compute_module_content_hash(const ModuleManager& module_manager,
+                                        const ModuleId& module);
+
+} /* end namespace openfpga */
+
+#endif
@@ -86,15 +86,7 @@ void reserve_module_manager_module_nets(ModuleManager& module_manager,
  ******************************************************************************/
 size_t count_module_manager_module_configurable_children(
   const ModuleManager& module_manager, const ModuleId& module) {
-  size_t num_config_children = 0;
-
-  for (const ModuleId& child : module_manager.configurable_children(module)) {
-    if (0 != module_manager.configurable_children(child).size()) {
-      num_config_children++;
-    }
-  }
-
-  return num_config_children;
+  return module_manager.num_configurable_block_children(module);
 }
 
 /******************************************************************************
@@ -2399,9 +2391,9 @@ size_t find_module_num_config_bits_from_child_modules(
       /* If there are more than 2 configurable children, we need a decoder
        * Otherwise, we can just short wire the address port to the children
        */
-      if (1 < module_manager.configurable_children(module_id).size()) {
+      if (1 < module_manager.num_configurable_children(module_id)) {
         num_config_bits += find_mux_local_decoder_addr_size(
-          module_manager.configurable_children(module_id).size());
+          module_manager.num_configurable_children(module_id));
       }
 
       break;
@@ -5,6 +5,8 @@
 /* Headers from vtrutil library */
 #include "pb_graph_utils.h"
 
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -100,4 +102,51 @@ bool is_pb_graph_pins_share_interc(const t_pb_graph_pin* pinA,
   return false;
 }
 
+/********************************************************************
+ * Count the inputs of each interconnect which drives a group of pins,
+ * e.g., the input pins of a pb_graph node, in a single pass over the
+ * input edges of the pins.
+ * The interconnects found are appended to interc_num_inputs in the order
+ * of first appearance. For each pin, the inputs of an interconnect are
+ * counted once even if they appear in several edges.
+ * The pin_inputs is a scratch buffer, which is reused across pins to
+ * avoid allocation
+ *******************************************************************/
+void count_pb_graph_pins_interconnect_num_inputs(
+  t_pb_graph_pin** pins, const int& num_ports, const int* num_pins,
+  std::vector<InterconnectNumInputs>& interc_num_inputs,
+  std::vector<std::pair<size_t, t_pb_graph_pin*>>& pin_inputs) {
+  for (int iport = 0; iport < num_ports; ++iport) {
+    for (int ipin = 0; ipin < num_pins[iport]; ++ipin) {
+      const t_pb_graph_pin& pin = pins[iport][ipin];
+      pin_inputs.clear();
+      for (int iedge = 0; iedge < pin.num_input_edges; ++iedge) {
+        t_interconnect* interc = pin.input_edges[iedge]->interconnect;
+        VTR_ASSERT(nullptr != interc);
+        /* There are only a few interconnects at each node, so a linear
+         * search is faster than any associative container */
+        size_t interc_index = 0;
+        while (interc_index < interc_num_inputs.size() &&
+               interc_num_inputs[interc_index].first != interc) {
+          ++interc_index;
+        }
+        if (interc_index == interc_num_inputs.size()) {
+          interc_num_inputs.push_back(std::make_pair(interc, 0));
+        }
+        for (int jpin = 0; jpin < pin.input_edges[iedge]->num_input_pins;
+             ++jpin) {
+          pin_inputs.push_back(std::make_pair(
+            interc_index, pin.input_edges[iedge]->input_pins[jpin]));
+        }
+      }
+      /* Ensure that each input pin is counted once per interconnect */
+      std::sort(pin_inputs.begin(), pin_inputs.end());
+      auto last = std::unique(pin_inputs.begin(), pin_inputs.end());
+      for (auto it = pin_inputs.begin(); it != last; ++it) {
+        interc_num_inputs[it->first].second++;
+      }
+    }
+  }
+}
+
 } /* end namespace openfpga */
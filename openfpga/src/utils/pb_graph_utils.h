@@ -5,6 +5,7 @@
  * Include header files that are required by function declaration
  *******************************************************************/
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "physical_types.h"
@@ -25,6 +26,14 @@ t_interconnect* pb_graph_pin_interc(t_pb_graph_pin* pb_graph_pin,
 bool is_pb_graph_pins_share_interc(const t_pb_graph_pin* pinA,
                                    const t_pb_graph_pin* pinB);
 
+/* The total number of inputs of an interconnect at a pb_graph node */
+typedef std::pair<t_interconnect*, size_t> InterconnectNumInputs;
+
+void count_pb_graph_pins_interconnect_num_inputs(
+  t_pb_graph_pin** pins, const int& num_ports, const int* num_pins,
+  std::vector<InterconnectNumInputs>& interc_num_inputs,
+  std::vector<std::pair<size_t, t_pb_graph_pin*>>& pin_inputs);
+
 } /* end namespace openfpga */
 
 #endif
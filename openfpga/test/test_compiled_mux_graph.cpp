@@ -0,0 +1,167 @@
+/********************************************************************
+ * Unit test of the compiled multiplexer graph
+ * For tree-like, one-level and multi-level multiplexers of various sizes,
+ * with and without a constant input, check that the compiled graph
+ * 1. has the same number of inputs, outputs, levels and memory bits
+ * 2. stores the same memory bits level by level
+ * 3. decodes each input to the same memory bits as
+ *    MuxGraph::decode_memory_bits()
+ *******************************************************************/
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from libarchopenfpga */
+#include "circuit_library.h"
+
+/* Headers from openfpga */
+#include "compiled_mux_graph.h"
+#include "mux_graph.h"
+
+/* Add a CMOS multiplexer model with a given structure to the library */
+static CircuitModelId add_mux_model(
+  CircuitLibrary& circuit_lib, const std::string& name,
+  const e_circuit_model_structure& structure, const size_t& num_levels,
+  const bool& add_const_input) {
+  CircuitModelId mux_model = circuit_lib.add_model(CIRCUIT_MODEL_MUX);
+  circuit_lib.set_model_name(mux_model, name);
+  circuit_lib.set_model_design_tech_type(mux_model, CIRCUIT_MODEL_DESIGN_CMOS);
+  circuit_lib.set_model_pass_gate_logic(mux_model, std::string("pass_gate"));
+  circuit_lib.set_mux_structure(mux_model, structure);
+  if (CIRCUIT_MODEL_STRUCTURE_MULTILEVEL == structure) {
+    circuit_lib.set_mux_num_levels(mux_model, num_levels);
+  }
+  if (true == add_const_input) {
+    circuit_lib.set_mux_const_input_value(mux_model, 0);
+  }
+  return mux_model;
+}
+
+/* Compare a compiled graph with the graph which it is compiled from.
+ * Return the number of mismatches */
+static size_t test_compiled_mux_graph(const CircuitLibrary& circuit_lib,
+                                      const CircuitModelId& mux_model,
+                                      const size_t& mux_size) {
+  openfpga::MuxGraph mux_graph(circuit_lib, mux_model, mux_size);
+  openfpga::CompiledMuxGraph compiled_mux_graph(mux_graph);
+  std::string mux_name = circuit_lib.model_name(mux_model) +
+                         std::string("_size") + std::to_string(mux_size);
+
+  if ((mux_graph.num_inputs() != compiled_mux_graph.num_inputs()) ||
+      (mux_graph.num_outputs() != compiled_mux_graph.num_outputs()) ||
+      (mux_graph.num_levels() != compiled_mux_graph.num_levels()) ||
+      (mux_graph.num_memory_bits() != compiled_mux_graph.num_memory_bits())) {
+    VTR_LOG_ERROR("Sizes of compiled '%s' differ from its graph\n",
+                  mux_name.c_str());
+    return 1;
+  }
+
+  size_t num_err = 0;
+  for (const size_t& level : mux_graph.levels()) {
+    std::vector<openfpga::MuxMemId> mems = mux_graph.memories_at_level(level);
+    if (mems.size() != compiled_mux_graph.num_memory_bits_at_level(level)) {
+      VTR_LOG_ERROR("Number of memory bits of compiled '%s' at level %lu "
+                    "differs from its graph\n",
+                    mux_name.c_str(), level);
+      num_err++;
+      continue;
+    }
+    for (size_t imem = 0; imem < mems.size(); ++imem) {
+      if (mems[imem] != compiled_mux_graph.memory_at_level(level, imem)) {
+        VTR_LOG_ERROR("Memory bit %lu of compiled '%s' at level %lu differs "
+                      "from its graph\n",
+                      imem, mux_name.c_str(), level);
+        num_err++;
+      }
+    }
+  }
+
+  for (size_t iout = 0; iout < mux_graph.num_outputs(); ++iout) {
+    for (size_t iin = 0; iin < mux_graph.num_inputs(); ++iin) {
+      openfpga::MuxInputId input_id(iin);
+      openfpga::MuxOutputId output_id(iout);
+      if (false == compiled_mux_graph.is_routable(input_id, output_id)) {
+        VTR_LOG_ERROR("Input %lu of compiled '%s' is not routable to output "
+                      "%lu\n",
+                      iin, mux_name.c_str(), iout);
+        num_err++;
+        continue;
+      }
+      vtr::vector<openfpga::MuxMemId, bool> ref_bits =
+        mux_graph.decode_memory_bits(input_id, output_id);
+      const std::vector<bool>& bits =
+        compiled_mux_graph.decode_memory_bits(input_id, output_id);
+      bool same_bits = (ref_bits.size() == bits.size());
+      for (size_t ibit = 0; same_bits && ibit < bits.size(); ++ibit) {
+        same_bits = (ref_bits[openfpga::MuxMemId(ibit)] == bits[ibit]);
+      }
+      if (false == same_bits) {
+        VTR_LOG_ERROR("Memory bits of compiled '%s' from input %lu to output "
+                      "%lu differ from its graph\n",
+                      mux_name.c_str(), iin, iout);
+        num_err++;
+      }
+    }
+  }
+
+  return num_err;
+}
+
+int main(int argc, const char** argv) {
+  /* No argument is required */
+  VTR_ASSERT(1 == argc);
+  (void)argv;
+
+  CircuitLibrary circuit_lib;
+  CircuitModelId pass_gate_model =
+    circuit_lib.add_model(CIRCUIT_MODEL_PASSGATE);
+  circuit_lib.set_model_name(pass_gate_model, std::string("pass_gate"));
+  circuit_lib.set_model_design_tech_type(pass_gate_model,
+                                         CIRCUIT_MODEL_DESIGN_CMOS);
+
+  /* Multiplexer models with the smallest size to test. Note that a 3-level
+   * multiplexer cannot be built when its branches cannot be filled, which
+   * is the case for some sizes below 10 */
+  std::vector<std::pair<CircuitModelId, size_t>> mux_models;
+  for (const bool& add_const_input : {false, true}) {
+    std::string postfix = add_const_input ? "_const" : "";
+    mux_models.push_back(std::make_pair(
+      add_mux_model(circuit_lib, std::string("mux_tree") + postfix,
+                    CIRCUIT_MODEL_STRUCTURE_TREE, 0, add_const_input),
+      2));
+    mux_models.push_back(std::make_pair(
+      add_mux_model(circuit_lib, std::string("mux_onelevel") + postfix,
+                    CIRCUIT_MODEL_STRUCTURE_ONELEVEL, 0, add_const_input),
+      2));
+    mux_models.push_back(std::make_pair(
+      add_mux_model(circuit_lib, std::string("mux_2level") + postfix,
+                    CIRCUIT_MODEL_STRUCTURE_MULTILEVEL, 2, add_const_input),
+      2));
+    mux_models.push_back(std::make_pair(
+      add_mux_model(circuit_lib, std::string("mux_3level") + postfix,
+                    CIRCUIT_MODEL_STRUCTURE_MULTILEVEL, 3, add_const_input),
+      10));
+  }
+  circuit_lib.build_model_links();
+
+  size_t num_err = 0;
+  size_t num_muxes = 0;
+  for (const auto& mux_model : mux_models) {
+    for (size_t mux_size = mux_model.second; mux_size <= 64; ++mux_size) {
+      num_err +=
+        test_compiled_mux_graph(circuit_lib, mux_model.first, mux_size);
+      num_muxes++;
+    }
+  }
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors in %lu multiplexers\n", num_err, num_muxes);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests on %lu multiplexers\n", num_muxes);
+  return 0;
+}
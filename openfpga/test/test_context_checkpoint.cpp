@@ -0,0 +1,99 @@
+/********************************************************************
+ * Unit test of the context checkpoint
+ * Build a small routing resource graph with a routing annotation, write a
+ * checkpoint, clear the annotation and restore it from the checkpoint. Then
+ * check that
+ * 1. the checkpoint is accepted for the same VPR contexts
+ * 2. the previous node of each rr_node is restored
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from vpr */
+#include "vpr_context.h"
+
+/* Headers from openfpga */
+#include "command_exit_codes.h"
+#include "openfpga_context_checkpoint.h"
+
+/* Create a chain of routing tracks, where each node drives the next one */
+static std::vector<RRNodeId> build_test_rr_graph(DeviceContext& device_ctx,
+                                                 const size_t& num_nodes) {
+  std::vector<RRNodeId> nodes;
+  for (size_t inode = 0; inode < num_nodes; ++inode) {
+    nodes.push_back(
+      device_ctx.rr_graph_builder.create_node(inode + 1, 1, CHANX, 0));
+  }
+  for (size_t inode = 1; inode < num_nodes; ++inode) {
+    device_ctx.rr_graph_builder.create_edge(nodes[inode - 1], nodes[inode],
+                                            RRSwitchId(0));
+  }
+  device_ctx.rr_graph_builder.build_edges(true);
+  return nodes;
+}
+
+int main(int argc, const char** argv) {
+  /* No argument is required */
+  VTR_ASSERT(1 == argc);
+  (void)argv;
+
+  DeviceContext device_ctx;
+  AtomContext atom_ctx;
+  ClusteringContext clustering_ctx;
+  PlacementContext placement_ctx;
+  RoutingContext routing_ctx;
+  std::vector<RRNodeId> nodes = build_test_rr_graph(device_ctx, 5);
+
+  openfpga::VprDeviceAnnotation device_annotation;
+  openfpga::VprClusteringAnnotation clustering_annotation;
+  openfpga::VprRoutingAnnotation routing_annotation;
+  openfpga::VprBitstreamAnnotation bitstream_annotation;
+  routing_annotation.init(device_ctx.rr_graph);
+  for (size_t inode = 1; inode < nodes.size(); ++inode) {
+    routing_annotation.set_rr_node_prev_node(device_ctx.rr_graph, nodes[inode],
+                                             nodes[inode - 1]);
+  }
+
+  std::string fname("test_context_checkpoint.ckpt");
+  size_t num_err = 0;
+  if (CMD_EXEC_SUCCESS !=
+      openfpga::write_context_checkpoint(
+        fname, device_ctx, atom_ctx, clustering_ctx, placement_ctx,
+        routing_ctx, device_annotation, clustering_annotation,
+        routing_annotation, bitstream_annotation, false)) {
+    VTR_LOG_ERROR("Failed to write checkpoint '%s'\n", fname.c_str());
+    num_err++;
+  }
+
+  /* The checkpoint must be restored to a cleared annotation */
+  openfpga::VprRoutingAnnotation restored_routing_annotation;
+  restored_routing_annotation.init(device_ctx.rr_graph);
+  if (CMD_EXEC_SUCCESS !=
+      openfpga::read_context_checkpoint(
+        fname, device_ctx, atom_ctx, clustering_ctx, placement_ctx,
+        routing_ctx, device_annotation, clustering_annotation,
+        restored_routing_annotation, bitstream_annotation, false)) {
+    VTR_LOG_ERROR("Failed to restore checkpoint '%s'\n", fname.c_str());
+    num_err++;
+  }
+
+  for (const RRNodeId& node : nodes) {
+    if (routing_annotation.rr_node_prev_node(node) !=
+        restored_routing_annotation.rr_node_prev_node(node)) {
+      VTR_LOG_ERROR("Previous node of rr_node %lu is not restored\n",
+                    size_t(node));
+      num_err++;
+    }
+  }
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors\n", num_err);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests\n");
+  return 0;
+}
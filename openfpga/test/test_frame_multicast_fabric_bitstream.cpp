@@ -0,0 +1,180 @@
+/********************************************************************
+ * Unit test of the frame-based fabric bitstream with address mask
+ * Build small fabric bitstreams whose configuration regions have top-level
+ * decoders of equal widths, of unequal widths, or are short-wired. Then
+ * emulate how the decoders of each region apply the multicast words, and
+ * check that
+ * 1. each frame is written only with its own data input
+ * 2. each frame is written unless it is skipped by fast configuration
+ *******************************************************************/
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpga */
+#include "fabric_bitstream.h"
+#include "fabric_bitstream_utils.h"
+
+/* A fabric bitstream and the data inputs expected by each frame of each
+ * region, where a frame is indexed by its address */
+struct TestFabricBitstream {
+  openfpga::FabricBitstream fabric_bitstream;
+  std::vector<std::map<std::string, bool>> region_frames;
+};
+
+/* Create a fabric bitstream with an address size and a top-level decoder
+ * width for each region. The top-level decoder of a region takes the last
+ * bits of address, while the rest of address bits, including the ones under
+ * the address mask but not wired to a narrower decoder, are decoded by the
+ * child modules. A zero width represents a short-wired region. All the frames
+ * of each region are configured, and the data input of each frame mostly
+ * depends on the address of child modules, so that there are enough
+ * identical frames to be merged */
+static TestFabricBitstream build_test_fabric_bitstream(
+  const size_t& addr_size, const size_t& mask_size,
+  const std::vector<size_t>& decoder_sizes) {
+  TestFabricBitstream test_bitstream;
+  openfpga::FabricBitstream& fabric_bitstream =
+    test_bitstream.fabric_bitstream;
+  fabric_bitstream.set_use_address(true);
+  fabric_bitstream.set_address_length(addr_size);
+  fabric_bitstream.set_address_mask_length(mask_size);
+
+  size_t num_bits = 0;
+  for (size_t iregion = 0; iregion < decoder_sizes.size(); ++iregion) {
+    const size_t& decoder_size = decoder_sizes[iregion];
+    openfpga::FabricBitRegionId region = fabric_bitstream.add_region();
+    fabric_bitstream.set_region_address_mask_length(region, decoder_size);
+    test_bitstream.region_frames.emplace_back();
+
+    size_t child_addr_size = addr_size - decoder_size;
+    for (size_t iframe = 0; iframe < (size_t(1) << addr_size); ++iframe) {
+      std::vector<char> address;
+      for (size_t ibit = 0; ibit < addr_size; ++ibit) {
+        address.push_back((0 != (iframe & (size_t(1) << ibit))) ? '1' : '0');
+      }
+      size_t child_code = iframe % (size_t(1) << child_addr_size);
+      size_t top_code = iframe >> child_addr_size;
+      bool din = (0 == (child_code + iregion + (1 == top_code ? 1 : 0)) % 3);
+
+      openfpga::FabricBitId bit =
+        fabric_bitstream.add_bit(openfpga::ConfigBitId(num_bits++));
+      fabric_bitstream.set_bit_address(bit, address);
+      fabric_bitstream.set_bit_din(bit, din);
+      fabric_bitstream.add_bit_to_region(region, bit);
+      test_bitstream.region_frames.back()[std::string(
+        address.begin(), address.end())] = din;
+    }
+  }
+  return test_bitstream;
+}
+
+/* Emulate the multicast words and compare the frames with the expected
+ * ones. Return the number of mismatches */
+static size_t test_frame_multicast_fabric_bitstream(
+  const std::string& test_name, const TestFabricBitstream& test_bitstream,
+  const bool& fast_configuration, const size_t& max_num_words) {
+  const openfpga::FabricBitstream& fabric_bitstream =
+    test_bitstream.fabric_bitstream;
+  const bool bit_value_to_skip = false;
+  openfpga::FrameMulticastFabricBitstream fabric_words =
+    openfpga::build_frame_based_multicast_fabric_bitstream(
+      fabric_bitstream, fast_configuration, bit_value_to_skip);
+
+  size_t num_err = 0;
+  if (max_num_words < fabric_words.size()) {
+    VTR_LOG_ERROR("Test '%s' requires %lu words, more than %lu\n",
+                  test_name.c_str(), fabric_words.size(), max_num_words);
+    num_err++;
+  }
+
+  size_t mask_size = fabric_bitstream.address_mask_length();
+  std::vector<std::map<std::string, bool>> written_frames(
+    fabric_bitstream.num_regions());
+  for (const openfpga::FrameMulticastFabricWord& word : fabric_words) {
+    VTR_ASSERT(mask_size == word.address_mask.size());
+    VTR_ASSERT(fabric_bitstream.num_regions() == word.din.size());
+    for (const openfpga::FabricBitRegionId& region :
+         fabric_bitstream.regions()) {
+      /* The top-level decoder of a region only takes the MSBs of address
+       * mask */
+      size_t decoder_size = fabric_bitstream.region_address_mask_length(region);
+      std::vector<size_t> masked_bits;
+      for (size_t ibit = mask_size - decoder_size; ibit < mask_size; ++ibit) {
+        if ('1' == word.address_mask[ibit]) {
+          masked_bits.push_back(word.address.size() - mask_size + ibit);
+        }
+      }
+      for (size_t icode = 0; icode < (size_t(1) << masked_bits.size());
+           ++icode) {
+        std::string address = word.address;
+        for (size_t ibit = 0; ibit < masked_bits.size(); ++ibit) {
+          if (0 != (icode & (size_t(1) << ibit))) {
+            address[masked_bits[ibit]] = '1';
+          }
+        }
+        if (test_bitstream.region_frames[size_t(region)].at(address) !=
+            word.din[size_t(region)]) {
+          VTR_LOG_ERROR("Test '%s' writes a wrong value to frame '%s' of "
+                        "region %lu\n",
+                        test_name.c_str(), address.c_str(), size_t(region));
+          num_err++;
+        }
+        written_frames[size_t(region)][address] = true;
+      }
+    }
+  }
+
+  for (const openfpga::FabricBitRegionId& region :
+       fabric_bitstream.regions()) {
+    for (const auto& frame : test_bitstream.region_frames[size_t(region)]) {
+      if ((0 < written_frames[size_t(region)].count(frame.first)) ||
+          ((true == fast_configuration) &&
+           (bit_value_to_skip == frame.second))) {
+        continue;
+      }
+      VTR_LOG_ERROR("Test '%s' misses frame '%s' of region %lu\n",
+                    test_name.c_str(), frame.first.c_str(), size_t(region));
+      num_err++;
+    }
+  }
+
+  return num_err;
+}
+
+int main(int argc, const char** argv) {
+  /* No argument is required */
+  VTR_ASSERT(1 == argc);
+  (void)argv;
+
+  /* Bitstreams with the number of words expected at most. Merging is only
+   * guaranteed when all the top-level decoders have the same width */
+  std::vector<std::pair<std::string, std::vector<size_t>>> tests = {
+    {"equal_decoders", {3, 3}},
+    {"unequal_decoders", {3, 2, 1}},
+    {"short_wired_region", {3, 0}}};
+  std::vector<size_t> max_num_words = {32, 64, 64};
+
+  size_t num_err = 0;
+  for (size_t itest = 0; itest < tests.size(); ++itest) {
+    TestFabricBitstream test_bitstream =
+      build_test_fabric_bitstream(6, 3, tests[itest].second);
+    for (const bool& fast_configuration : {false, true}) {
+      num_err += test_frame_multicast_fabric_bitstream(
+        tests[itest].first, test_bitstream, fast_configuration,
+        max_num_words[itest]);
+    }
+  }
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors\n", num_err);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests\n");
+  return 0;
+}
@@ -0,0 +1,163 @@
+/********************************************************************
+ * Unit test of the utilities on pb_graph pins
+ * Build small groups of pb_graph pins, whose input edges come from several
+ * interconnects, with input pins repeated across edges. Then check that
+ * count_pb_graph_pins_interconnect_num_inputs()
+ * 1. finds each interconnect driving the pins exactly once
+ * 2. counts the same number of inputs for each interconnect as the sum of
+ *    pb_graph_pin_inputs() over the pins
+ *******************************************************************/
+#include <map>
+#include <utility>
+#include <vector>
+
+/* Headers from vtrutils */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+/* Headers from openfpga */
+#include "pb_graph_utils.h"
+
+/* A group of pins with their input edges, which owns all the arrays that
+ * the pins and edges point to */
+struct TestPbGraphPins {
+  std::vector<int> num_pins;
+  std::vector<std::vector<t_pb_graph_pin>> pins;
+  std::vector<t_pb_graph_pin*> port_pins;
+  std::vector<t_pb_graph_pin> source_pins;
+  std::vector<t_interconnect> interconnects;
+  std::vector<t_pb_graph_edge> edges;
+  std::vector<std::vector<t_pb_graph_pin*>> edge_input_pins;
+  std::vector<std::vector<t_pb_graph_edge*>> pin_input_edges;
+};
+
+/* Create the edges of a group of pins from a seed, so that edges of the
+ * same interconnect may share their input pins */
+static void build_test_pb_graph_pins(TestPbGraphPins& test_pins,
+                                     const std::vector<int>& num_pins,
+                                     const size_t& num_interconnects,
+                                     const size_t& num_source_pins,
+                                     unsigned seed) {
+  auto next_random = [&seed](const size_t& range) {
+    seed = seed * 1103515245 + 12345;
+    return size_t((seed >> 16) % range);
+  };
+
+  test_pins.num_pins = num_pins;
+  test_pins.source_pins.resize(num_source_pins);
+  test_pins.interconnects.resize(num_interconnects);
+  test_pins.pins.resize(num_pins.size());
+  size_t num_total_pins = 0;
+  for (size_t iport = 0; iport < num_pins.size(); ++iport) {
+    test_pins.pins[iport].resize(num_pins[iport]);
+    num_total_pins += num_pins[iport];
+  }
+
+  /* Reserve the edges, so that the pointers to them are stable */
+  size_t max_num_edges_per_pin = 4;
+  test_pins.edges.reserve(num_total_pins * max_num_edges_per_pin);
+  test_pins.edge_input_pins.reserve(num_total_pins * max_num_edges_per_pin);
+  test_pins.pin_input_edges.reserve(num_total_pins);
+  for (size_t iport = 0; iport < num_pins.size(); ++iport) {
+    for (t_pb_graph_pin& pin : test_pins.pins[iport]) {
+      test_pins.pin_input_edges.emplace_back();
+      size_t num_edges = next_random(max_num_edges_per_pin + 1);
+      for (size_t iedge = 0; iedge < num_edges; ++iedge) {
+        test_pins.edge_input_pins.emplace_back();
+        size_t num_edge_inputs = 1 + next_random(3);
+        for (size_t iinput = 0; iinput < num_edge_inputs; ++iinput) {
+          test_pins.edge_input_pins.back().push_back(
+            &(test_pins.source_pins[next_random(num_source_pins)]));
+        }
+        test_pins.edges.emplace_back();
+        t_pb_graph_edge& edge = test_pins.edges.back();
+        edge.interconnect =
+          &(test_pins.interconnects[next_random(num_interconnects)]);
+        edge.input_pins = test_pins.edge_input_pins.back().data();
+        edge.num_input_pins = test_pins.edge_input_pins.back().size();
+        test_pins.pin_input_edges.back().push_back(&edge);
+      }
+      pin.input_edges = test_pins.pin_input_edges.back().data();
+      pin.num_input_edges = test_pins.pin_input_edges.back().size();
+    }
+  }
+  for (std::vector<t_pb_graph_pin>& port_pins : test_pins.pins) {
+    test_pins.port_pins.push_back(port_pins.data());
+  }
+}
+
+/* Compare the counting with pb_graph_pin_inputs(). Return the number of
+ * mismatches */
+static size_t test_count_pb_graph_pins_interconnect_num_inputs(
+  TestPbGraphPins& test_pins) {
+  std::map<t_interconnect*, size_t> expected_num_inputs;
+  for (std::vector<t_pb_graph_pin>& port_pins : test_pins.pins) {
+    for (t_pb_graph_pin& pin : port_pins) {
+      for (int iedge = 0; iedge < pin.num_input_edges; ++iedge) {
+        expected_num_inputs[pin.input_edges[iedge]->interconnect] = 0;
+      }
+    }
+  }
+  for (auto& interc_num_inputs : expected_num_inputs) {
+    for (std::vector<t_pb_graph_pin>& port_pins : test_pins.pins) {
+      for (t_pb_graph_pin& pin : port_pins) {
+        interc_num_inputs.second +=
+          openfpga::pb_graph_pin_inputs(&pin, interc_num_inputs.first).size();
+      }
+    }
+  }
+
+  std::vector<openfpga::InterconnectNumInputs> interc_num_inputs;
+  std::vector<std::pair<size_t, t_pb_graph_pin*>> pin_inputs;
+  openfpga::count_pb_graph_pins_interconnect_num_inputs(
+    test_pins.port_pins.data(), test_pins.port_pins.size(),
+    test_pins.num_pins.data(), interc_num_inputs, pin_inputs);
+
+  size_t num_err = 0;
+  if (expected_num_inputs.size() != interc_num_inputs.size()) {
+    VTR_LOG_ERROR("Found %lu interconnects while %lu are expected\n",
+                  interc_num_inputs.size(), expected_num_inputs.size());
+    num_err++;
+  }
+  for (const openfpga::InterconnectNumInputs& num_inputs : interc_num_inputs) {
+    auto result = expected_num_inputs.find(num_inputs.first);
+    if (expected_num_inputs.end() == result) {
+      VTR_LOG_ERROR("Found an interconnect which drives none of the pins\n");
+      num_err++;
+      continue;
+    }
+    if (result->second != num_inputs.second) {
+      VTR_LOG_ERROR("Count %lu inputs of an interconnect, expect %lu\n",
+                    num_inputs.second, result->second);
+      num_err++;
+    }
+    /* Each interconnect should be found only once */
+    expected_num_inputs.erase(result);
+  }
+  return num_err;
+}
+
+int main(int argc, const char** argv) {
+  /* No argument is required */
+  VTR_ASSERT(1 == argc);
+  (void)argv;
+
+  /* Groups of ports with different number of pins */
+  std::vector<std::vector<int>> tests = {{1}, {4}, {2, 3}, {8, 1, 5}};
+
+  size_t num_err = 0;
+  for (const std::vector<int>& num_pins : tests) {
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+      TestPbGraphPins test_pins;
+      build_test_pb_graph_pins(test_pins, num_pins, 3, 6, seed);
+      num_err += test_count_pb_graph_pins_interconnect_num_inputs(test_pins);
+    }
+  }
+
+  if (0 < num_err) {
+    VTR_LOG("Found %lu errors\n", num_err);
+    return 1;
+  }
+  VTR_LOG("Passed all the tests\n");
+  return 0;
+}
@@ -34,6 +34,7 @@ run-task basic_tests/full_testbench/smart_fast_multi_region_configuration_chain
 run-task basic_tests/preconfig_testbench/configuration_chain $@
 run-task basic_tests/preconfig_testbench/configuration_chain_config_done_io $@
 run-task basic_tests/preconfig_testbench/configuration_chain_no_time_stamp $@
+run-task basic_tests/preconfig_testbench/configured_fabric $@
 
 echo -e "Testing fram-based configuration protocol of a K4N4 FPGA";
 run-task basic_tests/full_testbench/configuration_frame $@